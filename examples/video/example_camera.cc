@@ -94,7 +94,7 @@ public:
         }
         
         // Create or update texture
-        auto tex_size = preview_texture ? preview_texture->get_size() : expected<size_i, std::string>{};
+        auto tex_size = preview_texture ? preview_texture->get_size() : expected<size_i, error>{};
         if (!preview_texture || !tex_size ||
             tex_size->width != frame->w ||
             tex_size->height != frame->h) {
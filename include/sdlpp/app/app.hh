@@ -24,8 +24,11 @@
 
 #include <sdlpp/detail/export.hh>
 #include <sdlpp/core/core.hh>
+#include <sdlpp/core/phase_profiler.hh>
 #include <sdlpp/events/events.hh>
+#include <sdlpp/system/job_system.hh>
 #include <atomic>
+#include <memory>
 
 namespace sdlpp {
 
@@ -163,6 +166,35 @@ namespace sdlpp {
          */
         [[nodiscard]] bool is_running() const noexcept;
 
+        /**
+         * @brief Get the application's shared job scheduler
+         * @return Work-stealing pool with one worker per core (minus the main thread)
+         * @note Started on first use; make the first call from the main thread,
+         *       e.g. in on_init(). The pool finishes its queued jobs and stops
+         *       after on_quit() returns.
+         */
+        [[nodiscard]] job_system& jobs();
+
+        /**
+         * @brief Get the profiler timing application startup
+         * @return Phase profiler whose origin is the application's construction
+         * @note SDL initialization and game_application's own setup are
+         *       recorded as phases; add application phases with begin()
+         */
+        [[nodiscard]] phase_profiler& startup_profile() noexcept;
+        [[nodiscard]] const phase_profiler& startup_profile() const noexcept;
+
+        /**
+         * @brief Initialize optional SDL subsystems on first use
+         * @param flags Subsystems needed (e.g. init_flags::audio)
+         * @return true if all of them are initialized
+         * @note Keeps audio, gamepad or camera out of the startup path: pass
+         *       only the subsystems needed for the first frame to the
+         *       constructor and call this where the feature is first used.
+         *       The first initialization is recorded in startup_profile().
+         */
+        bool require_subsystem(init_flags flags);
+
         /// @internal Initialize SDL (called by entry_point)
         void init_sdl_();
 
@@ -173,6 +205,8 @@ namespace sdlpp {
         init_flags init_flags_;
         std::atomic<bool> running_{true};
         std::optional<init> sdl_init_;
+        std::unique_ptr<job_system> jobs_;
+        phase_profiler startup_profile_;
     };
 
 } // namespace sdlpp
@@ -28,7 +28,13 @@
 #include <sdlpp/video/renderer.hh>
 #include <sdlpp/video/surface.hh>
 #include <sdlpp/core/failsafe_backend.hh>
+#include <sdlpp/core/frame_pacer.hh>
+#include <sdlpp/core/timer.hh>
+#include <sdlpp/utility/triple_buffer.hh>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <thread>
 
@@ -43,6 +49,10 @@ namespace sdlpp {
         int height;
         window_flags flags = window_flags::none;
         int target_fps = 60;  ///< Target FPS (0 = unlimited/vsync)
+        int tick_rate = 0;  ///< Fixed update rate in Hz (0 = one variable-step update per frame)
+        int max_catch_up_steps = 5;  ///< Max fixed updates per frame before simulation time is dropped
+        bool pipelined = false;  ///< Run on_update on a worker thread, overlapping on_render
+        bool on_demand = false;  ///< Sleep until input or request_redraw() instead of rendering continuously
     };
 
     /**
@@ -51,10 +61,19 @@ namespace sdlpp {
      * Provides:
      * - Single window and renderer management
      * - Delta time calculation using std::chrono
-     * - FPS tracking and enforcement
+     * - FPS tracking and enforcement (deadline-based, see frame_pacer)
      * - Separate update and render callbacks
+     * - Optional fixed-timestep updates with render interpolation
      * - Automatic failsafe logger configuration
      *
+     * With a non-zero tick_rate, on_update() runs at that fixed rate from a
+     * time accumulator, independent of the display refresh rate. A slow frame
+     * runs several updates to catch up (at most max_catch_up_steps, after
+     * which the backlog is dropped rather than growing without bound), and
+     * on_render(renderer&, float alpha) receives the fraction of a tick that
+     * has elapsed since the last update, for interpolating between the
+     * previous and current simulation states.
+     *
      * Example:
      * @code
      * #include <sdlpp/app/entry_point.hh>
@@ -80,6 +99,70 @@ namespace sdlpp {
      *
      * SDLPP_MAIN(MyGame)
      * @endcode
+     *
+     * Fixed timestep (120 Hz simulation, render at display rate):
+     * @code
+     * sdlpp::window_config get_window_config() override {
+     *     return {"My Game", 1280, 720, sdlpp::window_flags::none, 0, 120};
+     * }
+     *
+     * void on_update(float dt) override {  // dt is always 1/120 s
+     *     previous_ = current_;
+     *     current_ = step(current_, dt);
+     * }
+     *
+     * void on_render(sdlpp::renderer& r, float alpha) override {
+     *     draw(lerp(previous_, current_, alpha));
+     *     r.present();
+     * }
+     * @endcode
+     *
+     * Pipelined mode (window_config::pipelined) runs the updates for frame
+     * N+1 on a worker thread while the main thread renders frame N, so
+     * simulation and render submission overlap. The two callbacks then run
+     * concurrently and must not share mutable state: on_update publishes a
+     * snapshot through a triple_buffer and on_render draws the latest one.
+     * Rendering, window calls and event handling stay on the main thread;
+     * on_update must not touch the renderer or window. The worker is idle
+     * whenever events are delivered, so handle_event() never races with
+     * on_update().
+     *
+     * @code
+     * sdlpp::triple_buffer<scene_view> views_;
+     *
+     * void on_update(float dt) override {  // worker thread
+     *     world_.step(dt);
+     *     world_.snapshot(views_.write_buffer());
+     *     views_.publish();
+     * }
+     *
+     * void on_render(sdlpp::renderer& r, float alpha) override {  // main thread
+     *     views_.update();
+     *     draw(r, views_.read_buffer(), alpha);
+     *     r.present();
+     * }
+     * @endcode
+     *
+     * On-demand mode (window_config::on_demand) is meant for editors and
+     * tools: instead of rendering continuously, the loop sleeps in the event
+     * queue and renders a frame only when something may have changed:
+     * - an input or window event arrived
+     * - request_redraw() was called (from any thread, e.g. a loader)
+     * - a request_redraw_after() delay expired (caret blink, tooltips)
+     * - an animation declared with animate_until()/animate_for() is running
+     *
+     * While animating the loop runs at target_fps as usual and falls back to
+     * sleeping once the deadline passes. Time spent asleep is not simulated:
+     * the first frame after waking gets a zero delta.
+     *
+     * @code
+     * void handle_event(const sdlpp::event& e) override {
+     *     if (auto* w = e.as<sdlpp::mouse_wheel_event>()) {
+     *         zoom_.target *= std::pow(1.1f, w->y);
+     *         animate_for(std::chrono::milliseconds(250));  // smooth zoom
+     *     }
+     * }
+     * @endcode
      */
     class SDLPP_EXPORT game_application : public abstract_application {
     public:
@@ -116,8 +199,8 @@ namespace sdlpp {
         virtual void on_ready();
 
         /**
-         * @brief Called every frame with delta time
-         * @param delta_time Time since last frame in seconds
+         * @brief Called every frame with delta time, or once per tick in fixed-timestep mode
+         * @param delta_time Time since last frame, or the fixed tick length, in seconds
          */
         virtual void on_update([[maybe_unused]] float delta_time);
 
@@ -127,6 +210,15 @@ namespace sdlpp {
          */
         virtual void on_render([[maybe_unused]] renderer& r);
 
+        /**
+         * @brief Called every frame for rendering with the interpolation factor
+         * @param r The renderer to draw with
+         * @param alpha Fraction of a tick elapsed since the last update, in [0, 1);
+         *        always 1 in variable-timestep mode
+         * @note The default implementation calls on_render(r)
+         */
+        virtual void on_render(renderer& r, [[maybe_unused]] float alpha);
+
         // Window event callbacks
 
         /**
@@ -268,7 +360,123 @@ namespace sdlpp {
          */
         void set_target_fps(int fps);
 
+        /**
+         * @brief Get the frame pacer enforcing target FPS
+         * @return Pacer with frame time percentiles and missed-deadline count
+         */
+        [[nodiscard]] const frame_pacer& pacer() const;
+
+        /**
+         * @brief Get fixed update rate
+         * @return Ticks per second (0 = variable timestep)
+         */
+        [[nodiscard]] int tick_rate() const;
+
+        /**
+         * @brief Set fixed update rate at runtime
+         * @param hz Ticks per second (0 = variable timestep)
+         * @note Pending accumulated time is discarded
+         */
+        void set_tick_rate(int hz);
+
+        /**
+         * @brief Get the maximum number of fixed updates run per frame
+         */
+        [[nodiscard]] int max_catch_up_steps() const;
+
+        /**
+         * @brief Set the maximum number of fixed updates run per frame
+         * @param steps Update limit (clamped to at least 1)
+         */
+        void set_max_catch_up_steps(int steps);
+
+        /**
+         * @brief Get the interpolation factor passed to the last on_render()
+         */
+        [[nodiscard]] float interpolation_alpha() const;
+
+        /**
+         * @brief Get number of fixed updates run so far
+         */
+        [[nodiscard]] std::uint64_t tick_count() const;
+
+        /**
+         * @brief Get number of ticks dropped because a frame hit max_catch_up_steps
+         */
+        [[nodiscard]] std::uint64_t dropped_ticks() const;
+
+        /**
+         * @brief Check if on_update runs on the worker thread
+         */
+        [[nodiscard]] bool is_pipelined() const;
+
+        /**
+         * @brief Enable or disable pipelined update/render
+         * @param enabled true to run on_update on a worker thread
+         * @note Call from the main thread (e.g. from on_ready or an event handler).
+         *       Disabling from on_render stops the worker once the frame's
+         *       update batch has finished.
+         */
+        void set_pipelined(bool enabled);
+
+        // On-demand rendering
+
+        /**
+         * @brief Check if frames are rendered only on demand
+         */
+        [[nodiscard]] bool is_on_demand() const;
+
+        /**
+         * @brief Enable or disable on-demand rendering
+         * @param enabled true to sleep until an event or redraw request
+         * @throws std::runtime_error if the wake-up event type cannot be registered
+         */
+        void set_on_demand(bool enabled);
+
+        /**
+         * @brief Render one more frame
+         * @note Thread-safe; wakes the main loop if it is asleep
+         */
+        void request_redraw();
+
+        /**
+         * @brief Render one frame after a delay
+         * @param delay Time until the frame; an earlier pending request wins
+         * @note Call from the main thread
+         */
+        void request_redraw_after(clock::duration delay);
+
+        /**
+         * @brief Render continuously until a point in time
+         * @param deadline End of the animation; an earlier deadline never shortens a running one
+         * @note Thread-safe, so on_update may call it in pipelined mode
+         */
+        void animate_until(time_point deadline);
+
+        /**
+         * @brief Render continuously for a duration from now
+         */
+        void animate_for(clock::duration length);
+
+        /**
+         * @brief Check if an animation deadline is still in the future
+         */
+        [[nodiscard]] bool is_animating() const;
+
+        /**
+         * @brief Get number of iterations that skipped rendering in on-demand mode
+         */
+        [[nodiscard]] std::uint64_t skipped_frames() const;
+
     private:
+        struct update_worker;
+
+        void run_updates(int steps, float delta);
+
+        void render_frame();
+
+        void set_wait_for_events(bool wait);
+
         void on_event(const event& e) override;
 
         void on_init(int argc, char* argv[]) final;
@@ -282,11 +490,38 @@ namespace sdlpp {
         // Timing
         time_point last_frame_time_;
         time_point fps_update_time_;
-        duration frame_duration_{1.0f / 60.0f};
+        frame_pacer pacer_{60.0};
         float delta_time_ = 0.0f;
         float fps_ = 0.0f;
         int frame_count_ = 0;
         int target_fps_ = 60;
+
+        // Fixed timestep
+        clock::duration tick_duration_{0};
+        clock::duration accumulator_{0};
+        float tick_seconds_ = 0.0f;
+        float alpha_ = 1.0f;
+        int max_catch_up_steps_ = 5;
+        std::uint64_t tick_count_ = 0;
+        std::uint64_t dropped_ticks_ = 0;
+
+        // Pipelined mode
+        std::unique_ptr<update_worker> worker_;
+        bool worker_batch_ = false;    // Between start() and finish() of a frame
+        bool worker_release_ = false;  // set_pipelined(false) deferred to the end of the batch
+
+        // On-demand mode
+        std::atomic<bool> on_demand_{false};
+        std::atomic<bool> redraw_requested_{false};
+        std::atomic<bool> wake_pending_{false};
+        std::atomic<Uint32> wake_event_type_{0};
+        bool frame_needed_ = true;
+        bool idle_ = false;
+        bool waiting_for_events_ = false;
+        std::atomic<clock::rep> animating_until_{0};  // time_since_epoch of the deadline
+        time_point redraw_at_{};
+        timer_handle_ns redraw_timer_;
+        std::uint64_t skipped_frames_ = 0;
     };
 
 } // namespace sdlpp
@@ -13,6 +13,7 @@
  * to work with either rendering backend.
  */
 
+#include <sdlpp/core/error.hh>
 #include <sdlpp/detail/expected.hh>
 #include <sdlpp/utility/geometry_concepts.hh>
 #include <sdlpp/video/color.hh>
@@ -27,6 +28,16 @@
 
 namespace sdlpp {
 
+/**
+ * @brief Result of a renderer operation
+ *
+ * Accepts both the compact sdlpp::error and the older std::string error,
+ * so backends can migrate independently.
+ */
+template<typename R, typename T>
+concept renderer_result = std::same_as<R, expected<T, error>> ||
+                          std::same_as<R, expected<T, std::string>>;
+
 /**
  * @brief Basic renderer concept with core functionality
  * 
@@ -38,15 +49,15 @@ concept basic_renderer = requires(T& r, const T& cr) {
     { cr.is_valid() } -> std::convertible_to<bool>;
     
     // Clear operation
-    { r.clear() } -> std::same_as<expected<void, std::string>>;
+    { r.clear() } -> renderer_result<void>;
 } && requires(T& r, const T& cr, const color& c) {
     // Color management
-    { r.set_draw_color(c) } -> std::same_as<expected<void, std::string>>;
-    { cr.get_draw_color() } -> std::same_as<expected<color, std::string>>;
+    { r.set_draw_color(c) } -> renderer_result<void>;
+    { cr.get_draw_color() } -> renderer_result<color>;
 } && requires(T& r, const T& cr, blend_mode mode) {
     // Blend mode management
-    { r.set_draw_blend_mode(mode) } -> std::same_as<expected<void, std::string>>;
-    { cr.get_draw_blend_mode() } -> std::same_as<expected<blend_mode, std::string>>;
+    { r.set_draw_blend_mode(mode) } -> renderer_result<void>;
+    { cr.get_draw_blend_mode() } -> renderer_result<blend_mode>;
 };
 
 /**
@@ -62,18 +73,18 @@ concept primitive_renderer = basic_renderer<T> && requires(T& r) {
     
     // Point drawing - check with int coordinates
     requires requires(int x, int y) {
-        { r.draw_point(x, y) } -> std::same_as<expected<void, std::string>>;
+        { r.draw_point(x, y) } -> renderer_result<void>;
     };
     
     // Line drawing - check with int coordinates
     requires requires(int x1, int y1, int x2, int y2) {
-        { r.draw_line(x1, y1, x2, y2) } -> std::same_as<expected<void, std::string>>;
+        { r.draw_line(x1, y1, x2, y2) } -> renderer_result<void>;
     };
     
     // Rectangle operations - check with int coordinates
     requires requires(int x, int y, int w, int h) {
-        { r.draw_rect(x, y, w, h) } -> std::same_as<expected<void, std::string>>;
-        { r.fill_rect(x, y, w, h) } -> std::same_as<expected<void, std::string>>;
+        { r.draw_rect(x, y, w, h) } -> renderer_result<void>;
+        { r.fill_rect(x, y, w, h) } -> renderer_result<void>;
     };
 };
 
@@ -84,29 +95,29 @@ template<typename T>
 concept dda_renderer = primitive_renderer<T> && requires(T& r) {
     // Antialiased lines - check with float coordinates
     requires requires(float x1, float y1, float x2, float y2) {
-        { r.draw_line_aa(x1, y1, x2, y2) } -> std::same_as<expected<void, std::string>>;
+        { r.draw_line_aa(x1, y1, x2, y2) } -> renderer_result<void>;
     };
     
     // Thick lines
     requires requires(float x1, float y1, float x2, float y2, float thickness) {
-        { r.draw_line_thick(x1, y1, x2, y2, thickness) } -> std::same_as<expected<void, std::string>>;
+        { r.draw_line_thick(x1, y1, x2, y2, thickness) } -> renderer_result<void>;
     };
     
     // Circles
     requires requires(int x, int y, int radius) {
-        { r.draw_circle(x, y, radius) } -> std::same_as<expected<void, std::string>>;
-        { r.fill_circle(x, y, radius) } -> std::same_as<expected<void, std::string>>;
+        { r.draw_circle(x, y, radius) } -> renderer_result<void>;
+        { r.fill_circle(x, y, radius) } -> renderer_result<void>;
     };
     
     // Ellipses
     requires requires(int x, int y, int rx, int ry) {
-        { r.draw_ellipse(x, y, rx, ry) } -> std::same_as<expected<void, std::string>>;
-        { r.fill_ellipse(x, y, rx, ry) } -> std::same_as<expected<void, std::string>>;
+        { r.draw_ellipse(x, y, rx, ry) } -> renderer_result<void>;
+        { r.fill_ellipse(x, y, rx, ry) } -> renderer_result<void>;
     };
     
     // Ellipse arcs
     requires requires(int x, int y, int rx, int ry, float start_angle, float end_angle) {
-        { r.draw_ellipse_arc(x, y, rx, ry, start_angle, end_angle) } -> std::same_as<expected<void, std::string>>;
+        { r.draw_ellipse_arc(x, y, rx, ry, start_angle, end_angle) } -> renderer_result<void>;
     };
 };
 
@@ -117,12 +128,12 @@ template<typename T>
 concept bezier_renderer = dda_renderer<T> && requires(T& r) {
     // Quadratic Bezier
     requires requires(float x0, float y0, float x1, float y1, float x2, float y2) {
-        { r.draw_bezier_quad(x0, y0, x1, y1, x2, y2) } -> std::same_as<expected<void, std::string>>;
+        { r.draw_bezier_quad(x0, y0, x1, y1, x2, y2) } -> renderer_result<void>;
     };
     
     // Cubic Bezier
     requires requires(float x0, float y0, float x1, float y1, float x2, float y2, float x3, float y3) {
-        { r.draw_bezier_cubic(x0, y0, x1, y1, x2, y2, x3, y3) } -> std::same_as<expected<void, std::string>>;
+        { r.draw_bezier_cubic(x0, y0, x1, y1, x2, y2, x3, y3) } -> renderer_result<void>;
     };
 };
 
@@ -142,7 +153,7 @@ template<typename T>
 concept euler_angle_renderer = dda_renderer<T> && requires(T& r) {
     // Check for euler angle overloads
     requires requires(int x, int y, int rx, int ry, euler::radian<float> start, euler::radian<float> end) {
-        { r.draw_ellipse_arc(x, y, rx, ry, start, end) } -> std::same_as<expected<void, std::string>>;
+        { r.draw_ellipse_arc(x, y, rx, ry, start, end) } -> renderer_result<void>;
     };
 };
 
@@ -73,6 +73,7 @@ namespace sdlpp {
         // App info hints
         inline constexpr std::string_view app_name = SDL_HINT_APP_NAME;
         inline constexpr std::string_view app_id = SDL_HINT_APP_ID;
+        inline constexpr std::string_view main_callback_rate = SDL_HINT_MAIN_CALLBACK_RATE;
 
         // Timer hints
         inline constexpr std::string_view timer_resolution = SDL_HINT_TIMER_RESOLUTION;
@@ -0,0 +1,232 @@
+#pragma once
+
+/**
+ * @file async_log_backend.hh
+ * @brief Asynchronous logger backend with a lock-free record queue
+ *
+ * failsafe_backend formats and emits every message on the calling thread
+ * under a mutex, so worker threads that log contend with each other and
+ * with SDL's output. async_log_backend only copies the message into a
+ * fixed-size record in a bounded multi-producer queue; a background thread
+ * resolves categories, formats timestamps and calls SDL_LogMessage.
+ *
+ * @code
+ * // Replaces create_failsafe_sdl_backend()
+ * failsafe::logger::set_backend(sdlpp::create_failsafe_async_backend());
+ *
+ * // Or own the backend explicitly
+ * sdlpp::async_log_backend::config cfg;
+ * cfg.overflow = sdlpp::async_log_backend::overflow_policy::block;
+ * sdlpp::async_log_backend backend(cfg);
+ * backend.install_crash_handler();
+ * failsafe::logger::set_backend(backend.get_logger());
+ * @endcode
+ *
+ * - Producers never lock: a slot is claimed with one compare-and-swap
+ * - Messages longer than a record are truncated (marked with "...")
+ * - flush() waits until everything logged so far has been emitted
+ * - install_crash_handler() drains the queue on std::terminate and on
+ *   fatal signals, so the messages leading up to a crash are not lost
+ */
+
+#include <sdlpp/core/failsafe_backend.hh>
+#include <sdlpp/core/log.hh>
+#include <sdlpp/detail/export.hh>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+namespace sdlpp {
+    /**
+     * @brief Logger backend that emits messages from a background thread
+     */
+    class async_log_backend {
+        public:
+            /**
+             * @brief What a producer does when the queue is full
+             */
+            enum class overflow_policy {
+                drop,   ///< Discard the message
+                block,  ///< Wait for the writer thread to make room
+                count   ///< Discard the message and log how many were lost
+            };
+
+            /**
+             * @brief Configuration options for the backend
+             */
+            struct config {
+                bool show_timestamp = true;      ///< Include timestamp in output
+                bool show_thread_id = true;      ///< Include thread ID in output
+                bool show_file_line = true;      ///< Include file:line information
+                std::string timestamp_format = "%Y-%m-%d %H:%M:%S"; ///< strftime format for timestamps
+                std::size_t capacity = 4096;     ///< Queued records; rounded up to a power of two
+                overflow_policy overflow = overflow_policy::count;
+                std::chrono::milliseconds idle_wait{10};  ///< Writer poll interval, i.e. worst-case output delay
+            };
+
+            /**
+             * @brief Bytes of category, file name and message stored per record
+             */
+            static constexpr std::size_t record_text_capacity = 448;
+
+            /**
+             * @brief Start the writer thread with default configuration
+             */
+            SDLPP_EXPORT async_log_backend();
+
+            /**
+             * @brief Start the writer thread
+             * @param cfg Configuration options
+             */
+            SDLPP_EXPORT explicit async_log_backend(const config& cfg);
+
+            /**
+             * @brief Emit everything still queued and stop the writer thread
+             */
+            SDLPP_EXPORT ~async_log_backend();
+
+            async_log_backend(const async_log_backend&) = delete;
+            async_log_backend& operator=(const async_log_backend&) = delete;
+
+            /**
+             * @brief Queue a message
+             * @param priority Message priority
+             * @param category Category name, mapped to an SDL category by the writer
+             * @param file Source file name (may be null)
+             * @param line Source line
+             * @param message Message text
+             * @return false if the message was dropped because the queue was full
+             */
+            SDLPP_EXPORT bool log(log_priority priority, std::string_view category,
+                                  const char* file, int line, std::string_view message);
+
+            /**
+             * @brief Get the logger function object for failsafe
+             * @return Function object that can be passed to failsafe's set_logger()
+             */
+            auto get_logger() {
+                return [this](int level, const char* category, const char* file, int line,
+                              const std::string& message) {
+                    log(failsafe_backend::map_level(level), category ? category : "", file, line, message);
+                };
+            }
+
+            /**
+             * @brief Block until every message queued before this call has been emitted
+             */
+            SDLPP_EXPORT void flush();
+
+            /**
+             * @brief Map a category name to an SDL++ log category
+             */
+            SDLPP_EXPORT void map_category(const std::string& name, int sdl_category);
+
+            void map_category(const std::string& name, log_category sdl_category) {
+                map_category(name, to_sdl_category(sdl_category));
+            }
+
+            /**
+             * @brief Set the SDL++ category used for unmapped category names
+             */
+            SDLPP_EXPORT void set_default_category(int category);
+
+            void set_default_category(log_category category) {
+                set_default_category(to_sdl_category(category));
+            }
+
+            /**
+             * @brief Messages discarded because the queue was full
+             */
+            [[nodiscard]] std::uint64_t dropped() const noexcept {
+                return dropped_.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Queue size in records
+             */
+            [[nodiscard]] std::size_t capacity() const noexcept {
+                return mask_ + 1;
+            }
+
+            [[nodiscard]] const config& get_config() const noexcept {
+                return config_;
+            }
+
+            /**
+             * @brief Flush this backend on std::terminate, SIGSEGV, SIGABRT,
+             *        SIGFPE and SIGILL
+             *
+             * The previous handlers are restored and re-invoked after the
+             * flush. Only one backend can be installed at a time; installing
+             * another replaces it, and destroying it uninstalls it.
+             *
+             * @note Flushing from a signal handler is best effort: it is not
+             *       async-signal-safe, but by then the process is going down.
+             */
+            SDLPP_EXPORT void install_crash_handler();
+
+        private:
+            struct record;
+            struct slot;
+
+            [[nodiscard]] bool claim(std::uint64_t& position);
+            [[nodiscard]] bool pending() const noexcept;
+            void run();
+            bool drain(std::string& line);
+            bool drain_records(std::string& line);
+            void emit(const record& r, std::string& line);
+            void append_timestamp(std::string& line, std::int64_t timestamp_ns);
+            void report_drops(std::string& line);
+            void flush_from_crash() noexcept;
+
+            static void handle_terminate();
+            static void handle_signal(int sig);
+
+            config config_;
+            std::unique_ptr <slot[]> slots_;
+            std::uint64_t mask_;
+
+            alignas(64) std::atomic <std::uint64_t> tail_{0};   // Next slot to claim
+            alignas(64) std::atomic <std::uint64_t> head_{0};   // Next slot to emit
+            std::atomic <std::uint64_t> dropped_{0};
+            std::uint64_t reported_drops_ = 0;                  // Writer only
+            std::atomic <bool> writer_sleeping_{false};
+            std::atomic <bool> stop_{false};
+            std::atomic_flag draining_ = ATOMIC_FLAG_INIT;      // Held while emitting records
+
+            std::mutex mutex_;                                  // Guards categories and sleeping
+            std::condition_variable wake_cv_;
+            std::condition_variable flushed_cv_;
+            std::unordered_map <std::string, int> category_map_;
+            int default_category_ = to_sdl_category(log_category::application);
+
+            // Writer-side caches
+            std::int64_t cached_second_ = -1;
+            std::string cached_timestamp_;
+            std::thread::id cached_thread_;
+            std::string cached_thread_text_;
+            std::string category_key_;
+
+            std::thread writer_;  // Last: started once the state above exists
+    };
+
+    /**
+     * @brief Convenience function to create a shared asynchronous backend for failsafe
+     * @param show_timestamp Whether to include timestamps
+     * @param show_thread_id Whether to include thread IDs
+     * @return Logger function object ready to use with failsafe
+     * @note The backend installs its crash handler and lives until program exit
+     */
+    SDLPP_EXPORT std::function <void(int, const char*, const char*, int, const std::string&)>
+    create_failsafe_async_backend(bool show_timestamp = true, bool show_thread_id = true);
+} // namespace sdlpp
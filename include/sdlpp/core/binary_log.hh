@@ -0,0 +1,408 @@
+#pragma once
+
+/**
+ * @file binary_log.hh
+ * @brief Deferred-format binary logging for high-rate diagnostics
+ *
+ * Text logging formats every message when it is logged; even the async
+ * backend pays for building the string on the calling thread. For
+ * per-event and per-draw diagnostics SDLPP_BLOG records only what is
+ * needed to reconstruct the message later:
+ *
+ * - a site id, registered once per call site together with its
+ *   std::source_location, format string, category and priority
+ * - the raw performance counter value
+ * - the raw bytes of the arguments (strings are length-prefixed)
+ *
+ * @code
+ * SDLPP_BLOG(sdlpp::log_category::input, sdlpp::log_priority::debug,
+ *            "key {} down at ({}, {})", event.key, x, y);
+ *
+ * // Periodically (e.g. once per frame) and before exit
+ * std::ofstream out("session.sdlpplog", std::ios::binary | std::ios::app);
+ * sdlpp::binary_log::save(out);
+ *
+ * // Later, possibly in another process
+ * auto log = sdlpp::binary_log_reader::read(in);
+ * log->write_text(std::cout);
+ * @endcode
+ *
+ * Each thread writes into its own byte ring, so logging never locks and
+ * never allocates after the thread's first message. A full ring drops and
+ * counts records until save() drains it. Once a thread has exited, the
+ * first save() (or clear()) that drains its ring also frees it.
+ *
+ * Format strings use "{}" placeholders ("{{" and "}}" for literal braces).
+ * Arguments may be arithmetic types, enums, pointers and strings
+ * (const char*, std::string, std::string_view); strings longer than
+ * max_string_bytes are truncated.
+ *
+ * @note Saved logs use the host byte order and are meant to be decoded on
+ *       a machine of the same endianness.
+ */
+
+#include <sdlpp/core/log.hh>
+#include <sdlpp/detail/export.hh>
+#include <sdlpp/detail/expected.hh>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace sdlpp {
+    /**
+     * @brief Encoding of one recorded argument
+     */
+    enum class binary_log_arg : std::uint8_t {
+        boolean,
+        character,
+        int8,
+        int16,
+        int32,
+        int64,
+        uint8,
+        uint16,
+        uint32,
+        uint64,
+        float32,
+        float64,
+        pointer,
+        string   ///< std::uint32_t length followed by the bytes
+    };
+
+    /**
+     * @brief Static description of one SDLPP_BLOG call site
+     */
+    struct binary_log_site {
+        std::uint32_t id = 0;  ///< 0 if registration failed
+        int category = 0;
+        log_priority priority = log_priority::info;
+        const char* format = "";
+        std::source_location location;
+        const binary_log_arg* args = nullptr;
+        std::uint32_t arg_count = 0;
+    };
+
+    namespace detail {
+        inline constexpr std::size_t binary_log_max_string = 4096;
+
+        template<typename>
+        inline constexpr bool binary_log_unsupported = false;
+
+        template<typename T>
+        consteval binary_log_arg binary_log_arg_of() {
+            if constexpr (std::is_same_v <T, bool>) {
+                return binary_log_arg::boolean;
+            } else if constexpr (std::is_same_v <T, char>) {
+                return binary_log_arg::character;
+            } else if constexpr (std::is_enum_v <T>) {
+                return binary_log_arg_of <std::underlying_type_t <T>>();
+            } else if constexpr (std::is_integral_v <T>) {
+                constexpr binary_log_arg sized[2][4] = {
+                    {binary_log_arg::int8, binary_log_arg::int16, binary_log_arg::int32, binary_log_arg::int64},
+                    {binary_log_arg::uint8, binary_log_arg::uint16, binary_log_arg::uint32, binary_log_arg::uint64}
+                };
+                constexpr int index = sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3;
+                return sized[std::is_unsigned_v <T> ? 1 : 0][index];
+            } else if constexpr (std::is_same_v <T, float>) {
+                return binary_log_arg::float32;
+            } else if constexpr (std::is_floating_point_v <T>) {
+                return binary_log_arg::float64;
+            } else if constexpr (std::is_convertible_v <const T&, std::string_view>) {
+                return binary_log_arg::string;
+            } else if constexpr (std::is_pointer_v <T> || std::is_null_pointer_v <T>) {
+                return binary_log_arg::pointer;
+            } else {
+                static_assert(binary_log_unsupported <T>,
+                              "SDLPP_BLOG arguments must be arithmetic, enum, pointer or string values");
+                return binary_log_arg::pointer;
+            }
+        }
+
+        /**
+         * @brief Encoded size of a fixed-size argument (0 for strings)
+         */
+        constexpr std::size_t binary_log_arg_size(binary_log_arg arg) noexcept {
+            switch (arg) {
+                case binary_log_arg::boolean:
+                case binary_log_arg::character:
+                case binary_log_arg::int8:
+                case binary_log_arg::uint8:
+                    return 1;
+                case binary_log_arg::int16:
+                case binary_log_arg::uint16:
+                    return 2;
+                case binary_log_arg::int32:
+                case binary_log_arg::uint32:
+                case binary_log_arg::float32:
+                    return 4;
+                case binary_log_arg::int64:
+                case binary_log_arg::uint64:
+                case binary_log_arg::float64:
+                case binary_log_arg::pointer:
+                    return 8;
+                case binary_log_arg::string:
+                    return 0;
+            }
+            return 0;
+        }
+
+        template<typename... Args>
+        inline constexpr std::array <binary_log_arg, sizeof...(Args)> binary_log_signature{
+            binary_log_arg_of <Args>()...
+        };
+
+        /**
+         * @brief Encode arguments of type T into a record payload
+         */
+        template<typename T>
+        struct binary_log_value {
+            static constexpr binary_log_arg kind = binary_log_arg_of <T>();
+
+            static std::string_view text(const T& value) noexcept {
+                if constexpr (std::is_pointer_v <T>) {
+                    if (!value) {
+                        return {};
+                    }
+                }
+                const std::string_view view(value);
+                return view.substr(0, std::min(view.size(), binary_log_max_string));
+            }
+
+            static std::size_t size(const T& value) noexcept {
+                if constexpr (kind == binary_log_arg::string) {
+                    return sizeof(std::uint32_t) + text(value).size();
+                } else {
+                    return binary_log_arg_size(kind);
+                }
+            }
+
+            static std::byte* write(std::byte* out, const T& value) noexcept {
+                if constexpr (kind == binary_log_arg::string) {
+                    const auto view = text(value);
+                    const auto length = static_cast <std::uint32_t>(view.size());
+                    std::memcpy(out, &length, sizeof(length));
+                    if (length > 0) {
+                        std::memcpy(out + sizeof(length), view.data(), view.size());
+                    }
+                    return out + sizeof(length) + view.size();
+                } else if constexpr (kind == binary_log_arg::boolean) {
+                    *out = std::byte{value ? std::uint8_t{1} : std::uint8_t{0}};
+                    return out + 1;
+                } else if constexpr (kind == binary_log_arg::pointer) {
+                    const auto address = static_cast <std::uint64_t>(reinterpret_cast <std::uintptr_t>(value));
+                    std::memcpy(out, &address, sizeof(address));
+                    return out + sizeof(address);
+                } else if constexpr (kind == binary_log_arg::float64) {
+                    const auto wide = static_cast <double>(value);
+                    std::memcpy(out, &wide, sizeof(wide));
+                    return out + sizeof(wide);
+                } else {
+                    static_assert(sizeof(T) == binary_log_arg_size(kind));
+                    std::memcpy(out, &value, sizeof(T));
+                    return out + sizeof(T);
+                }
+            }
+        };
+
+        template<std::size_t N>
+        struct binary_log_value <char[N]> : binary_log_value <const char*> {
+        };
+
+        template<std::size_t N>
+        struct binary_log_value <const char[N]> : binary_log_value <const char*> {
+        };
+    } // namespace detail
+
+    /**
+     * @brief Process-wide binary log recorder
+     */
+    class binary_log {
+        public:
+            static constexpr std::size_t default_buffer_bytes = std::size_t{1} << 20;
+
+            /**
+             * @brief Longest string argument stored, in bytes
+             */
+            static constexpr std::size_t max_string_bytes = detail::binary_log_max_string;
+
+            /**
+             * @brief Register a call site and assign its id
+             *
+             * Called once per site by SDLPP_BLOG; returns a site with id 0
+             * (never recorded) if the registry could not grow.
+             */
+            template<typename... Args, typename Category>
+            [[nodiscard]] static binary_log_site make_site(Category category, log_priority priority,
+                                                           const char* format,
+                                                           const std::source_location& location) noexcept {
+                binary_log_site site;
+                site.category = detail::log_category_value(category);
+                site.priority = priority;
+                site.format = format;
+                site.location = location;
+                site.args = detail::binary_log_signature <Args...>.data();
+                site.arg_count = static_cast <std::uint32_t>(sizeof...(Args));
+                site.id = register_site(site);
+                return site;
+            }
+
+            /**
+             * @brief Record one message; prefer the SDLPP_BLOG macro
+             * @param site_of Returns the static site for these argument types
+             * @param location Call site location
+             * @param args Message arguments, stored unformatted
+             */
+            template<typename SiteOf, typename... Args>
+            static void write(SiteOf site_of, const std::source_location& location,
+                              const Args&... args) noexcept {
+                const binary_log_site& site = site_of(location, args...);
+                if (site.id == 0 || !is_enabled() || !logger::is_enabled(site.category, site.priority)) {
+                    return;
+                }
+                const std::size_t payload = (detail::binary_log_value <Args>::size(args) + ... + 0);
+                std::byte* out = begin_record(site.id, payload);
+                if (!out) {
+                    return;
+                }
+                ((out = detail::binary_log_value <Args>::write(out, args)), ...);
+                commit_record();
+            }
+
+            /**
+             * @brief Pause or resume recording at runtime
+             */
+            SDLPP_EXPORT static void set_enabled(bool enabled) noexcept;
+            [[nodiscard]] SDLPP_EXPORT static bool is_enabled() noexcept;
+
+            /**
+             * @brief Ring size, in bytes, for threads that have not logged yet
+             */
+            SDLPP_EXPORT static void set_buffer_size(std::size_t bytes) noexcept;
+
+            /**
+             * @brief Drain every thread's records into a binary log segment
+             *
+             * A segment carries the counter frequency, the registered sites
+             * and the records, so segments saved one after another into the
+             * same stream can be decoded together. Safe to call while other
+             * threads are logging.
+             */
+            SDLPP_EXPORT static void save(std::ostream& out);
+
+            /**
+             * @brief Drain every thread's records and write them as text
+             */
+            SDLPP_EXPORT static void write_text(std::ostream& out);
+
+            /**
+             * @brief Discard every recorded message
+             */
+            SDLPP_EXPORT static void clear();
+
+            /**
+             * @brief Records lost to full buffers since startup
+             */
+            [[nodiscard]] SDLPP_EXPORT static std::uint64_t dropped_records();
+
+        private:
+            SDLPP_EXPORT static std::uint32_t register_site(const binary_log_site& site) noexcept;
+            SDLPP_EXPORT static std::byte* begin_record(std::uint32_t site, std::size_t payload) noexcept;
+            SDLPP_EXPORT static void commit_record() noexcept;
+    };
+
+    /**
+     * @brief Decoder for logs written by binary_log::save()
+     */
+    class binary_log_reader {
+        public:
+            /**
+             * @brief Call site as stored in the log
+             */
+            struct site {
+                std::uint32_t id = 0;
+                int category = 0;
+                log_priority priority = log_priority::info;
+                std::uint32_t line = 0;
+                std::string file;
+                std::string function;
+                std::string format;
+                std::vector <binary_log_arg> args;
+            };
+
+            /**
+             * @brief One decoded record; the message is formatted on demand
+             */
+            struct record {
+                std::uint64_t timestamp_ns;  ///< Performance counter time
+                std::uint32_t thread;        ///< Recording thread, numbered from 1
+                std::uint32_t site;
+                std::size_t offset;          ///< Argument bytes in the reader's payload storage
+                std::size_t size;
+            };
+
+            /**
+             * @brief Read every segment in a stream
+             * @return The decoded log, or an error for malformed input
+             */
+            [[nodiscard]] SDLPP_EXPORT static expected <binary_log_reader, std::string> read(std::istream& in);
+
+            /**
+             * @brief Records of all threads, ordered by timestamp
+             */
+            [[nodiscard]] const std::vector <record>& records() const noexcept {
+                return records_;
+            }
+
+            /**
+             * @brief Look up a call site by id
+             * @return nullptr if the log does not describe the site
+             */
+            [[nodiscard]] SDLPP_EXPORT const site* find_site(std::uint32_t id) const noexcept;
+
+            /**
+             * @brief Substitute a record's arguments into its format string
+             */
+            [[nodiscard]] SDLPP_EXPORT std::string format(const record& r) const;
+
+            /**
+             * @brief Write every record as "[seconds] [T<thread>] [file:line] message"
+             */
+            SDLPP_EXPORT void write_text(std::ostream& out) const;
+
+        private:
+            void append_message(std::string& text, const record& r) const;
+
+            std::vector <site> sites_;  // Indexed by id
+            std::vector <record> records_;
+            std::vector <std::byte> payload_;
+    };
+} // namespace sdlpp
+
+/**
+ * @brief Record a binary log message
+ *
+ * Category and priority must be constants: they are stored with the call
+ * site. Calls below SDLPP_LOG_MIN_PRIORITY compile to nothing; the rest
+ * check the category priority before copying any argument.
+ */
+#define SDLPP_BLOG(category, priority, format, ...) \
+        SDLPP_LOG_IF_COMPILED(priority, \
+            ::sdlpp::binary_log::write( \
+                [](const std::source_location& sdlpp_blog_location, const auto&... sdlpp_blog_args) \
+                    -> const ::sdlpp::binary_log_site& { \
+                    static const ::sdlpp::binary_log_site site = ::sdlpp::binary_log::make_site < \
+                        std::remove_cvref_t <decltype(sdlpp_blog_args)>...>( \
+                        category, priority, format, sdlpp_blog_location); \
+                    return site; \
+                }, \
+                std::source_location::current() __VA_OPT__(,) __VA_ARGS__))
@@ -5,10 +5,15 @@
 #pragma once
 
 #include <sdlpp/core/sdl.hh>
+#include <sdlpp/detail/expected.hh>
+#include <sdlpp/detail/export.hh>
 
 #include <failsafe/detail/string_utils.hh>
 
+#include <cstdint>
+#include <iosfwd>
 #include <string>
+#include <string_view>
 
 namespace sdlpp {
     
@@ -162,5 +167,173 @@ namespace sdlpp {
     private:
         bool clear_on_exit_;
     };
+
+    /**
+     * @brief Broad classification of a failure
+     */
+    enum class errc : std::uint8_t {
+        sdl_error,          ///< SDL call failed; see the captured SDL text
+        invalid_handle,     ///< Operation on an empty or destroyed object
+        invalid_argument,   ///< Argument rejected before reaching SDL
+        out_of_memory,
+        unsupported,
+        not_found,
+        io_error,
+        other               ///< Free-form message (converted from a string)
+    };
+
+    /**
+     * @brief Library area an error originated from
+     */
+    enum class error_subsystem : std::uint8_t {
+        core,
+        video,
+        render,
+        audio,
+        events,
+        input,
+        io,
+        system,
+        font,
+        image,
+        app
+    };
+
+    namespace detail {
+        /**
+         * @brief Copy text into the shared error text ring
+         * @return Ticket identifying the slot, never 0
+         */
+        [[nodiscard]] SDLPP_EXPORT std::uint32_t capture_error_text(std::string_view text) noexcept;
+
+        /**
+         * @brief Copy captured text back out of the ring
+         * @return false if the slot has since been reused by a newer error
+         */
+        [[nodiscard]] SDLPP_EXPORT bool read_error_text(std::uint32_t ticket, std::string& out);
+    }
+
+    /**
+     * @brief Compact, allocation-free error value for expected results
+     *
+     * Holds an error code, the subsystem that failed, an optional static
+     * context string and, for SDL failures, a ticket for the SDL error text
+     * copied at the point of failure. The text lives in a fixed ring of
+     * recent errors, so constructing, copying and discarding an error never
+     * touches the heap; only message() builds a std::string.
+     *
+     * The ring keeps the last 256 captured texts of up to 127 bytes each.
+     * Longer texts are truncated, and an error inspected after 256 newer
+     * failures anywhere in the process reports its code and context instead.
+     *
+     * Migration: error converts implicitly to std::string, streams its
+     * message and compares against strings by message, so most callers
+     * written for expected<T, std::string> compile unchanged. Functions that
+     * still return expected<void, std::string> forward a failure with
+     * make_unexpectedf(r.error()), as tl::expected has no void-to-void
+     * converting constructor. The opposite direction is explicit: a string
+     * wrapped in an error is subject to the ring's limits, so free-form
+     * messages that must be kept belong in expected<T, std::string>.
+     *
+     * @code
+     * auto r = renderer.draw_point(x, y);
+     * if (!r && r.error().code() == sdlpp::errc::invalid_handle) {
+     *     // no allocation has happened so far
+     * }
+     * @endcode
+     */
+    class error {
+    public:
+        /**
+         * @brief Create an error without SDL text
+         * @param code Error classification
+         * @param subsystem Originating subsystem
+         * @param context Static description (string literal), may be null
+         */
+        constexpr error(errc code, error_subsystem subsystem, const char* context = nullptr) noexcept
+            : context_{context}, code_{code}, subsystem_{subsystem} {
+        }
+
+        /**
+         * @brief Capture the calling thread's current SDL error text
+         * @param subsystem Originating subsystem
+         * @param context Static description (string literal), may be null
+         */
+        [[nodiscard]] static error from_sdl(error_subsystem subsystem, const char* context = nullptr) noexcept {
+            error e{errc::sdl_error, subsystem, context};
+            const char* text = SDL_GetError();
+            e.text_ = detail::capture_error_text(text ? std::string_view{text} : std::string_view{});
+            return e;
+        }
+
+        /**
+         * @brief Wrap a free-form message (migration from string errors)
+         *
+         * The message is the error's only payload and is kept in the text
+         * ring: truncated to 127 bytes, and gone after 256 newer failures.
+         */
+        explicit error(std::string_view message) noexcept
+            : text_{detail::capture_error_text(message)},
+              code_{errc::other}, subsystem_{error_subsystem::core} {
+        }
+
+        explicit error(const char* message) noexcept
+            : error{std::string_view{message ? message : ""}} {
+        }
+
+        explicit error(const std::string& message) noexcept
+            : error{std::string_view{message}} {
+        }
+
+        [[nodiscard]] constexpr errc code() const noexcept { return code_; }
+        [[nodiscard]] constexpr error_subsystem subsystem() const noexcept { return subsystem_; }
+
+        /**
+         * @brief Static context given at construction, or nullptr
+         */
+        [[nodiscard]] constexpr const char* context() const noexcept { return context_; }
+
+        /**
+         * @brief Human-readable message
+         *
+         * "context: SDL text", or whichever of the two is present. Errors
+         * with neither describe their code.
+         */
+        [[nodiscard]] SDLPP_EXPORT std::string message() const;
+
+        operator std::string() const {
+            return message();
+        }
+
+        friend bool operator==(const error& e, std::string_view text) {
+            return e.message() == text;
+        }
+
+    private:
+        const char* context_ = nullptr;
+        std::uint32_t text_ = 0;
+        errc code_;
+        error_subsystem subsystem_;
+    };
+
+    static_assert(sizeof(error) <= 16);
+
+    SDLPP_EXPORT std::ostream& operator<<(std::ostream& os, const error& e);
+
+    /**
+     * @brief Failure carrying the current SDL error text
+     */
+    [[nodiscard]] inline unexpected <error> make_sdl_error(error_subsystem subsystem,
+                                                          const char* context = nullptr) noexcept {
+        return unexpected <error>(error::from_sdl(subsystem, context));
+    }
+
+    /**
+     * @brief Failure detected by sdlpp itself, without SDL text
+     */
+    [[nodiscard]] constexpr unexpected <error> make_error(errc code, error_subsystem subsystem,
+                                                         const char* context = nullptr) noexcept {
+        return unexpected <error>(error{code, subsystem, context});
+    }
     
 } // namespace sdlpp
\ No newline at end of file
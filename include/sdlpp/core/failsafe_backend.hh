@@ -147,7 +147,6 @@ namespace sdlpp {
                 return failsafe_backend();
             }
 
-        private:
             /**
              * @brief Convert failsafe log level to SDL++ log priority
              * @param level Failsafe log level
@@ -180,6 +179,7 @@ namespace sdlpp {
                 }
             }
 
+        private:
             /**
              * @brief Get SDL category for a failsafe category
              * @param category Failsafe category name
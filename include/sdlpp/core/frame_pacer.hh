@@ -0,0 +1,154 @@
+#pragma once
+
+/**
+ * @file frame_pacer.hh
+ * @brief Deadline-based frame pacing with hybrid sleep/spin waiting
+ *
+ * Sleeping for "target minus elapsed" each frame accumulates error: every
+ * oversleep from OS timer slack pushes all later frames back, and the
+ * oversleep itself is typically 1-2 ms. frame_pacer instead schedules
+ * frames against absolute deadlines (start + n * period) and waits in two
+ * stages:
+ *
+ * - a coarse sleep that ends a safety margin before the deadline
+ * - a short spin (yielding) until the deadline itself
+ *
+ * The safety margin adapts to the observed oversleep of the coarse sleep,
+ * so on systems with precise timers the pacer spins very little and on
+ * systems with coarse timers it still hits the deadline.
+ *
+ * Frame times (interval between consecutive wait() returns) are kept in a
+ * fixed window for percentile statistics.
+ *
+ * @code
+ * sdlpp::frame_pacer pacer(120.0);
+ * while (running) {
+ *     update();
+ *     render();
+ *     pacer.wait();
+ * }
+ * auto stats = pacer.statistics();
+ * SDL_Log("p99 %.2f ms, missed %llu", stats.p99.count() / 1e6, stats.missed_deadlines);
+ * @endcode
+ */
+
+#include <sdlpp/core/sdl.hh>
+#include <sdlpp/detail/export.hh>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sdlpp {
+    /**
+     * @brief Frame time statistics over the pacer's sample window
+     */
+    struct frame_pacing_stats {
+        std::chrono::nanoseconds p50{0};   ///< Median frame time
+        std::chrono::nanoseconds p95{0};
+        std::chrono::nanoseconds p99{0};
+        std::chrono::nanoseconds min{0};
+        std::chrono::nanoseconds max{0};
+        std::chrono::nanoseconds mean{0};
+        std::size_t samples = 0;           ///< Frames in the window
+        std::uint64_t frames = 0;          ///< Frames paced since the last reset
+        std::uint64_t missed_deadlines = 0;  ///< Frames that started after their deadline
+    };
+
+    /**
+     * @brief Paces a loop to a fixed period using absolute deadlines
+     */
+    class frame_pacer {
+        public:
+            static constexpr std::size_t default_window = 240;
+
+            /**
+             * @brief Create a pacer for a target rate
+             * @param target_fps Frames per second (<= 0 disables waiting)
+             * @param window Number of recent frame times kept for statistics
+             */
+            SDLPP_EXPORT explicit frame_pacer(double target_fps, std::size_t window = default_window);
+
+            /**
+             * @brief Create a pacer for a target period
+             * @param period Frame period (zero disables waiting)
+             * @param window Number of recent frame times kept for statistics
+             */
+            SDLPP_EXPORT explicit frame_pacer(std::chrono::nanoseconds period, std::size_t window = default_window);
+
+            /**
+             * @brief Wait for the next frame deadline
+             *
+             * If the deadline has already passed the frame counts as missed
+             * and the schedule restarts from now instead of bursting to
+             * catch up.
+             *
+             * @return Time since the previous wait() returned
+             */
+            SDLPP_EXPORT std::chrono::nanoseconds wait();
+
+            /**
+             * @brief Change the target rate; the schedule restarts at the next wait()
+             */
+            SDLPP_EXPORT void set_target_fps(double target_fps) noexcept;
+
+            /**
+             * @brief Change the target period; the schedule restarts at the next wait()
+             */
+            SDLPP_EXPORT void set_period(std::chrono::nanoseconds period) noexcept;
+
+            [[nodiscard]] std::chrono::nanoseconds period() const noexcept {
+                return std::chrono::nanoseconds(static_cast <std::int64_t>(period_ns_));
+            }
+
+            /**
+             * @brief Restart the schedule from the next wait() (e.g. after a pause)
+             *
+             * The next frame is not sampled: wait() returns zero for it instead
+             * of the time spent paused.
+             */
+            void reset() noexcept {
+                started_ = false;
+                last_return_ns_ = 0;
+            }
+
+            /**
+             * @brief Current spin margin before each deadline
+             */
+            [[nodiscard]] std::chrono::nanoseconds spin_margin() const noexcept {
+                return std::chrono::nanoseconds(static_cast <std::int64_t>(margin_ns_));
+            }
+
+            /**
+             * @brief Frame time percentiles and deadline counters
+             */
+            [[nodiscard]] SDLPP_EXPORT frame_pacing_stats statistics() const;
+
+            [[nodiscard]] std::uint64_t missed_deadlines() const noexcept { return missed_; }
+
+            /**
+             * @brief Clear the frame time window and counters
+             */
+            SDLPP_EXPORT void reset_statistics() noexcept;
+
+        private:
+            void sleep_until(Uint64 deadline_ns) noexcept;
+            void record(Uint64 frame_ns) noexcept;
+
+            Uint64 period_ns_ = 0;
+            Uint64 deadline_ns_ = 0;
+            Uint64 last_return_ns_ = 0;
+            bool started_ = false;
+
+            // Adaptive spin margin: decaying maximum of observed oversleep
+            Uint64 margin_ns_;
+            double oversleep_estimate_ns_;
+
+            std::vector <Uint64> samples_;
+            std::size_t next_sample_ = 0;
+            std::size_t sample_count_ = 0;
+            std::uint64_t frames_ = 0;
+            std::uint64_t missed_ = 0;
+    };
+} // namespace sdlpp
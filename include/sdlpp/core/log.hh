@@ -15,14 +15,33 @@
 #include <sdlpp/core/sdl.hh>
 #include <sdlpp/detail/export.hh>
 #include <failsafe/detail/string_utils.hh>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <functional>
 #include <memory>
 #include <source_location>
 #include <iostream>
 #include <utility>
 
+/**
+ * @brief Lowest priority compiled into the SDLPP_LOG_* macros
+ *
+ * Calls below it are removed entirely, arguments included. Define it to an
+ * SDL_LogPriority value, e.g. -DSDLPP_LOG_MIN_PRIORITY=SDL_LOG_PRIORITY_INFO
+ * for builds that should not carry trace/verbose/debug logging at all.
+ * Use the same value for every translation unit of a program.
+ */
+#ifndef SDLPP_LOG_MIN_PRIORITY
+#define SDLPP_LOG_MIN_PRIORITY SDL_LOG_PRIORITY_TRACE
+#endif
+
 namespace sdlpp {
     /**
      * @brief Log priority levels
@@ -69,6 +88,195 @@ namespace sdlpp {
         return static_cast <int>(category);
     }
 
+    /**
+     * @brief Compile-time minimum priority (see SDLPP_LOG_MIN_PRIORITY)
+     */
+    inline constexpr log_priority log_min_priority = static_cast <log_priority>(SDLPP_LOG_MIN_PRIORITY);
+
+    namespace detail {
+        /**
+         * @brief SDL_GetLogPriority() for a category, from a cache kept
+         *        current by log_config
+         *
+         * The cache lives in the library, so the application and sdlpp's
+         * own log sites see the same priorities in shared builds.
+         */
+        [[nodiscard]] SDLPP_EXPORT int effective_log_priority(int category) noexcept;
+
+        /**
+         * @brief Update one category's cached priority
+         */
+        SDLPP_EXPORT void store_log_priority(int category, int priority) noexcept;
+
+        /**
+         * @brief Update every cached priority; SDL_LOG_PRIORITY_INVALID
+         *        makes the next lookup ask SDL again
+         */
+        SDLPP_EXPORT void store_log_priorities(int priority) noexcept;
+
+        inline int log_category_value(int category) noexcept {
+            return category;
+        }
+
+        inline int log_category_value(log_category category) noexcept {
+            return to_sdl_category(category);
+        }
+
+        /**
+         * @brief " (suppressed 4,312 <noun>s)"
+         */
+        inline std::string suppressed_note(std::uint64_t count, std::string_view noun) {
+            char digits[24];
+            const auto result = std::to_chars(digits, digits + sizeof(digits), count);
+            const auto length = static_cast <std::size_t>(result.ptr - digits);
+
+            std::string note = " (suppressed ";
+            for (std::size_t i = 0; i < length; ++i) {
+                if (i > 0 && (length - i) % 3 == 0) {
+                    note.push_back(',');
+                }
+                note.push_back(digits[i]);
+            }
+            note.push_back(' ');
+            note.append(noun);
+            note.append(count == 1 ? ")" : "s)");
+            return note;
+        }
+
+        /**
+         * @brief Lock-free state of one rate-limited or deduplicated log site
+         *
+         * The SDLPP_LOG_EVERY_N / _EVERY_MS / _FIRST_N / _DEDUP macros keep
+         * one static instance per call site. Under contention the counts
+         * are exact but which thread's message gets through is not.
+         */
+        class log_site_limit {
+            public:
+                /**
+                 * @brief Allow the first n calls
+                 */
+                bool first_n(std::uint64_t n) noexcept {
+                    return count_.fetch_add(1, std::memory_order_relaxed) < n;
+                }
+
+                /**
+                 * @brief Allow calls 1, n + 1, 2n + 1, ...
+                 */
+                bool every_n(std::uint64_t n) noexcept {
+                    if (count_.fetch_add(1, std::memory_order_relaxed) % (n > 0 ? n : 1) == 0) {
+                        return true;
+                    }
+                    suppressed_.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+
+                /**
+                 * @brief Allow at most one call per interval
+                 */
+                bool every_ms(std::int64_t interval_ms) noexcept {
+                    const auto now = now_ms();
+                    auto last = last_ms_.load(std::memory_order_relaxed);
+                    if ((last == never || now - last >= interval_ms) &&
+                        last_ms_.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+                        return true;
+                    }
+                    suppressed_.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+
+                /**
+                 * @brief Suppress a message identical to the previous one from
+                 *        this site, letting a repeat through once per interval
+                 * @param hash Hash of the formatted message
+                 * @param interval_ms Minimum time between repeats that are output
+                 * @param repeated Set to true if this message is a repeat
+                 * @return true if the message should be output
+                 */
+                bool deduplicate(std::size_t hash, std::int64_t interval_ms, bool& repeated) noexcept {
+                    const auto now = now_ms();
+                    repeated = last_hash_.exchange(hash, std::memory_order_relaxed) == hash;
+                    if (!repeated) {
+                        last_ms_.store(now, std::memory_order_relaxed);
+                        return true;
+                    }
+                    return every_ms(interval_ms);
+                }
+
+                /**
+                 * @brief Calls suppressed since the last call to this function
+                 */
+                std::uint64_t take_suppressed() noexcept {
+                    return suppressed_.exchange(0, std::memory_order_relaxed);
+                }
+
+            private:
+                static constexpr std::int64_t never = std::numeric_limits <std::int64_t>::min();
+
+                static std::int64_t now_ms() noexcept {
+                    return std::chrono::duration_cast <std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count();
+                }
+
+                std::atomic <std::uint64_t> count_{0};
+                std::atomic <std::uint64_t> suppressed_{0};
+                std::atomic <std::int64_t> last_ms_{never};
+                std::atomic <std::size_t> last_hash_{0};
+        };
+
+        /**
+         * @brief Per-thread line buffer for formatted log messages
+         *
+         * Lines up to inline_capacity bytes are built in place; longer ones
+         * spill into a string whose capacity is kept for the next line.
+         */
+        class log_line_buffer {
+            public:
+                void clear() noexcept {
+                    size_ = 0;
+                    spilled_ = false;
+                    overflow_.clear();
+                }
+
+                void append(std::string_view text) {
+                    if (text.empty()) {
+                        return;
+                    }
+                    if (!spilled_ && size_ + text.size() < inline_capacity) {
+                        std::memcpy(inline_ + size_, text.data(), text.size());
+                        size_ += text.size();
+                        return;
+                    }
+                    if (!spilled_) {
+                        overflow_.assign(inline_, size_);
+                        spilled_ = true;
+                    }
+                    overflow_.append(text);
+                }
+
+                void append(unsigned value) {
+                    char digits[16];
+                    const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+                    append(std::string_view(digits, static_cast <std::size_t>(result.ptr - digits)));
+                }
+
+                [[nodiscard]] const char* c_str() noexcept {
+                    if (spilled_) {
+                        return overflow_.c_str();
+                    }
+                    inline_[size_] = '\0';
+                    return inline_;
+                }
+
+            private:
+                static constexpr std::size_t inline_capacity = 1024;
+
+                char inline_[inline_capacity];
+                std::size_t size_ = 0;
+                bool spilled_ = false;
+                std::string overflow_;
+        };
+    } // namespace detail
+
     // Note: string building utilities (append_to_stream, build_message) are now in detail/string_utils.hh
     // They provide enhanced type support including filesystem::path, chrono, optional, variant
 
@@ -109,48 +317,57 @@ namespace sdlpp {
      */
     class logger {
         private:
-            struct log_context {
-                int category;
-                log_priority priority;
-                std::source_location location;
-
-                log_context(int cat, log_priority prio, std::source_location loc)
-                    : category(cat), priority(prio), location(loc) {
-                }
-            };
-
             /**
-             * @brief Format source location for logging
+             * @brief Format the source location and message and hand them to SDL
              */
-            static std::string format_location(const std::source_location& loc) {
-                std::ostringstream oss;
-                oss << "[" << loc.file_name() << ":" << loc.line()
-                    << " " << loc.function_name() << "] ";
-                return oss.str();
+            static void log_internal(int category, log_priority priority,
+                                     const std::source_location& loc, std::string_view message,
+                                     std::string_view note = {}) {
+                thread_local detail::log_line_buffer line;
+                line.clear();
+                line.append("[");
+                line.append(loc.file_name());
+                line.append(":");
+                line.append(static_cast <unsigned>(loc.line()));
+                line.append(" ");
+                line.append(loc.function_name());
+                line.append("] ");
+                line.append(message);
+                line.append(note);
+                SDL_LogMessage(category, to_sdl_priority(priority), "%s", line.c_str());
             }
 
+        public:
             /**
-             * @brief Internal logging function
+             * @brief Check whether a message would be output
+             *
+             * Uses the cached category priority, so it costs one library call and an atomic load.
              */
-            static void log_internal(const log_context& ctx, const std::string& message) {
-                std::string full_message = format_location(ctx.location) + message;
-                SDL_LogMessage(ctx.category, to_sdl_priority(ctx.priority), "%s", full_message.c_str());
+            [[nodiscard]] static bool is_enabled(int category, log_priority priority) noexcept {
+                return priority >= log_min_priority &&
+                       static_cast <int>(priority) >= detail::effective_log_priority(category);
+            }
+
+            [[nodiscard]] static bool is_enabled(log_category category, log_priority priority) noexcept {
+                return is_enabled(to_sdl_category(category), priority);
             }
 
-        public:
             /**
              * @brief Log with specific category and priority
              * @param category Log category
              * @param priority Log priority
              * @param args Message components to concatenate
              * @param loc Source location (automatically captured)
+             * @note Nothing is formatted if the priority is disabled
              */
             template<typename... Args>
             static void log(int category, log_priority priority,
                             const std::source_location& loc, Args&&... args) {
-                log_context ctx(category, priority, loc);
-                std::string message = failsafe::detail::build_message(std::forward <Args>(args)...);
-                log_internal(ctx, message);
+                if (!is_enabled(category, priority)) {
+                    return;
+                }
+                log_internal(category, priority, loc,
+                             failsafe::detail::build_message(std::forward <Args>(args)...));
             }
 
             /**
@@ -162,6 +379,53 @@ namespace sdlpp {
                 log(to_sdl_category(category), priority, loc, std::forward <Args>(args)...);
             }
 
+            /**
+             * @brief Log a message that a rate-limited site let through
+             *
+             * Used by SDLPP_LOG_EVERY_N and SDLPP_LOG_EVERY_MS; the number
+             * of messages the site dropped since its last output is appended.
+             */
+            template<typename... Args>
+            static void log_limited(detail::log_site_limit& site, int category, log_priority priority,
+                                    const std::source_location& loc, Args&&... args) {
+                const auto suppressed = site.take_suppressed();
+                log_internal(category, priority, loc,
+                             failsafe::detail::build_message(std::forward <Args>(args)...),
+                             suppressed > 0 ? detail::suppressed_note(suppressed, "similar message") : std::string());
+            }
+
+            /**
+             * @brief Log unless the message repeats the site's previous one
+             *
+             * Repeats are counted instead of output; one gets through per
+             * interval carrying the count, and a count still pending when the
+             * message changes is output before the new message. Used by
+             * SDLPP_LOG_DEDUP.
+             *
+             * @note The message is formatted (to compare it) whenever the
+             *       priority is enabled; only the output is saved.
+             */
+            template<typename... Args>
+            static void log_deduplicated(detail::log_site_limit& site, std::int64_t interval_ms,
+                                         int category, log_priority priority,
+                                         const std::source_location& loc, Args&&... args) {
+                const std::string message = failsafe::detail::build_message(std::forward <Args>(args)...);
+                bool repeated = false;
+                if (!site.deduplicate(std::hash <std::string_view>{}(message), interval_ms, repeated)) {
+                    return;
+                }
+                const auto suppressed = site.take_suppressed();
+                if (suppressed == 0) {
+                    log_internal(category, priority, loc, message);
+                } else if (repeated) {
+                    log_internal(category, priority, loc, message, detail::suppressed_note(suppressed, "duplicate"));
+                } else {
+                    log_internal(category, priority, loc, "previous message repeated",
+                                 detail::suppressed_note(suppressed, "duplicate"));
+                    log_internal(category, priority, loc, message);
+                }
+            }
+
             // Convenience methods for each priority level
 
             template<typename... Args>
@@ -267,6 +531,7 @@ namespace sdlpp {
              */
             static void set_all_priorities(log_priority priority) {
                 SDL_SetLogPriorities(to_sdl_priority(priority));
+                detail::store_log_priorities(static_cast <int>(priority));
             }
 
             /**
@@ -274,13 +539,14 @@ namespace sdlpp {
              */
             static void set_priority(int category, log_priority priority) {
                 SDL_SetLogPriority(category, to_sdl_priority(priority));
+                detail::store_log_priority(category, static_cast <int>(priority));
             }
 
             /**
              * @brief Set priority for a specific category
              */
             static void set_priority(log_category category, log_priority priority) {
-                SDL_SetLogPriority(to_sdl_category(category), to_sdl_priority(priority));
+                set_priority(to_sdl_category(category), priority);
             }
 
             /**
@@ -302,6 +568,18 @@ namespace sdlpp {
              */
             static void reset_priorities() {
                 SDL_ResetLogPriorities();
+                refresh_priorities();
+            }
+
+            /**
+             * @brief Drop the cached priorities so they are read from SDL again
+             *
+             * The setters above keep the cache current; call this after
+             * changing priorities through SDL directly (SDL_SetLogPriority,
+             * the SDL_HINT_LOGGING hint).
+             */
+            static void refresh_priorities() noexcept {
+                detail::store_log_priorities(SDL_LOG_PRIORITY_INVALID);
             }
 
             /**
@@ -361,43 +639,112 @@ namespace sdlpp {
      * @brief Convenience macros for logging with automatic source location
      *
      * These macros automatically capture the source location at the call site.
+     * Fixed-priority macros below SDLPP_LOG_MIN_PRIORITY compile to nothing;
+     * the rest check the category priority before evaluating any formatting.
      */
+#define SDLPP_LOG_IF_COMPILED(priority, ...) \
+        do { if constexpr ((priority) >= ::sdlpp::log_min_priority) { __VA_ARGS__; } } while (false)
+
 #define SDLPP_LOG(category, priority, ...) \
         ::sdlpp::logger::log(category, priority, std::source_location::current(), __VA_ARGS__)
 
 #define SDLPP_LOG_TRACE(category, ...) \
-        ::sdlpp::logger::trace(category, std::source_location::current(), __VA_ARGS__)
+        SDLPP_LOG_IF_COMPILED(::sdlpp::log_priority::trace, \
+            ::sdlpp::logger::trace(category, std::source_location::current(), __VA_ARGS__))
 
 #define SDLPP_LOG_VERBOSE(category, ...) \
-        ::sdlpp::logger::verbose(category, std::source_location::current(), __VA_ARGS__)
+        SDLPP_LOG_IF_COMPILED(::sdlpp::log_priority::verbose, \
+            ::sdlpp::logger::verbose(category, std::source_location::current(), __VA_ARGS__))
 
 #define SDLPP_LOG_DEBUG(category, ...) \
-        ::sdlpp::logger::debug(category, std::source_location::current(), __VA_ARGS__)
+        SDLPP_LOG_IF_COMPILED(::sdlpp::log_priority::debug, \
+            ::sdlpp::logger::debug(category, std::source_location::current(), __VA_ARGS__))
 
 #define SDLPP_LOG_INFO(category, ...) \
-        ::sdlpp::logger::info(category, std::source_location::current(), __VA_ARGS__)
+        SDLPP_LOG_IF_COMPILED(::sdlpp::log_priority::info, \
+            ::sdlpp::logger::info(category, std::source_location::current(), __VA_ARGS__))
 
 #define SDLPP_LOG_WARN(category, ...) \
-        ::sdlpp::logger::warn(category, std::source_location::current(), __VA_ARGS__)
+        SDLPP_LOG_IF_COMPILED(::sdlpp::log_priority::warn, \
+            ::sdlpp::logger::warn(category, std::source_location::current(), __VA_ARGS__))
 
 #define SDLPP_LOG_ERROR(category, ...) \
-        ::sdlpp::logger::error(category, std::source_location::current(), __VA_ARGS__)
+        SDLPP_LOG_IF_COMPILED(::sdlpp::log_priority::error, \
+            ::sdlpp::logger::error(category, std::source_location::current(), __VA_ARGS__))
 
 #define SDLPP_LOG_CRITICAL(category, ...) \
-        ::sdlpp::logger::critical(category, std::source_location::current(), __VA_ARGS__)
+        SDLPP_LOG_IF_COMPILED(::sdlpp::log_priority::critical, \
+            ::sdlpp::logger::critical(category, std::source_location::current(), __VA_ARGS__))
+
+    /**
+     * @brief Rate-limited and deduplicated logging for hot error paths
+     *
+     * Each expansion keeps its own lock-free counters, so a failing call in
+     * the frame loop cannot flood the output:
+     *
+     * @code
+     * if (!renderer.copy(tex, src, dst)) {
+     *     SDLPP_LOG_EVERY_MS(log_category::render, log_priority::warn, 1000,
+     *                        "copy failed:", get_error());
+     * }
+     * @endcode
+     *
+     * - SDLPP_LOG_EVERY_N logs the 1st, (n+1)th, (2n+1)th... call
+     * - SDLPP_LOG_EVERY_MS logs at most once per interval
+     * - SDLPP_LOG_FIRST_N logs the first n calls only
+     * - SDLPP_LOG_DEDUP logs unless the text repeats the previous message,
+     *   letting one repeat per second through
+     *
+     * Output messages end with "(suppressed N similar messages)" or
+     * "(suppressed N duplicates)" when the site dropped messages since it
+     * last logged. Suppressed calls do not format their arguments, except
+     * for SDLPP_LOG_DEDUP, which has to compare the text.
+     *
+     * The priority must be a constant: sites below SDLPP_LOG_MIN_PRIORITY
+     * compile to nothing, their counters included.
+     */
+#define SDLPP_LOG_EVERY_N(category, priority, n, ...) \
+        SDLPP_LOG_LIMITED_IMPL(every_n(n), category, priority, __VA_ARGS__)
+
+#define SDLPP_LOG_EVERY_MS(category, priority, interval_ms, ...) \
+        SDLPP_LOG_LIMITED_IMPL(every_ms(interval_ms), category, priority, __VA_ARGS__)
+
+#define SDLPP_LOG_FIRST_N(category, priority, n, ...) \
+        SDLPP_LOG_LIMITED_IMPL(first_n(n), category, priority, __VA_ARGS__)
+
+#define SDLPP_LOG_DEDUP(category, priority, ...) \
+        SDLPP_LOG_IF_COMPILED(priority, \
+            static ::sdlpp::detail::log_site_limit sdlpp_log_site; \
+            if (::sdlpp::logger::is_enabled(category, priority)) { \
+                ::sdlpp::logger::log_deduplicated(sdlpp_log_site, 1000, \
+                    ::sdlpp::detail::log_category_value(category), priority, \
+                    std::source_location::current(), __VA_ARGS__); \
+            })
+
+#define SDLPP_LOG_LIMITED_IMPL(check, category, priority, ...) \
+        SDLPP_LOG_IF_COMPILED(priority, \
+            static ::sdlpp::detail::log_site_limit sdlpp_log_site; \
+            if (::sdlpp::logger::is_enabled(category, priority) && sdlpp_log_site.check) { \
+                ::sdlpp::logger::log_limited(sdlpp_log_site, ::sdlpp::detail::log_category_value(category), \
+                    priority, std::source_location::current(), __VA_ARGS__); \
+            })
 
     // Application category shortcuts
 #define SDLPP_LOG_APP(...) \
-        ::sdlpp::logger::app_info(std::source_location::current() __VA_OPT__(,) __VA_ARGS__)
+        SDLPP_LOG_IF_COMPILED(::sdlpp::log_priority::info, \
+            ::sdlpp::logger::app_info(std::source_location::current() __VA_OPT__(,) __VA_ARGS__))
 
 #define SDLPP_LOG_APP_DEBUG(...) \
-        ::sdlpp::logger::app_debug(std::source_location::current(), __VA_ARGS__)
+        SDLPP_LOG_IF_COMPILED(::sdlpp::log_priority::debug, \
+            ::sdlpp::logger::app_debug(std::source_location::current(), __VA_ARGS__))
 
 #define SDLPP_LOG_APP_WARN(...) \
-        ::sdlpp::logger::app_warn(std::source_location::current(), __VA_ARGS__)
+        SDLPP_LOG_IF_COMPILED(::sdlpp::log_priority::warn, \
+            ::sdlpp::logger::app_warn(std::source_location::current(), __VA_ARGS__))
 
 #define SDLPP_LOG_APP_ERROR(...) \
-        ::sdlpp::logger::app_error(std::source_location::current(), __VA_ARGS__)
+        SDLPP_LOG_IF_COMPILED(::sdlpp::log_priority::error, \
+            ::sdlpp::logger::app_error(std::source_location::current(), __VA_ARGS__))
 } // namespace sdlpp
 
 
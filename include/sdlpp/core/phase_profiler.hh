@@ -0,0 +1,171 @@
+#pragma once
+
+/**
+ * @file phase_profiler.hh
+ * @brief Hierarchical phase timing for startup and other one-off sequences
+ *
+ * phase_profiler records nested, named phases measured with
+ * timer::performance_counter. Every scope is kept as a raw span (for
+ * Chrome's trace viewer) and is also folded into a tree where repeated
+ * phases with the same name under the same parent are merged, which is
+ * what the text report prints:
+ *
+ * @code
+ * startup                                   total   142.310 ms
+ *   sdl_init                               18.204 ms   12.8%
+ *   window                                 61.877 ms   43.5%
+ *   on_ready                               52.010 ms   36.5%
+ *     fonts                                31.442 ms   22.1%  x3
+ * @endcode
+ *
+ * game_application times its own initialization in the profiler returned
+ * by startup_profile(); applications add their own phases to it:
+ *
+ * @code
+ * void on_ready() override {
+ *     auto fonts = startup_profile().begin("fonts");
+ *     load_fonts();
+ * }
+ * @endcode
+ *
+ * @note Scopes must be opened and closed on one thread, innermost first.
+ */
+
+#include <sdlpp/core/timer.hh>
+#include <sdlpp/detail/export.hh>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace sdlpp {
+    /**
+     * @brief Aggregated timing of one node in the phase tree
+     */
+    struct phase_stats {
+        std::string name;
+        std::size_t depth = 0;                  ///< 0 for top-level phases
+        std::uint32_t count = 0;                ///< Number of scopes merged into this node
+        std::chrono::nanoseconds total{0};      ///< Sum of scope durations
+        std::chrono::nanoseconds self{0};       ///< total minus time in child phases
+        std::chrono::nanoseconds first_start{0};  ///< Offset of the first scope from the profiler origin
+    };
+
+    /**
+     * @brief Records nested named phases
+     */
+    class phase_profiler {
+        public:
+            /**
+             * @brief RAII scope ending its phase on destruction
+             */
+            class scope {
+                public:
+                    scope(const scope&) = delete;
+                    scope& operator=(const scope&) = delete;
+
+                    scope(scope&& other) noexcept
+                        : owner_(other.owner_), index_(other.index_), counter_(other.counter_) {
+                        other.owner_ = nullptr;
+                    }
+
+                    scope& operator=(scope&&) = delete;
+
+                    ~scope() { end(); }
+
+                    /**
+                     * @brief End the phase before the scope is destroyed
+                     */
+                    void end() noexcept {
+                        if (owner_) {
+                            owner_->end_phase(index_, counter_.elapsed());
+                            owner_ = nullptr;
+                        }
+                    }
+
+                private:
+                    friend class phase_profiler;
+
+                    scope(phase_profiler* owner, std::size_t index)
+                        : owner_(owner), index_(index) {
+                    }
+
+                    phase_profiler* owner_;
+                    std::size_t index_;
+                    timer::performance_counter counter_;
+            };
+
+            /**
+             * @brief Create a profiler whose origin is now
+             * @param name Label of the root in reports and traces
+             */
+            SDLPP_EXPORT explicit phase_profiler(std::string name = "startup");
+
+            /**
+             * @brief Open a phase nested in the innermost open phase
+             */
+            [[nodiscard]] SDLPP_EXPORT scope begin(std::string_view name);
+
+            /**
+             * @brief Time a callable as one phase
+             */
+            template<typename F>
+            decltype(auto) measure(std::string_view name, F&& fn) {
+                auto s = begin(name);
+                return std::forward <F>(fn)();
+            }
+
+            /**
+             * @brief Phase tree in depth-first order, children by first start
+             */
+            [[nodiscard]] SDLPP_EXPORT std::vector <phase_stats> phases() const;
+
+            /**
+             * @brief Sum of the top-level phases
+             */
+            [[nodiscard]] SDLPP_EXPORT std::chrono::nanoseconds total() const;
+
+            /**
+             * @brief Indented text report of the phase tree
+             */
+            [[nodiscard]] SDLPP_EXPORT std::string report() const;
+
+            /**
+             * @brief Every recorded scope in Chrome trace event format
+             *
+             * The result can be loaded in chrome://tracing or ui.perfetto.dev.
+             * Phases still open are omitted.
+             */
+            [[nodiscard]] SDLPP_EXPORT std::string chrome_trace() const;
+
+            [[nodiscard]] const std::string& name() const noexcept { return name_; }
+
+            /**
+             * @brief Drop all recorded phases and restart the origin
+             * @note Phases still open are discarded when they end
+             */
+            SDLPP_EXPORT void clear();
+
+        private:
+            static constexpr std::size_t no_parent = static_cast <std::size_t>(-1);
+
+            struct span {
+                std::string name;
+                std::size_t parent;
+                std::chrono::nanoseconds start;
+                std::chrono::nanoseconds duration{-1};  // Negative while open
+            };
+
+            SDLPP_EXPORT void end_phase(std::size_t index, std::chrono::nanoseconds duration) noexcept;
+
+            std::string name_;
+            timer::performance_counter origin_;
+            std::vector <span> spans_;
+            std::vector <std::size_t> open_;
+            std::size_t index_base_ = 0;  // Index of spans_[0]; scopes from before clear() fall below it
+    };
+} // namespace sdlpp
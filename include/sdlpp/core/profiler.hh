@@ -0,0 +1,167 @@
+#pragma once
+
+/**
+ * @file profiler.hh
+ * @brief Scoped profiling zones with per-thread buffers and Chrome trace export
+ *
+ * Mark code with SDLPP_PROFILE_ZONE and frame boundaries with
+ * SDLPP_PROFILE_FRAME; export the recorded timeline with
+ * profiler::write_chrome_trace() and open it in ui.perfetto.dev or
+ * chrome://tracing.
+ *
+ * @code
+ * void world::update(float dt) {
+ *     SDLPP_PROFILE_ZONE("world::update");
+ *     {
+ *         SDLPP_PROFILE_ZONE("physics");
+ *         physics_.step(dt);
+ *     }
+ *     ai_.think(dt);
+ * }
+ *
+ * // Once per frame
+ * SDLPP_PROFILE_FRAME();
+ *
+ * // On a hotkey
+ * std::ofstream out("frame.json");
+ * sdlpp::profiler::write_chrome_trace(out);
+ * @endcode
+ *
+ * Each thread records into its own fixed-size ring buffer: a zone costs two
+ * clock reads and one uncontended store, and recording never locks. When a
+ * ring is full, new events are dropped and counted until the next export
+ * drains it. Once a thread has exited, the first export (or clear()) that
+ * drains its ring also frees it, so thread churn does not accumulate rings.
+ *
+ * Profiling is compiled in only when SDLPP_PROFILING is non-zero (CMake
+ * option SDLPP_ENABLE_PROFILING). Otherwise the macros expand to nothing
+ * and neither sdlpp's own instrumentation nor the application's costs
+ * anything.
+ *
+ * @note Zone names must be string literals (or otherwise outlive the export).
+ */
+
+#include <sdlpp/core/timer.hh>
+#include <sdlpp/detail/export.hh>
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#ifndef SDLPP_PROFILING
+#define SDLPP_PROFILING 0
+#endif
+
+namespace sdlpp {
+    /**
+     * @brief Process-wide zone recorder
+     */
+    class profiler {
+        public:
+            static constexpr std::size_t default_buffer_capacity = std::size_t{1} << 16;
+
+            /**
+             * @brief Current timestamp used for zones
+             */
+            [[nodiscard]] static std::uint64_t now() noexcept {
+                return static_cast <std::uint64_t>(
+                    timer::high_resolution_clock::now().time_since_epoch().count());
+            }
+
+            /**
+             * @brief Pause or resume recording at runtime
+             */
+            SDLPP_EXPORT static void set_enabled(bool enabled) noexcept;
+            [[nodiscard]] SDLPP_EXPORT static bool is_enabled() noexcept;
+
+            /**
+             * @brief Record a finished zone on the calling thread
+             * @param name Static zone name
+             * @param start_ns Start timestamp from now()
+             * @param end_ns End timestamp from now()
+             */
+            SDLPP_EXPORT static void record_zone(const char* name, std::uint64_t start_ns,
+                                                 std::uint64_t end_ns) noexcept;
+
+            /**
+             * @brief Mark the start of a new frame
+             */
+            SDLPP_EXPORT static void frame_mark() noexcept;
+
+            /**
+             * @brief Number of frame marks recorded
+             */
+            [[nodiscard]] SDLPP_EXPORT static std::uint64_t frame_count() noexcept;
+
+            /**
+             * @brief Name the calling thread in exported traces
+             */
+            SDLPP_EXPORT static void set_thread_name(std::string_view name);
+
+            /**
+             * @brief Ring size, in events, for threads that have not recorded yet
+             */
+            SDLPP_EXPORT static void set_buffer_capacity(std::size_t events) noexcept;
+
+            /**
+             * @brief Drain every thread's events as Chrome trace event JSON
+             *
+             * Events are consumed: the next export contains only what was
+             * recorded after this one. Safe to call while other threads are
+             * recording.
+             */
+            SDLPP_EXPORT static void write_chrome_trace(std::ostream& out);
+
+            /**
+             * @brief write_chrome_trace() into a string
+             */
+            [[nodiscard]] SDLPP_EXPORT static std::string chrome_trace();
+
+            /**
+             * @brief Discard every recorded event
+             */
+            SDLPP_EXPORT static void clear();
+
+            /**
+             * @brief Events lost to full buffers since startup
+             */
+            [[nodiscard]] SDLPP_EXPORT static std::uint64_t dropped_events();
+    };
+
+    /**
+     * @brief RAII zone; prefer the SDLPP_PROFILE_ZONE macro
+     */
+    class profile_zone {
+        public:
+            explicit profile_zone(const char* name) noexcept
+                : name_(name), start_(profiler::now()) {
+            }
+
+            ~profile_zone() {
+                profiler::record_zone(name_, start_, profiler::now());
+            }
+
+            profile_zone(const profile_zone&) = delete;
+            profile_zone& operator=(const profile_zone&) = delete;
+
+        private:
+            const char* name_;
+            std::uint64_t start_;
+    };
+} // namespace sdlpp
+
+#define SDLPP_PROFILE_CONCAT_IMPL(a, b) a##b
+#define SDLPP_PROFILE_CONCAT(a, b) SDLPP_PROFILE_CONCAT_IMPL(a, b)
+
+#if SDLPP_PROFILING
+#define SDLPP_PROFILE_ZONE(name) \
+    const ::sdlpp::profile_zone SDLPP_PROFILE_CONCAT(sdlpp_profile_zone_, __LINE__)(name)
+#define SDLPP_PROFILE_FRAME() ::sdlpp::profiler::frame_mark()
+#define SDLPP_PROFILE_THREAD(name) ::sdlpp::profiler::set_thread_name(name)
+#else
+#define SDLPP_PROFILE_ZONE(name) static_cast <void>(0)
+#define SDLPP_PROFILE_FRAME() static_cast <void>(0)
+#define SDLPP_PROFILE_THREAD(name) static_cast <void>(0)
+#endif
@@ -19,6 +19,7 @@
 #include <chrono>
 #include <functional>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <atomic>
 #include <thread>
@@ -99,6 +100,103 @@ namespace sdlpp {
                 }
             };
 
+            /**
+             * @brief Exact performance counter tick to nanosecond conversion
+             *
+             * Dividing (ticks * 10^9) by the frequency overflows 64 bits within
+             * seconds on a 1 GHz counter and costs a 64-bit division per call.
+             * The frequency is instead reduced against 10^9 to num / den once,
+             * and ticks are split as q * den + r using a precomputed reciprocal
+             * of den, so that
+             *
+             *     ns = q * num + (r * num) / den
+             *
+             * is computed with a few multiplications and is exact for every
+             * tick count whose result fits in 64 bits.
+             *
+             * @note If den * num does not fit in 64 bits (only for counters
+             *       faster than ~18 GHz with no common factor with 10^9) the
+             *       sub-second remainder is converted in floating point.
+             */
+            class tick_converter {
+                public:
+                    static constexpr Uint64 nanos_per_second = 1'000'000'000;
+
+                    constexpr explicit tick_converter(Uint64 frequency) noexcept
+                        : frequency_(frequency > 0 ? frequency : 1) {
+                        const Uint64 common = std::gcd(frequency_, nanos_per_second);
+                        num_ = nanos_per_second / common;
+                        den_ = frequency_ / common;
+                        if (den_ > 1) {
+                            reciprocal_ = ~Uint64{0} / den_;
+                            exact_ = num_ <= ~Uint64{0} / den_;
+                        }
+                    }
+
+                    /**
+                     * @brief Convert a tick count (or tick difference) to nanoseconds
+                     */
+                    [[nodiscard]] constexpr Uint64 to_nanoseconds(Uint64 ticks) const noexcept {
+                        if (den_ == 1) {
+                            return ticks * num_;
+                        }
+
+                        Uint64 rest = 0;
+                        const Uint64 whole = divide(ticks, rest);
+                        if (exact_) {
+                            Uint64 unused = 0;
+                            return whole * num_ + divide(rest * num_, unused);
+                        }
+                        return whole * num_ + static_cast <Uint64>(
+                            static_cast <long double>(rest) * static_cast <long double>(num_) /
+                            static_cast <long double>(den_));
+                    }
+
+                    /**
+                     * @brief Counts per second this converter was built for
+                     */
+                    [[nodiscard]] constexpr Uint64 frequency() const noexcept {
+                        return frequency_;
+                    }
+
+                private:
+                    // High 64 bits of a 64 x 64-bit product
+                    [[nodiscard]] static constexpr Uint64 mul_high(Uint64 a, Uint64 b) noexcept {
+#if defined(__SIZEOF_INT128__)
+                        __extension__ typedef unsigned __int128 uint128;
+                        return static_cast <Uint64>((static_cast <uint128>(a) * b) >> 64);
+#else
+                        const Uint64 a_lo = a & 0xFFFFFFFF;
+                        const Uint64 a_hi = a >> 32;
+                        const Uint64 b_lo = b & 0xFFFFFFFF;
+                        const Uint64 b_hi = b >> 32;
+                        const Uint64 lo_lo = a_lo * b_lo;
+                        const Uint64 hi_lo = a_hi * b_lo;
+                        const Uint64 lo_hi = a_lo * b_hi;
+                        const Uint64 cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+                        return a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+                    }
+
+                    // x / den_ and x % den_; the reciprocal estimate is at most
+                    // one short of the quotient
+                    [[nodiscard]] constexpr Uint64 divide(Uint64 x, Uint64& remainder) const noexcept {
+                        Uint64 quotient = mul_high(x, reciprocal_);
+                        remainder = x - quotient * den_;
+                        while (remainder >= den_) {
+                            ++quotient;
+                            remainder -= den_;
+                        }
+                        return quotient;
+                    }
+
+                    Uint64 frequency_;
+                    Uint64 num_ = 1;
+                    Uint64 den_ = 1;
+                    Uint64 reciprocal_ = 0;
+                    bool exact_ = true;
+            };
+
             /**
              * @brief High-resolution performance counter
              *
@@ -107,7 +205,6 @@ namespace sdlpp {
             class performance_counter {
                 private:
                     Uint64 start_count;
-                    static Uint64 frequency;
 
                 public:
                     /**
@@ -123,12 +220,10 @@ namespace sdlpp {
                      */
                     template<typename Duration = std::chrono::nanoseconds>
                     [[nodiscard]] Duration elapsed() const {
-                        Uint64 current = SDL_GetPerformanceCounter();
-                        Uint64 elapsed_counts = current - start_count;
-
-                        // Convert to nanoseconds first for precision
-                        auto nanos = (elapsed_counts * 1'000'000'000) / get_frequency();
-                        return std::chrono::duration_cast <Duration>(std::chrono::nanoseconds(nanos));
+                        const Uint64 elapsed_counts = SDL_GetPerformanceCounter() - start_count;
+                        const auto nanos = converter().to_nanoseconds(elapsed_counts);
+                        return std::chrono::duration_cast <Duration>(
+                            std::chrono::nanoseconds(static_cast <std::chrono::nanoseconds::rep>(nanos)));
                     }
 
                     /**
@@ -143,10 +238,7 @@ namespace sdlpp {
                      * @return Counts per second
                      */
                     [[nodiscard]] static Uint64 get_frequency() {
-                        if (frequency == 0) {
-                            frequency = SDL_GetPerformanceFrequency();
-                        }
-                        return frequency;
+                        return converter().frequency();
                     }
 
                     /**
@@ -156,12 +248,21 @@ namespace sdlpp {
                     [[nodiscard]] static Uint64 get_counter() {
                         return SDL_GetPerformanceCounter();
                     }
+
+                    /**
+                     * @brief Tick to nanosecond conversion for this machine's counter
+                     */
+                    [[nodiscard]] static const tick_converter& converter() noexcept {
+                        static const tick_converter instance(SDL_GetPerformanceFrequency());
+                        return instance;
+                    }
             };
 
             /**
              * @brief High-resolution clock using performance counter
              *
              * This clock provides nanosecond precision using SDL's performance counter.
+             * Hot paths can store now_ticks() and convert with from_ticks() later.
              */
             struct high_resolution_clock {
                 using duration = std::chrono::nanoseconds;
@@ -172,10 +273,22 @@ namespace sdlpp {
                 static constexpr bool is_steady = true;
 
                 [[nodiscard]] static time_point now() noexcept {
-                    static const Uint64 frequency = performance_counter::get_frequency();
-                    Uint64 count = performance_counter::get_counter();
-                    auto nanos = (count * 1'000'000'000) / frequency;
-                    return time_point(duration(nanos));
+                    return from_ticks(now_ticks());
+                }
+
+                /**
+                 * @brief Raw performance counter value, without conversion
+                 */
+                [[nodiscard]] static Uint64 now_ticks() noexcept {
+                    return SDL_GetPerformanceCounter();
+                }
+
+                /**
+                 * @brief Time point of a raw counter value from now_ticks()
+                 */
+                [[nodiscard]] static time_point from_ticks(Uint64 ticks) noexcept {
+                    const auto nanos = performance_counter::converter().to_nanoseconds(ticks);
+                    return time_point(duration(static_cast <rep>(nanos)));
                 }
             };
 
@@ -240,9 +353,6 @@ namespace sdlpp {
             }
     };
 
-    // Initialize static member
-    inline Uint64 timer::performance_counter::frequency = 0;
-
     /**
      * @brief RAII wrapper for SDL timer callbacks
      *
@@ -0,0 +1,301 @@
+#pragma once
+
+/**
+ * @file timer_wheel.hh
+ * @brief Hierarchical timer wheel for large numbers of lightweight timers
+ *
+ * timer_handle creates one SDL timer per callback and SDL runs it on its
+ * own timer thread. That is fine for a handful of timers, but gameplay code
+ * with thousands of cooldowns and timeouts needs something cheaper.
+ * timer_wheel keeps timers in-process, in six levels of 64 slots each:
+ * level 0 holds timers due within the next 64 ticks, level 1 within the
+ * next 4096 ticks, and so on. Higher-level slots are redistributed into
+ * lower levels as time reaches them.
+ *
+ * - schedule() and cancel() are O(1)
+ * - timer nodes are pooled and reused; ids carry a generation so a stale
+ *   id never cancels a newer timer
+ * - callbacks of up to 48 bytes are stored inside the node, so a pooled
+ *   schedule() does not allocate
+ * - advance() costs a few bit scans per level when nothing is due,
+ *   regardless of how many timers are pending
+ * - callbacks run on the thread that calls advance()
+ * - timers may give a tolerance; their expiry is then rounded up so that
+ *   timers due within the same tolerance window fire on the same tick
+ *
+ * @code
+ * sdlpp::timer_wheel timers;  // 1 ms ticks
+ *
+ * auto id = timers.schedule(std::chrono::seconds(3), [&] { ability.ready = true; });
+ * timers.schedule_every(std::chrono::milliseconds(250), [&] { regen(player); });
+ *
+ * // Main loop
+ * timers.advance(frame_delta);
+ * @endcode
+ *
+ * @note Not thread-safe: schedule, cancel and advance from one thread (the
+ *       main loop, or a dedicated thread that owns the wheel).
+ */
+
+#include <sdlpp/detail/export.hh>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sdlpp {
+    namespace detail {
+        /**
+         * @brief Move-only void() callable with inline storage for small captures
+         *
+         * Larger callables, or ones whose move may throw, are kept on the heap.
+         */
+        class timer_callback {
+            public:
+                static constexpr std::size_t inline_size = 48;
+
+                timer_callback() noexcept = default;
+                timer_callback(std::nullptr_t) noexcept {}
+
+                template<typename F>
+                    requires (!std::is_same_v <std::decay_t <F>, timer_callback> &&
+                              std::is_invocable_v <std::decay_t <F>&>)
+                timer_callback(F&& fn) {
+                    using fn_type = std::decay_t <F>;
+                    if constexpr (fits_inline <fn_type>()) {
+                        ::new (static_cast <void*>(storage_)) fn_type(std::forward <F>(fn));
+                        invoke_ = [](timer_callback& c) { (*c.as <fn_type>())(); };
+                        relocate_ = [](timer_callback& from, timer_callback& to) noexcept {
+                            fn_type* source = from.as <fn_type>();
+                            ::new (static_cast <void*>(to.storage_)) fn_type(std::move(*source));
+                            source->~fn_type();
+                        };
+                        destroy_ = [](timer_callback& c) noexcept { c.as <fn_type>()->~fn_type(); };
+                    } else {
+                        auto* heap = new fn_type(std::forward <F>(fn));
+                        ::new (static_cast <void*>(storage_)) fn_type*(heap);
+                        invoke_ = [](timer_callback& c) { (**c.as <fn_type*>())(); };
+                        relocate_ = [](timer_callback& from, timer_callback& to) noexcept {
+                            ::new (static_cast <void*>(to.storage_)) fn_type*(*from.as <fn_type*>());
+                        };
+                        destroy_ = [](timer_callback& c) noexcept { delete *c.as <fn_type*>(); };
+                    }
+                }
+
+                timer_callback(timer_callback&& other) noexcept { take(other); }
+
+                timer_callback& operator=(timer_callback&& other) noexcept {
+                    if (this != &other) {
+                        reset();
+                        take(other);
+                    }
+                    return *this;
+                }
+
+                timer_callback(const timer_callback&) = delete;
+                timer_callback& operator=(const timer_callback&) = delete;
+
+                ~timer_callback() { reset(); }
+
+                void operator()() { invoke_(*this); }
+
+                explicit operator bool() const noexcept { return invoke_ != nullptr; }
+
+                void reset() noexcept {
+                    if (destroy_) {
+                        destroy_(*this);
+                    }
+                    invoke_ = nullptr;
+                    relocate_ = nullptr;
+                    destroy_ = nullptr;
+                }
+
+            private:
+                template<typename T>
+                static constexpr bool fits_inline() noexcept {
+                    return sizeof(T) <= inline_size && alignof(T) <= alignof(std::max_align_t)
+                           && std::is_nothrow_move_constructible_v <T>;
+                }
+
+                template<typename T>
+                T* as() noexcept { return std::launder(reinterpret_cast <T*>(storage_)); }
+
+                void take(timer_callback& other) noexcept {
+                    if (!other.invoke_) {
+                        return;
+                    }
+                    other.relocate_(other, *this);
+                    invoke_ = std::exchange(other.invoke_, nullptr);
+                    relocate_ = std::exchange(other.relocate_, nullptr);
+                    destroy_ = std::exchange(other.destroy_, nullptr);
+                }
+
+                void (*invoke_)(timer_callback&) = nullptr;
+                void (*relocate_)(timer_callback&, timer_callback&) = nullptr;
+                void (*destroy_)(timer_callback&) = nullptr;
+                alignas(std::max_align_t) unsigned char storage_[inline_size];
+        };
+    } // namespace detail
+
+    /**
+     * @brief Timers driven by explicit advance() calls
+     */
+    class timer_wheel {
+        public:
+            using callback = detail::timer_callback;
+
+            /**
+             * @brief Identifies a scheduled timer
+             */
+            struct timer_id {
+                std::uint32_t index = 0;
+                std::uint32_t generation = 0;  ///< 0 never names a timer
+
+                [[nodiscard]] bool valid() const noexcept { return generation != 0; }
+                friend bool operator==(timer_id, timer_id) = default;
+            };
+
+            static constexpr std::size_t levels = 6;
+            static constexpr std::size_t slots_per_level = 64;
+
+            /**
+             * @brief Create an empty wheel
+             * @param resolution Length of one tick; delays are rounded up to whole ticks
+             */
+            SDLPP_EXPORT explicit timer_wheel(std::chrono::nanoseconds resolution = std::chrono::milliseconds(1));
+
+            timer_wheel(const timer_wheel&) = delete;
+            timer_wheel& operator=(const timer_wheel&) = delete;
+
+            /**
+             * @brief Run fn once after a delay
+             * @param delay Time from now (at least one tick)
+             * @param fn Callback
+             * @param tolerance How much later than delay the timer may fire,
+             *        so that it can share a tick with nearby timers
+             */
+            SDLPP_EXPORT timer_id schedule(std::chrono::nanoseconds delay, callback fn,
+                                           std::chrono::nanoseconds tolerance = std::chrono::nanoseconds(0));
+
+            /**
+             * @brief Run fn repeatedly
+             * @param period Time between runs; the schedule does not drift,
+             *        and a long advance() runs the callback once per period passed
+             * @param fn Callback; cancel its own id to stop
+             * @param tolerance Allowed lateness of the first run
+             */
+            SDLPP_EXPORT timer_id schedule_every(std::chrono::nanoseconds period, callback fn,
+                                                 std::chrono::nanoseconds tolerance = std::chrono::nanoseconds(0));
+
+            /**
+             * @brief Cancel a timer
+             * @return true if the timer was pending (or running, for periodic timers)
+             */
+            SDLPP_EXPORT bool cancel(timer_id id) noexcept;
+
+            /**
+             * @brief Check if a timer will still fire
+             */
+            [[nodiscard]] SDLPP_EXPORT bool is_pending(timer_id id) const noexcept;
+
+            /**
+             * @brief Move time forward and run every timer that became due
+             * @param elapsed Time since the previous advance()
+             * @return Number of callbacks run
+             */
+            SDLPP_EXPORT std::size_t advance(std::chrono::nanoseconds elapsed);
+
+            /**
+             * @brief Lower bound on the time until the next timer fires
+             * @return nullopt if no timer is pending
+             * @note Far-off timers are tracked per slot, so this may return
+             *       the time of a slot boundary before the timer itself;
+             *       sleeping that long and advancing is always safe
+             */
+            [[nodiscard]] SDLPP_EXPORT std::optional <std::chrono::nanoseconds> time_until_next() const noexcept;
+
+            /**
+             * @brief Cancel every timer
+             */
+            SDLPP_EXPORT void clear() noexcept;
+
+            /**
+             * @brief Number of pending timers
+             */
+            [[nodiscard]] std::size_t size() const noexcept { return pending_; }
+
+            [[nodiscard]] bool empty() const noexcept { return pending_ == 0; }
+
+            [[nodiscard]] std::chrono::nanoseconds resolution() const noexcept { return resolution_; }
+
+            /**
+             * @brief Time advanced so far, in whole ticks
+             */
+            [[nodiscard]] std::chrono::nanoseconds now() const noexcept {
+                return resolution_ * static_cast <std::int64_t>(elapsed_);
+            }
+
+        private:
+            static constexpr std::uint32_t nil = UINT32_MAX;
+            static constexpr std::size_t overflow_list = levels;  // Timers beyond the top level
+
+            enum class node_state : std::uint8_t {
+                free,
+                pending,
+                due,       // Expired, waiting in this advance()'s run list
+                running
+            };
+
+            struct node {
+                callback fn;
+                std::uint64_t expiry = 0;   // Absolute tick
+                std::uint64_t period = 0;   // Ticks; 0 for one-shot timers
+                std::uint32_t prev = nil;
+                std::uint32_t next = nil;
+                std::uint32_t generation = 1;
+                node_state state = node_state::free;
+                bool cancelled = false;     // Cancelled from inside its own callback
+                std::uint8_t list = 0;      // Level, or overflow_list
+                std::uint8_t slot = 0;
+            };
+
+            struct list_head {
+                std::uint32_t first = nil;
+                std::uint32_t last = nil;
+            };
+
+            std::uint32_t allocate();
+            void release(std::uint32_t index) noexcept;
+            node* lookup(timer_id id) noexcept;
+            [[nodiscard]] const node* lookup(timer_id id) const noexcept;
+
+            void insert(std::uint32_t index);
+            void unlink(std::uint32_t index) noexcept;
+            void push_back(list_head& list, std::uint32_t index) noexcept;
+            list_head& list_of(const node& n) noexcept;
+
+            [[nodiscard]] std::uint64_t ticks_for(std::chrono::nanoseconds delay) const noexcept;
+            [[nodiscard]] std::optional <std::uint64_t> next_deadline() const noexcept;
+            void expire(std::uint64_t deadline);
+            std::size_t run_due();
+
+            std::chrono::nanoseconds resolution_;
+            std::chrono::nanoseconds remainder_{0};
+            std::uint64_t elapsed_ = 0;                // Every timer due at or before this tick has fired
+
+            std::vector <node> nodes_;
+            std::uint32_t free_ = nil;
+            std::size_t pending_ = 0;
+
+            std::array <std::array <list_head, slots_per_level>, levels> wheel_{};
+            std::array <std::uint64_t, levels> occupied_{};  // Bit per non-empty slot
+            list_head overflow_;
+            list_head due_;
+    };
+} // namespace sdlpp
@@ -0,0 +1,41 @@
+#pragma once
+
+/**
+ * @file json.hh
+ * @brief Minimal JSON output helpers for trace exporters
+ */
+
+#include <iomanip>
+#include <ostream>
+#include <string_view>
+
+namespace sdlpp::detail {
+    /**
+     * @brief Write a string as a quoted, escaped JSON string
+     */
+    inline void write_json_string(std::ostream& out, std::string_view text) {
+        out << '"';
+        for (const char c : text) {
+            switch (c) {
+                case '"': out << "\\\""; break;
+                case '\\': out << "\\\\"; break;
+                case '\n': out << "\\n"; break;
+                case '\r': out << "\\r"; break;
+                case '\t': out << "\\t"; break;
+                default:
+                    if (static_cast <unsigned char>(c) < 0x20) {
+                        const auto flags = out.flags();
+                        const auto fill = out.fill();
+                        out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                            << static_cast <int>(c);
+                        out.flags(flags);
+                        out.fill(fill);
+                    } else {
+                        out << c;
+                    }
+                    break;
+            }
+        }
+        out << '"';
+    }
+} // namespace sdlpp::detail
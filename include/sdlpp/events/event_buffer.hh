@@ -0,0 +1,223 @@
+#pragma once
+
+/**
+ * @file event_buffer.hh
+ * @brief Batched event draining without per-event wrapper construction
+ *
+ * event_queue::poll() builds an event object (raw event plus lazily
+ * converted variant) for every event it returns. For high-rate input such as
+ * pens, touch screens and gaming mice this adds up. event_buffer drains many
+ * events per call into a reusable array and hands out event_view objects,
+ * which are a pointer to the raw SDL_Event with typed accessors.
+ *
+ * @code
+ * sdlpp::event_buffer events;
+ * while (events.poll() > 0) {
+ *     for (auto e : events) {
+ *         if (e.type() == sdlpp::event_type::pen_motion) {
+ *             stroke.add(e.pmotion().x, e.pmotion().y);
+ *         } else if (e.is<sdlpp::quit_event>()) {
+ *             running = false;
+ *         } else {
+ *             dispatch(e.to_event());  // Full wrapper only where needed
+ *         }
+ *     }
+ * }
+ * @endcode
+ */
+
+#include <sdlpp/events/events.hh>
+
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <vector>
+
+namespace sdlpp {
+    /**
+     * @brief Non-owning typed view of a raw SDL event
+     *
+     * Cheap to copy; valid until the underlying storage is refilled.
+     */
+    class event_view {
+        public:
+            constexpr event_view() noexcept = default;
+
+            explicit constexpr event_view(const SDL_Event& e) noexcept
+                : raw_(&e) {
+            }
+
+            [[nodiscard]] event_type type() const noexcept {
+                return static_cast <event_type>(raw_->type);
+            }
+
+            [[nodiscard]] Uint64 timestamp() const noexcept {
+                return raw_->common.timestamp;
+            }
+
+            /**
+             * @brief Fast type test, same rules as event::is()
+             */
+            template<typename T>
+            [[nodiscard]] bool is() const noexcept {
+                return is_event_of <T>(type());
+            }
+
+            // Direct access (user must check type first)
+            [[nodiscard]] const SDL_CommonEvent& common() const noexcept { return raw_->common; }
+            [[nodiscard]] const SDL_QuitEvent& quit() const noexcept { return raw_->quit; }
+            [[nodiscard]] const SDL_WindowEvent& window() const noexcept { return raw_->window; }
+            [[nodiscard]] const SDL_KeyboardEvent& key() const noexcept { return raw_->key; }
+            [[nodiscard]] const SDL_TextEditingEvent& edit() const noexcept { return raw_->edit; }
+            [[nodiscard]] const SDL_TextInputEvent& text() const noexcept { return raw_->text; }
+            [[nodiscard]] const SDL_MouseMotionEvent& motion() const noexcept { return raw_->motion; }
+            [[nodiscard]] const SDL_MouseButtonEvent& button() const noexcept { return raw_->button; }
+            [[nodiscard]] const SDL_MouseWheelEvent& wheel() const noexcept { return raw_->wheel; }
+            [[nodiscard]] const SDL_JoyAxisEvent& jaxis() const noexcept { return raw_->jaxis; }
+            [[nodiscard]] const SDL_JoyButtonEvent& jbutton() const noexcept { return raw_->jbutton; }
+            [[nodiscard]] const SDL_GamepadAxisEvent& gaxis() const noexcept { return raw_->gaxis; }
+            [[nodiscard]] const SDL_GamepadButtonEvent& gbutton() const noexcept { return raw_->gbutton; }
+            [[nodiscard]] const SDL_GamepadTouchpadEvent& gtouchpad() const noexcept { return raw_->gtouchpad; }
+            [[nodiscard]] const SDL_GamepadSensorEvent& gsensor() const noexcept { return raw_->gsensor; }
+            [[nodiscard]] const SDL_SensorEvent& sensor() const noexcept { return raw_->sensor; }
+            [[nodiscard]] const SDL_TouchFingerEvent& tfinger() const noexcept { return raw_->tfinger; }
+            [[nodiscard]] const SDL_PenProximityEvent& pproximity() const noexcept { return raw_->pproximity; }
+            [[nodiscard]] const SDL_PenTouchEvent& ptouch() const noexcept { return raw_->ptouch; }
+            [[nodiscard]] const SDL_PenMotionEvent& pmotion() const noexcept { return raw_->pmotion; }
+            [[nodiscard]] const SDL_PenButtonEvent& pbutton() const noexcept { return raw_->pbutton; }
+            [[nodiscard]] const SDL_PenAxisEvent& paxis() const noexcept { return raw_->paxis; }
+            [[nodiscard]] const SDL_DropEvent& drop() const noexcept { return raw_->drop; }
+            [[nodiscard]] const SDL_UserEvent& user() const noexcept { return raw_->user; }
+            [[nodiscard]] const SDL_DisplayEvent& display() const noexcept { return raw_->display; }
+
+            /**
+             * @brief Build a full event wrapper (copies the raw event)
+             */
+            [[nodiscard]] event to_event() const {
+                return event(*raw_);
+            }
+
+            // Raw access
+            [[nodiscard]] const SDL_Event& raw() const noexcept { return *raw_; }
+
+        private:
+            const SDL_Event* raw_{nullptr};
+    };
+
+    /**
+     * @brief Reusable buffer for draining the event queue in batches
+     *
+     * Storage is allocated once at construction; poll() never allocates.
+     * Views returned by iteration are invalidated by the next poll().
+     */
+    class event_buffer {
+        public:
+            /**
+             * @brief Iterator yielding event_view by value
+             */
+            class iterator {
+                public:
+                    using iterator_category = std::random_access_iterator_tag;
+                    using value_type = event_view;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = void;
+                    using reference = event_view;
+
+                    constexpr iterator() noexcept = default;
+
+                    explicit constexpr iterator(const SDL_Event* p) noexcept
+                        : p_(p) {
+                    }
+
+                    [[nodiscard]] event_view operator*() const noexcept { return event_view(*p_); }
+                    [[nodiscard]] event_view operator[](difference_type n) const noexcept { return event_view(p_[n]); }
+
+                    iterator& operator++() noexcept { ++p_; return *this; }
+                    iterator operator++(int) noexcept { auto tmp = *this; ++p_; return tmp; }
+                    iterator& operator--() noexcept { --p_; return *this; }
+                    iterator operator--(int) noexcept { auto tmp = *this; --p_; return tmp; }
+                    iterator& operator+=(difference_type n) noexcept { p_ += n; return *this; }
+                    iterator& operator-=(difference_type n) noexcept { p_ -= n; return *this; }
+
+                    [[nodiscard]] friend iterator operator+(iterator it, difference_type n) noexcept { return it += n; }
+                    [[nodiscard]] friend iterator operator+(difference_type n, iterator it) noexcept { return it += n; }
+                    [[nodiscard]] friend iterator operator-(iterator it, difference_type n) noexcept { return it -= n; }
+
+                    [[nodiscard]] friend difference_type operator-(iterator a, iterator b) noexcept {
+                        return a.p_ - b.p_;
+                    }
+
+                    [[nodiscard]] friend bool operator==(iterator a, iterator b) noexcept = default;
+                    [[nodiscard]] friend auto operator<=>(iterator a, iterator b) noexcept = default;
+
+                private:
+                    const SDL_Event* p_{nullptr};
+            };
+
+            static constexpr std::size_t default_capacity = 256;
+
+            /**
+             * @brief Create a buffer
+             * @param capacity Maximum events drained per poll()
+             */
+            explicit event_buffer(std::size_t capacity = default_capacity)
+                : events_(capacity == 0 ? 1 : capacity) {
+            }
+
+            /**
+             * @brief Drain up to capacity() pending events
+             * @param pump Pump OS events first; pass false for follow-up
+             *             calls in the same frame
+             * @return Number of events now in the buffer
+             */
+            std::size_t poll(bool pump = true) {
+                count_ = event_queue::poll_batch(std::span <SDL_Event>(events_), pump);
+                return count_;
+            }
+
+            /**
+             * @brief Drop the current contents
+             */
+            void clear() noexcept { count_ = 0; }
+
+            /**
+             * @brief Keep only the first count events (e.g. after in-place compaction)
+             */
+            void truncate(std::size_t count) noexcept {
+                if (count < count_) {
+                    count_ = count;
+                }
+            }
+
+            [[nodiscard]] std::size_t size() const noexcept { return count_; }
+            [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+            [[nodiscard]] std::size_t capacity() const noexcept { return events_.size(); }
+
+            /**
+             * @brief True if the last poll() filled the buffer (more may be pending)
+             */
+            [[nodiscard]] bool full() const noexcept { return count_ == events_.size(); }
+
+            [[nodiscard]] event_view operator[](std::size_t index) const noexcept {
+                return event_view(events_[index]);
+            }
+
+            [[nodiscard]] iterator begin() const noexcept { return iterator(events_.data()); }
+            [[nodiscard]] iterator end() const noexcept { return iterator(events_.data() + count_); }
+
+            /**
+             * @brief Raw events from the last poll()
+             */
+            [[nodiscard]] std::span <const SDL_Event> raw() const noexcept {
+                return {events_.data(), count_};
+            }
+
+            [[nodiscard]] std::span <SDL_Event> raw() noexcept {
+                return {events_.data(), count_};
+            }
+
+        private:
+            std::vector <SDL_Event> events_;
+            std::size_t count_{0};
+    };
+} // namespace sdlpp
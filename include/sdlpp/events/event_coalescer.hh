@@ -0,0 +1,161 @@
+#pragma once
+
+/**
+ * @file event_coalescer.hh
+ * @brief Merging of motion and resize bursts in drained event batches
+ *
+ * Drags, pen strokes and interactive window resizes produce long runs of
+ * events where only the final state (or the accumulated delta) matters.
+ * event_coalescer compacts a drained batch in place:
+ *
+ * - mouse motion: relative motion is summed, the absolute position is the latest
+ * - pen motion and pen axis events: the latest position / axis value wins
+ * - touch finger motion: dx/dy are summed, position and pressure are the latest
+ * - window resized / pixel size changed / moved: the latest geometry wins
+ *
+ * Only consecutive events of the same stream (mouse, pen and axis, finger,
+ * window) are merged, so the batch keeps its order and timestamps: a motion
+ * is never moved across a button press, a resize or another device's
+ * motion.
+ *
+ * Pen pressure is usually reported through separate axis events that are
+ * interleaved with motion, which keeps those runs apart; with pen history
+ * enabled, every pen sample seen (position plus last known pressure) is
+ * kept in a side buffer so stroke rendering does not lose detail.
+ *
+ * @code
+ * sdlpp::event_buffer events;
+ * sdlpp::event_coalescer coalescer(sdlpp::coalesce_flags::all, true);
+ *
+ * while (coalescer.poll(events) > 0) {
+ *     for (auto e : events) {
+ *         dispatcher.dispatch(e);
+ *     }
+ * }
+ * stroke.add_samples(coalescer.pen_history());
+ * coalescer.clear_pen_history();
+ * @endcode
+ *
+ * @note SDL event filters see each event once, before it is queued, and
+ *       cannot modify events that are already queued, so coalescing
+ *       happens when a batch is drained rather than inside an SDL filter.
+ */
+
+#include <sdlpp/events/events.hh>
+#include <sdlpp/events/event_buffer.hh>
+#include <sdlpp/detail/export.hh>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace sdlpp {
+    /**
+     * @brief Event families merged by event_coalescer
+     */
+    enum class coalesce_flags : std::uint32_t {
+        none = 0,
+        mouse_motion = 1u << 0,     ///< Mouse motion
+        pen_motion = 1u << 1,       ///< Pen motion and pen axis events
+        touch_motion = 1u << 2,     ///< Touch finger motion
+        window_geometry = 1u << 3,  ///< Window resized, pixel size changed and moved
+        all = mouse_motion | pen_motion | touch_motion | window_geometry
+    };
+
+    [[nodiscard]] constexpr coalesce_flags operator|(coalesce_flags lhs, coalesce_flags rhs) noexcept {
+        return static_cast <coalesce_flags>(
+            static_cast <std::uint32_t>(lhs) | static_cast <std::uint32_t>(rhs)
+        );
+    }
+
+    [[nodiscard]] constexpr coalesce_flags operator&(coalesce_flags lhs, coalesce_flags rhs) noexcept {
+        return static_cast <coalesce_flags>(
+            static_cast <std::uint32_t>(lhs) & static_cast <std::uint32_t>(rhs)
+        );
+    }
+
+    [[nodiscard]] constexpr bool has_flag(coalesce_flags flags, coalesce_flags flag) noexcept {
+        return (flags & flag) == flag;
+    }
+
+    /**
+     * @brief One pen sample recorded before coalescing
+     */
+    struct pen_sample {
+        Uint64 timestamp = 0;   ///< Event timestamp (ns)
+        SDL_PenID pen = 0;      ///< Pen instance
+        SDL_WindowID windowID = 0;
+        float x = 0.0f;         ///< Last known position
+        float y = 0.0f;
+        float pressure = 0.0f;  ///< Last known pressure (0.0 to 1.0)
+    };
+
+    /**
+     * @brief In-place merger of consecutive compatible events
+     */
+    class event_coalescer {
+        public:
+            /**
+             * @brief Create a coalescer
+             * @param flags Event families to merge
+             * @param keep_pen_history Record every pen sample in pen_history()
+             */
+            SDLPP_EXPORT explicit event_coalescer(coalesce_flags flags = coalesce_flags::all,
+                                                  bool keep_pen_history = false);
+
+            /**
+             * @brief Merge compatible events in place
+             * @param events Events in queue order
+             * @return Number of events kept (the first N entries of events)
+             */
+            SDLPP_EXPORT std::size_t apply(std::span <SDL_Event> events);
+
+            /**
+             * @brief Drain a batch into a buffer and coalesce it
+             * @param buffer Destination buffer
+             * @param pump Pump OS events first
+             * @return Number of events left in the buffer
+             */
+            SDLPP_EXPORT std::size_t poll(event_buffer& buffer, bool pump = true);
+
+            [[nodiscard]] coalesce_flags flags() const noexcept { return flags_; }
+            void set_flags(coalesce_flags flags) noexcept { flags_ = flags; }
+
+            [[nodiscard]] bool keeps_pen_history() const noexcept { return keep_pen_history_; }
+            void set_keep_pen_history(bool keep) noexcept { keep_pen_history_ = keep; }
+
+            /**
+             * @brief Pen samples recorded since the last clear_pen_history()
+             */
+            [[nodiscard]] std::span <const pen_sample> pen_history() const noexcept { return pen_history_; }
+
+            /**
+             * @brief Drop recorded pen samples (capacity is kept)
+             */
+            void clear_pen_history() noexcept { pen_history_.clear(); }
+
+            /**
+             * @brief Total number of events merged away
+             */
+            [[nodiscard]] std::uint64_t merged_events() const noexcept { return merged_; }
+
+            void reset_statistics() noexcept { merged_ = 0; }
+
+        private:
+            struct pen_state {
+                SDL_PenID pen;
+                float x;
+                float y;
+                float pressure;
+            };
+
+            [[nodiscard]] bool is_mergeable(const SDL_Event& e) const noexcept;
+            void record_pen(const SDL_Event& e);
+
+            coalesce_flags flags_;
+            bool keep_pen_history_;
+            std::uint64_t merged_{0};
+            std::vector <pen_sample> pen_history_;
+            std::vector <pen_state> pens_;
+    };
+} // namespace sdlpp
@@ -0,0 +1,239 @@
+#pragma once
+
+/**
+ * @file event_dispatcher.hh
+ * @brief Table-driven routing of events to typed handlers
+ *
+ * event_dispatcher maps event types to handlers through a dense table, so
+ * dispatch is a single indexed load and an indirect call regardless of how
+ * many handlers are registered. Handlers receive the wrapper struct they
+ * were registered for (keyboard_event, mouse_motion_event, ...), converted
+ * directly from the raw SDL_Event; event_variant is never built.
+ *
+ * Handlers are stored inline in the table slot: stateless lambdas take no
+ * space at all, and small trivially copyable callables (function pointers,
+ * lambdas capturing a pointer or two) are copied into the slot. Nothing is
+ * heap-allocated per handler.
+ *
+ * @code
+ * sdlpp::event_dispatcher dispatcher;
+ * dispatcher.on<sdlpp::keyboard_event>([this](const sdlpp::keyboard_event& e) {
+ *     handle_key(e);
+ * });
+ * dispatcher.on<sdlpp::pen_motion_event>([](const sdlpp::pen_motion_event& e) {
+ *     stroke().add(e.x, e.y);
+ * });
+ * dispatcher.on<sdlpp::quit_event>(sdlpp::event_type::quit, [this](const sdlpp::quit_event&) {
+ *     quit();
+ * });
+ *
+ * sdlpp::event_buffer events;
+ * while (events.poll() > 0) {
+ *     for (auto e : events) {
+ *         dispatcher.dispatch(e);
+ *     }
+ * }
+ * @endcode
+ */
+
+#include <sdlpp/events/events.hh>
+#include <sdlpp/events/event_buffer.hh>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace sdlpp {
+    /**
+     * @brief Dense event-type to handler table
+     *
+     * Event types are split into 256 pages of 256 entries; a page is
+     * allocated the first time a handler is registered in it. All user
+     * events share one slot unless a specific type is registered with
+     * on(event_type, f). A handler registered for common_event is the
+     * fallback for events with no other handler.
+     */
+    class event_dispatcher {
+        public:
+            /// Maximum size of a stateful callable stored in a slot
+            static constexpr std::size_t inline_capacity = 2 * sizeof(void*);
+
+            event_dispatcher() = default;
+
+            event_dispatcher(const event_dispatcher&) = delete;
+            event_dispatcher& operator=(const event_dispatcher&) = delete;
+            event_dispatcher(event_dispatcher&&) noexcept = default;
+            event_dispatcher& operator=(event_dispatcher&&) noexcept = default;
+
+            /**
+             * @brief Register a handler for every event type that converts to T
+             *
+             * user_event handlers receive all types >= event_type::user;
+             * common_event handlers become the fallback.
+             *
+             * @param f Callable invocable as f(const T&)
+             * @return *this for chaining
+             */
+            template<typename T, typename F>
+            event_dispatcher& on(F&& f) {
+                const slot s = make_slot <T>(std::forward <F>(f));
+                if constexpr (std::is_same_v <T, common_event>) {
+                    fallback_ = s;
+                } else if constexpr (std::is_same_v <T, user_event>) {
+                    user_ = s;
+                } else {
+                    for (Uint32 t = SDL_EVENT_FIRST; t < SDL_EVENT_USER; ++t) {
+                        if (is_event_of <T>(static_cast <event_type>(t))) {
+                            slot_for(t) = s;
+                        }
+                    }
+                }
+                return *this;
+            }
+
+            /**
+             * @brief Register a handler for one event type
+             *
+             * The handler is not registered if events of this type do not
+             * convert to T (a keyboard_event handler for mouse_motion would
+             * read the wrong union member). Custom event types accept any T.
+             *
+             * @param type Event type (including registered custom events)
+             * @param f Callable invocable as f(const T&)
+             * @return *this for chaining
+             */
+            template<typename T, typename F>
+            event_dispatcher& on(event_type type, F&& f) {
+                const auto t = static_cast <Uint32>(type);
+                if (!is_event_of <T>(type) && t < SDL_EVENT_USER) {
+                    return *this;
+                }
+                slot_for(t) = make_slot <T>(std::forward <F>(f));
+                return *this;
+            }
+
+            /**
+             * @brief Remove the handler registered for one event type
+             */
+            void remove(event_type type) noexcept {
+                const auto t = static_cast <Uint32>(type);
+                if (auto& p = pages_[page_index(t)]) {
+                    (*p)[t & 0xFF] = slot{};
+                }
+            }
+
+            /**
+             * @brief Remove all handlers
+             */
+            void clear() noexcept {
+                for (auto& p : pages_) {
+                    p.reset();
+                }
+                user_ = slot{};
+                fallback_ = slot{};
+            }
+
+            /**
+             * @brief Check whether an event of this type would reach a handler
+             */
+            [[nodiscard]] bool has_handler(event_type type) const noexcept {
+                return find(static_cast <Uint32>(type)) != nullptr;
+            }
+
+            /**
+             * @brief Route a raw event to its handler
+             * @return true if a handler was invoked
+             */
+            bool dispatch(const SDL_Event& e) const {
+                const slot* s = find(e.type);
+                if (!s) {
+                    return false;
+                }
+                s->invoke(s->storage, e);
+                return true;
+            }
+
+            bool dispatch(const event& e) const { return dispatch(e.raw()); }
+            bool dispatch(event_view e) const { return dispatch(e.raw()); }
+
+            /**
+             * @brief Route every event in a buffer
+             * @return Number of events that reached a handler
+             */
+            std::size_t dispatch(const event_buffer& events) const {
+                std::size_t handled = 0;
+                for (const SDL_Event& e : events.raw()) {
+                    handled += dispatch(e) ? 1u : 0u;
+                }
+                return handled;
+            }
+
+        private:
+            using invoke_fn = void (*)(const void* storage, const SDL_Event& e);
+
+            struct slot {
+                invoke_fn invoke{nullptr};
+                alignas(void*) unsigned char storage[inline_capacity]{};
+            };
+
+            using page = std::array <slot, 256>;
+
+            [[nodiscard]] static constexpr std::size_t page_index(Uint32 type) noexcept {
+                return (type >> 8) & 0xFF;
+            }
+
+            template<typename T, typename F>
+            static slot make_slot(F&& f) {
+                using fn_t = std::decay_t <F>;
+                static_assert(std::is_invocable_v <const fn_t&, const T&>,
+                              "Handler must be invocable with const T&");
+
+                slot s;
+                if constexpr (std::is_empty_v <fn_t> && std::is_default_constructible_v <fn_t>) {
+                    // Stateless: nothing to store, rebuild on each call
+                    s.invoke = [](const void*, const SDL_Event& e) {
+                        const fn_t fn{};
+                        fn(detail::convert_event(e, std::type_identity <T>{}));
+                    };
+                } else {
+                    static_assert(sizeof(fn_t) <= inline_capacity && alignof(fn_t) <= alignof(void*),
+                                  "Handler state too large; capture a pointer instead");
+                    static_assert(std::is_trivially_copyable_v <fn_t> && std::is_trivially_destructible_v <fn_t>,
+                                  "Handler state must be trivially copyable");
+                    ::new (static_cast <void*>(s.storage)) fn_t(std::forward <F>(f));
+                    s.invoke = [](const void* storage, const SDL_Event& e) {
+                        const auto& fn = *std::launder(static_cast <const fn_t*>(storage));
+                        fn(detail::convert_event(e, std::type_identity <T>{}));
+                    };
+                }
+                return s;
+            }
+
+            slot& slot_for(Uint32 type) {
+                auto& p = pages_[page_index(type)];
+                if (!p) {
+                    p = std::make_unique <page>();
+                }
+                return (*p)[type & 0xFF];
+            }
+
+            [[nodiscard]] const slot* find(Uint32 type) const noexcept {
+                if (const auto& p = pages_[page_index(type)]) {
+                    const slot& s = (*p)[type & 0xFF];
+                    if (s.invoke) {
+                        return &s;
+                    }
+                }
+                if (type >= SDL_EVENT_USER && user_.invoke) {
+                    return &user_;
+                }
+                return fallback_.invoke ? &fallback_ : nullptr;
+            }
+
+            std::array <std::unique_ptr <page>, 256> pages_{};
+            slot user_{};
+            slot fallback_{};
+    };
+} // namespace sdlpp
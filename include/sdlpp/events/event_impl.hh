@@ -6,6 +6,415 @@
  */
 
 namespace sdlpp {
+    namespace detail {
+        // Conversions from raw SDL events to the wrapper structs. Shared by
+        // event::ensure_variant() and event_dispatcher, which converts only
+        // the struct a handler asks for.
+        [[nodiscard]] inline quit_event convert_event(const SDL_Event& e, std::type_identity <quit_event>) {
+            return quit_event{
+                .type = static_cast <event_type>(e.quit.type),
+                .timestamp = e.quit.timestamp
+            };
+        }
+
+        [[nodiscard]] inline window_event convert_event(const SDL_Event& e, std::type_identity <window_event>) {
+            return window_event{
+                .type = static_cast <event_type>(e.window.type),
+                .timestamp = e.window.timestamp,
+                .windowID = e.window.windowID,
+                .data1 = e.window.data1,
+                .data2 = e.window.data2
+            };
+        }
+
+        [[nodiscard]] inline keyboard_device_event convert_event(const SDL_Event& e, std::type_identity <keyboard_device_event>) {
+            return keyboard_device_event{
+                .type = static_cast <event_type>(e.kdevice.type),
+                .timestamp = e.kdevice.timestamp,
+                .which = e.kdevice.which
+            };
+        }
+
+        [[nodiscard]] inline keyboard_event convert_event(const SDL_Event& e, std::type_identity <keyboard_event>) {
+            return keyboard_event{
+                .type = static_cast <event_type>(e.key.type),
+                .timestamp = e.key.timestamp,
+                .windowID = e.key.windowID,
+                .which = e.key.which,
+                .key = static_cast <keycode>(e.key.key),
+                .scan = static_cast <scancode>(e.key.scancode),
+                .mod = static_cast <keymod>(e.key.mod),
+                .raw = e.key.raw,
+                .down = e.key.down,
+                .repeat = e.key.repeat
+            };
+        }
+
+        [[nodiscard]] inline text_editing_event convert_event(const SDL_Event& e, std::type_identity <text_editing_event>) {
+            text_editing_event evt{
+                .type = static_cast <event_type>(e.edit.type),
+                .timestamp = e.edit.timestamp,
+                .windowID = e.edit.windowID,
+                .text = {},  // Initialize text
+                .start = e.edit.start,
+                .length = e.edit.length
+            };
+            evt.set_text_from_sdl(e.edit.text);
+            return evt;
+        }
+
+        [[nodiscard]] inline text_editing_candidates_event convert_event(const SDL_Event& e, std::type_identity <text_editing_candidates_event>) {
+            text_editing_candidates_event evt{
+                .type = static_cast <event_type>(e.edit_candidates.type),
+                .timestamp = e.edit_candidates.timestamp,
+                .windowID = e.edit_candidates.windowID,
+                .candidates = {},  // Initialize candidates
+                .selected_candidate = e.edit_candidates.selected_candidate,
+                .horizontal = e.edit_candidates.horizontal != 0
+            };
+            evt.set_candidates_from_sdl(e.edit_candidates.candidates, e.edit_candidates.num_candidates);
+            return evt;
+        }
+
+        [[nodiscard]] inline text_input_event convert_event(const SDL_Event& e, std::type_identity <text_input_event>) {
+            text_input_event evt{
+                .type = static_cast <event_type>(e.text.type),
+                .timestamp = e.text.timestamp,
+                .windowID = e.text.windowID,
+                .text = {}  // Initialize text
+            };
+            evt.set_text_from_sdl(e.text.text);
+            return evt;
+        }
+
+        [[nodiscard]] inline common_event convert_event(const SDL_Event& e, std::type_identity <common_event>) {
+            return common_event{
+                .type = static_cast <event_type>(e.common.type),
+                .timestamp = e.common.timestamp
+            };
+        }
+
+        [[nodiscard]] inline mouse_device_event convert_event(const SDL_Event& e, std::type_identity <mouse_device_event>) {
+            return mouse_device_event{
+                .type = static_cast <event_type>(e.mdevice.type),
+                .timestamp = e.mdevice.timestamp,
+                .which = e.mdevice.which
+            };
+        }
+
+        [[nodiscard]] inline mouse_motion_event convert_event(const SDL_Event& e, std::type_identity <mouse_motion_event>) {
+            return mouse_motion_event{
+                .type = static_cast <event_type>(e.motion.type),
+                .timestamp = e.motion.timestamp,
+                .windowID = e.motion.windowID,
+                .which = e.motion.which,
+                .state = static_cast <mouse_button_mask>(e.motion.state),
+                .x = e.motion.x,
+                .y = e.motion.y,
+                .xrel = e.motion.xrel,
+                .yrel = e.motion.yrel
+            };
+        }
+
+        [[nodiscard]] inline mouse_button_event convert_event(const SDL_Event& e, std::type_identity <mouse_button_event>) {
+            return mouse_button_event{
+                .type = static_cast <event_type>(e.button.type),
+                .timestamp = e.button.timestamp,
+                .windowID = e.button.windowID,
+                .which = e.button.which,
+                .button = e.button.button,
+                .down = e.button.down,
+                .clicks = e.button.clicks,
+                .x = e.button.x,
+                .y = e.button.y
+            };
+        }
+
+        [[nodiscard]] inline mouse_wheel_event convert_event(const SDL_Event& e, std::type_identity <mouse_wheel_event>) {
+            return mouse_wheel_event{
+                .type = static_cast <event_type>(e.wheel.type),
+                .timestamp = e.wheel.timestamp,
+                .windowID = e.wheel.windowID,
+                .which = e.wheel.which,
+                .x = e.wheel.x,
+                .y = e.wheel.y,
+                .direction = static_cast <mouse_wheel_direction>(e.wheel.direction),
+                .mouse_x = e.wheel.mouse_x,
+                .mouse_y = e.wheel.mouse_y
+            };
+        }
+
+        [[nodiscard]] inline joystick_device_event convert_event(const SDL_Event& e, std::type_identity <joystick_device_event>) {
+            return joystick_device_event{
+                .type = static_cast <event_type>(e.jdevice.type),
+                .timestamp = e.jdevice.timestamp,
+                .which = e.jdevice.which
+            };
+        }
+
+        [[nodiscard]] inline joystick_axis_event convert_event(const SDL_Event& e, std::type_identity <joystick_axis_event>) {
+            return joystick_axis_event{
+                .type = static_cast <event_type>(e.jaxis.type),
+                .timestamp = e.jaxis.timestamp,
+                .which = e.jaxis.which,
+                .axis = e.jaxis.axis,
+                .value = e.jaxis.value
+            };
+        }
+
+        [[nodiscard]] inline joystick_ball_event convert_event(const SDL_Event& e, std::type_identity <joystick_ball_event>) {
+            return joystick_ball_event{
+                .type = static_cast <event_type>(e.jball.type),
+                .timestamp = e.jball.timestamp,
+                .which = e.jball.which,
+                .ball = e.jball.ball,
+                .xrel = e.jball.xrel,
+                .yrel = e.jball.yrel
+            };
+        }
+
+        [[nodiscard]] inline joystick_hat_event convert_event(const SDL_Event& e, std::type_identity <joystick_hat_event>) {
+            return joystick_hat_event{
+                .type = static_cast <event_type>(e.jhat.type),
+                .timestamp = e.jhat.timestamp,
+                .which = e.jhat.which,
+                .hat = e.jhat.hat,
+                .value = e.jhat.value
+            };
+        }
+
+        [[nodiscard]] inline joystick_button_event convert_event(const SDL_Event& e, std::type_identity <joystick_button_event>) {
+            return joystick_button_event{
+                .type = static_cast <event_type>(e.jbutton.type),
+                .timestamp = e.jbutton.timestamp,
+                .which = e.jbutton.which,
+                .button = e.jbutton.button,
+                .down = e.jbutton.down
+            };
+        }
+
+        [[nodiscard]] inline joystick_battery_event convert_event(const SDL_Event& e, std::type_identity <joystick_battery_event>) {
+            return joystick_battery_event{
+                .type = static_cast <event_type>(e.jbattery.type),
+                .timestamp = e.jbattery.timestamp,
+                .which = e.jbattery.which,
+                .state = static_cast<power_state>(e.jbattery.state),
+                .percent = e.jbattery.percent
+            };
+        }
+
+        [[nodiscard]] inline gamepad_device_event convert_event(const SDL_Event& e, std::type_identity <gamepad_device_event>) {
+            return gamepad_device_event{
+                .type = static_cast <event_type>(e.gdevice.type),
+                .timestamp = e.gdevice.timestamp,
+                .which = e.gdevice.which
+            };
+        }
+
+        [[nodiscard]] inline gamepad_axis_event convert_event(const SDL_Event& e, std::type_identity <gamepad_axis_event>) {
+            return gamepad_axis_event{
+                .type = static_cast <event_type>(e.gaxis.type),
+                .timestamp = e.gaxis.timestamp,
+                .which = e.gaxis.which,
+                .axis = static_cast <Uint8>(e.gaxis.axis),
+                .value = e.gaxis.value
+            };
+        }
+
+        [[nodiscard]] inline gamepad_button_event convert_event(const SDL_Event& e, std::type_identity <gamepad_button_event>) {
+            return gamepad_button_event{
+                .type = static_cast <event_type>(e.gbutton.type),
+                .timestamp = e.gbutton.timestamp,
+                .which = e.gbutton.which,
+                .button = static_cast <Uint8>(e.gbutton.button),
+                .down = e.gbutton.down
+            };
+        }
+
+        [[nodiscard]] inline gamepad_touchpad_event convert_event(const SDL_Event& e, std::type_identity <gamepad_touchpad_event>) {
+            return gamepad_touchpad_event{
+                .type = static_cast <event_type>(e.gtouchpad.type),
+                .timestamp = e.gtouchpad.timestamp,
+                .which = e.gtouchpad.which,
+                .touchpad = e.gtouchpad.touchpad,
+                .finger = e.gtouchpad.finger,
+                .x = e.gtouchpad.x,
+                .y = e.gtouchpad.y,
+                .pressure = e.gtouchpad.pressure
+            };
+        }
+
+        [[nodiscard]] inline gamepad_sensor_event convert_event(const SDL_Event& e, std::type_identity <gamepad_sensor_event>) {
+            return gamepad_sensor_event{
+                .type = static_cast <event_type>(e.gsensor.type),
+                .timestamp = e.gsensor.timestamp,
+                .which = e.gsensor.which,
+                .sensor = static_cast<sensor_type>(e.gsensor.sensor),
+                .data = {e.gsensor.data[0], e.gsensor.data[1], e.gsensor.data[2]},
+                .sensor_timestamp = e.gsensor.sensor_timestamp
+            };
+        }
+
+        [[nodiscard]] inline touch_finger_event convert_event(const SDL_Event& e, std::type_identity <touch_finger_event>) {
+            return touch_finger_event{
+                .type = static_cast <event_type>(e.tfinger.type),
+                .timestamp = e.tfinger.timestamp,
+                .touchID = e.tfinger.touchID,
+                .fingerID = e.tfinger.fingerID,
+                .x = e.tfinger.x,
+                .y = e.tfinger.y,
+                .dx = e.tfinger.dx,
+                .dy = e.tfinger.dy,
+                .pressure = e.tfinger.pressure
+            };
+        }
+
+        [[nodiscard]] inline pen_proximity_event convert_event(const SDL_Event& e, std::type_identity <pen_proximity_event>) {
+            return pen_proximity_event{
+                .type = static_cast <event_type>(e.pproximity.type),
+                .timestamp = e.pproximity.timestamp,
+                .windowID = e.pproximity.windowID,
+                .which = e.pproximity.which
+            };
+        }
+
+        [[nodiscard]] inline pen_touch_event convert_event(const SDL_Event& e, std::type_identity <pen_touch_event>) {
+            return pen_touch_event{
+                .type = static_cast <event_type>(e.ptouch.type),
+                .timestamp = e.ptouch.timestamp,
+                .windowID = e.ptouch.windowID,
+                .which = e.ptouch.which,
+                .pen_state = static_cast<pen_input_flags>(e.ptouch.pen_state),
+                .x = e.ptouch.x,
+                .y = e.ptouch.y,
+                .eraser = e.ptouch.eraser,
+                .down = e.ptouch.down
+            };
+        }
+
+        [[nodiscard]] inline pen_motion_event convert_event(const SDL_Event& e, std::type_identity <pen_motion_event>) {
+            return pen_motion_event{
+                .type = static_cast <event_type>(e.pmotion.type),
+                .timestamp = e.pmotion.timestamp,
+                .windowID = e.pmotion.windowID,
+                .which = e.pmotion.which,
+                .pen_state = static_cast<pen_input_flags>(e.pmotion.pen_state),
+                .x = e.pmotion.x,
+                .y = e.pmotion.y
+            };
+        }
+
+        [[nodiscard]] inline pen_button_event convert_event(const SDL_Event& e, std::type_identity <pen_button_event>) {
+            return pen_button_event{
+                .type = static_cast <event_type>(e.pbutton.type),
+                .timestamp = e.pbutton.timestamp,
+                .windowID = e.pbutton.windowID,
+                .which = e.pbutton.which,
+                .pen_state = static_cast<pen_input_flags>(e.pbutton.pen_state),
+                .x = e.pbutton.x,
+                .y = e.pbutton.y,
+                .button = e.pbutton.button,
+                .down = e.pbutton.down
+            };
+        }
+
+        [[nodiscard]] inline pen_axis_event convert_event(const SDL_Event& e, std::type_identity <pen_axis_event>) {
+            return pen_axis_event{
+                .type = static_cast <event_type>(e.paxis.type),
+                .timestamp = e.paxis.timestamp,
+                .windowID = e.paxis.windowID,
+                .which = e.paxis.which,
+                .pen_state = static_cast<pen_input_flags>(e.paxis.pen_state),
+                .x = e.paxis.x,
+                .y = e.paxis.y,
+                .axis = static_cast<pen_axis>(e.paxis.axis),
+                .value = e.paxis.value
+            };
+        }
+
+        [[nodiscard]] inline clipboard_event convert_event(const SDL_Event& e, std::type_identity <clipboard_event>) {
+            return clipboard_event{
+                .type = static_cast <event_type>(e.clipboard.type),
+                .timestamp = e.clipboard.timestamp,
+                .owner = e.clipboard.owner
+            };
+        }
+
+        [[nodiscard]] inline drop_event convert_event(const SDL_Event& e, std::type_identity <drop_event>) {
+            drop_event evt{
+                .type = static_cast <event_type>(e.drop.type),
+                .timestamp = e.drop.timestamp,
+                .windowID = e.drop.windowID,
+                .x = e.drop.x,
+                .y = e.drop.y,
+                .source = {},  // Initialize source
+                .data = {}  // Initialize data
+            };
+            evt.set_source_from_sdl(e.drop.source);
+            evt.set_data_from_sdl(e.drop.data);
+            return evt;
+        }
+
+        [[nodiscard]] inline audio_device_event convert_event(const SDL_Event& e, std::type_identity <audio_device_event>) {
+            return audio_device_event{
+                .type = static_cast <event_type>(e.adevice.type),
+                .timestamp = e.adevice.timestamp,
+                .which = e.adevice.which,
+                .recording = e.adevice.recording
+            };
+        }
+
+        [[nodiscard]] inline camera_device_event convert_event(const SDL_Event& e, std::type_identity <camera_device_event>) {
+            return camera_device_event{
+                .type = static_cast <event_type>(e.cdevice.type),
+                .timestamp = e.cdevice.timestamp,
+                .which = e.cdevice.which
+            };
+        }
+
+        [[nodiscard]] inline sensor_event convert_event(const SDL_Event& e, std::type_identity <sensor_event>) {
+            return sensor_event{
+                .type = static_cast <event_type>(e.sensor.type),
+                .timestamp = e.sensor.timestamp,
+                .which = e.sensor.which,
+                .data = {
+                    e.sensor.data[0], e.sensor.data[1], e.sensor.data[2], e.sensor.data[3],
+                    e.sensor.data[4], e.sensor.data[5]
+                },
+                .sensor_timestamp = e.sensor.sensor_timestamp
+            };
+        }
+
+        [[nodiscard]] inline render_event convert_event(const SDL_Event& e, std::type_identity <render_event>) {
+            return render_event{
+                .type = static_cast <event_type>(e.render.type),
+                .timestamp = e.render.timestamp,
+                .windowID = e.render.windowID
+            };
+        }
+
+        [[nodiscard]] inline display_event convert_event(const SDL_Event& e, std::type_identity <display_event>) {
+            return display_event{
+                .type = static_cast <event_type>(e.display.type),
+                .timestamp = e.display.timestamp,
+                .displayID = e.display.displayID,
+                .data1 = e.display.data1,
+                .data2 = e.display.data2
+            };
+        }
+
+        [[nodiscard]] inline user_event convert_event(const SDL_Event& e, std::type_identity <user_event>) {
+            return user_event{
+                .type = static_cast <event_type>(e.user.type),
+                .timestamp = e.user.timestamp,
+                .windowID = e.user.windowID,
+                .code = e.user.code,
+                .data1 = e.user.data1,
+                .data2 = e.user.data2
+            };
+        }
+    } // namespace detail
+
     inline void event::ensure_variant() const {
         if (variant_.has_value()) return;
 
@@ -19,10 +428,7 @@ namespace sdlpp {
             case event_type::did_enter_foreground:
             case event_type::locale_changed:
             case event_type::system_theme_changed:
-                variant_ = quit_event{
-                    .type = static_cast <event_type>(raw_.quit.type),
-                    .timestamp = raw_.quit.timestamp
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <quit_event>{});
                 break;
 
             case event_type::window_shown:
@@ -50,199 +456,78 @@ namespace sdlpp {
             case event_type::window_leave_fullscreen:
             case event_type::window_destroyed:
             case event_type::window_hdr_state_changed:
-                variant_ = window_event{
-                    .type = static_cast <event_type>(raw_.window.type),
-                    .timestamp = raw_.window.timestamp,
-                    .windowID = raw_.window.windowID,
-                    .data1 = raw_.window.data1,
-                    .data2 = raw_.window.data2
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <window_event>{});
                 break;
 
             case event_type::keyboard_added:
             case event_type::keyboard_removed:
-                variant_ = keyboard_device_event{
-                    .type = static_cast <event_type>(raw_.kdevice.type),
-                    .timestamp = raw_.kdevice.timestamp,
-                    .which = raw_.kdevice.which
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <keyboard_device_event>{});
                 break;
 
             case event_type::key_down:
             case event_type::key_up:
-                variant_ = keyboard_event{
-                    .type = static_cast <event_type>(raw_.key.type),
-                    .timestamp = raw_.key.timestamp,
-                    .windowID = raw_.key.windowID,
-                    .which = raw_.key.which,
-                    .key = static_cast <keycode>(raw_.key.key),
-                    .scan = static_cast <scancode>(raw_.key.scancode),
-                    .mod = static_cast <keymod>(raw_.key.mod),
-                    .raw = raw_.key.raw,
-                    .down = raw_.key.down,
-                    .repeat = raw_.key.repeat
-                };
-                break;
-
-            case event_type::text_editing: {
-                text_editing_event evt{
-                    .type = static_cast <event_type>(raw_.edit.type),
-                    .timestamp = raw_.edit.timestamp,
-                    .windowID = raw_.edit.windowID,
-                    .text = {},  // Initialize text
-                    .start = raw_.edit.start,
-                    .length = raw_.edit.length
-                };
-                evt.set_text_from_sdl(raw_.edit.text);
-                variant_ = std::move(evt);
-                break;
-            }
-
-            case event_type::text_editing_candidates: {
-                text_editing_candidates_event evt{
-                    .type = static_cast <event_type>(raw_.edit_candidates.type),
-                    .timestamp = raw_.edit_candidates.timestamp,
-                    .windowID = raw_.edit_candidates.windowID,
-                    .candidates = {},  // Initialize candidates
-                    .selected_candidate = raw_.edit_candidates.selected_candidate,
-                    .horizontal = raw_.edit_candidates.horizontal != 0
-                };
-                evt.set_candidates_from_sdl(raw_.edit_candidates.candidates, raw_.edit_candidates.num_candidates);
-                variant_ = std::move(evt);
-                break;
-            }
-
-            case event_type::text_input: {
-                text_input_event evt{
-                    .type = static_cast <event_type>(raw_.text.type),
-                    .timestamp = raw_.text.timestamp,
-                    .windowID = raw_.text.windowID,
-                    .text = {}  // Initialize text
-                };
-                evt.set_text_from_sdl(raw_.text.text);
-                variant_ = std::move(evt);
-                break;
-            }
+                variant_ = detail::convert_event(raw_, std::type_identity <keyboard_event>{});
+                break;
+
+            case event_type::text_editing:
+                variant_ = detail::convert_event(raw_, std::type_identity <text_editing_event>{});
+                break;
+
+            case event_type::text_editing_candidates:
+                variant_ = detail::convert_event(raw_, std::type_identity <text_editing_candidates_event>{});
+                break;
+
+            case event_type::text_input:
+                variant_ = detail::convert_event(raw_, std::type_identity <text_input_event>{});
+                break;
 
             case event_type::keymap_changed:
-                variant_ = common_event{
-                    .type = static_cast <event_type>(raw_.common.type),
-                    .timestamp = raw_.common.timestamp
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <common_event>{});
                 break;
 
             case event_type::mouse_added:
             case event_type::mouse_removed:
-                variant_ = mouse_device_event{
-                    .type = static_cast <event_type>(raw_.mdevice.type),
-                    .timestamp = raw_.mdevice.timestamp,
-                    .which = raw_.mdevice.which
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <mouse_device_event>{});
                 break;
 
             case event_type::mouse_motion:
-                variant_ = mouse_motion_event{
-                    .type = static_cast <event_type>(raw_.motion.type),
-                    .timestamp = raw_.motion.timestamp,
-                    .windowID = raw_.motion.windowID,
-                    .which = raw_.motion.which,
-                    .state = static_cast <mouse_button_mask>(raw_.motion.state),
-                    .x = raw_.motion.x,
-                    .y = raw_.motion.y,
-                    .xrel = raw_.motion.xrel,
-                    .yrel = raw_.motion.yrel
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <mouse_motion_event>{});
                 break;
 
             case event_type::mouse_button_down:
             case event_type::mouse_button_up:
-                variant_ = mouse_button_event{
-                    .type = static_cast <event_type>(raw_.button.type),
-                    .timestamp = raw_.button.timestamp,
-                    .windowID = raw_.button.windowID,
-                    .which = raw_.button.which,
-                    .button = raw_.button.button,
-                    .down = raw_.button.down,
-                    .clicks = raw_.button.clicks,
-                    .x = raw_.button.x,
-                    .y = raw_.button.y
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <mouse_button_event>{});
                 break;
 
             case event_type::mouse_wheel:
-                variant_ = mouse_wheel_event{
-                    .type = static_cast <event_type>(raw_.wheel.type),
-                    .timestamp = raw_.wheel.timestamp,
-                    .windowID = raw_.wheel.windowID,
-                    .which = raw_.wheel.which,
-                    .x = raw_.wheel.x,
-                    .y = raw_.wheel.y,
-                    .direction = static_cast <mouse_wheel_direction>(raw_.wheel.direction),
-                    .mouse_x = raw_.wheel.mouse_x,
-                    .mouse_y = raw_.wheel.mouse_y
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <mouse_wheel_event>{});
                 break;
 
             case event_type::joystick_added:
             case event_type::joystick_removed:
             case event_type::joystick_update_complete:
-                variant_ = joystick_device_event{
-                    .type = static_cast <event_type>(raw_.jdevice.type),
-                    .timestamp = raw_.jdevice.timestamp,
-                    .which = raw_.jdevice.which
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <joystick_device_event>{});
                 break;
 
             case event_type::joystick_axis_motion:
-                variant_ = joystick_axis_event{
-                    .type = static_cast <event_type>(raw_.jaxis.type),
-                    .timestamp = raw_.jaxis.timestamp,
-                    .which = raw_.jaxis.which,
-                    .axis = raw_.jaxis.axis,
-                    .value = raw_.jaxis.value
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <joystick_axis_event>{});
                 break;
 
             case event_type::joystick_ball_motion:
-                variant_ = joystick_ball_event{
-                    .type = static_cast <event_type>(raw_.jball.type),
-                    .timestamp = raw_.jball.timestamp,
-                    .which = raw_.jball.which,
-                    .ball = raw_.jball.ball,
-                    .xrel = raw_.jball.xrel,
-                    .yrel = raw_.jball.yrel
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <joystick_ball_event>{});
                 break;
 
             case event_type::joystick_hat_motion:
-                variant_ = joystick_hat_event{
-                    .type = static_cast <event_type>(raw_.jhat.type),
-                    .timestamp = raw_.jhat.timestamp,
-                    .which = raw_.jhat.which,
-                    .hat = raw_.jhat.hat,
-                    .value = raw_.jhat.value
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <joystick_hat_event>{});
                 break;
 
             case event_type::joystick_button_down:
             case event_type::joystick_button_up:
-                variant_ = joystick_button_event{
-                    .type = static_cast <event_type>(raw_.jbutton.type),
-                    .timestamp = raw_.jbutton.timestamp,
-                    .which = raw_.jbutton.which,
-                    .button = raw_.jbutton.button,
-                    .down = raw_.jbutton.down
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <joystick_button_event>{});
                 break;
 
             case event_type::joystick_battery_updated:
-                variant_ = joystick_battery_event{
-                    .type = static_cast <event_type>(raw_.jbattery.type),
-                    .timestamp = raw_.jbattery.timestamp,
-                    .which = raw_.jbattery.which,
-                    .state = static_cast<power_state>(raw_.jbattery.state),
-                    .percent = raw_.jbattery.percent
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <joystick_battery_event>{});
                 break;
 
             case event_type::gamepad_added:
@@ -250,213 +535,90 @@ namespace sdlpp {
             case event_type::gamepad_remapped:
             case event_type::gamepad_update_complete:
             case event_type::gamepad_steam_handle_updated:
-                variant_ = gamepad_device_event{
-                    .type = static_cast <event_type>(raw_.gdevice.type),
-                    .timestamp = raw_.gdevice.timestamp,
-                    .which = raw_.gdevice.which
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <gamepad_device_event>{});
                 break;
 
             case event_type::gamepad_axis_motion:
-                variant_ = gamepad_axis_event{
-                    .type = static_cast <event_type>(raw_.gaxis.type),
-                    .timestamp = raw_.gaxis.timestamp,
-                    .which = raw_.gaxis.which,
-                    .axis = static_cast <Uint8>(raw_.gaxis.axis),
-                    .value = raw_.gaxis.value
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <gamepad_axis_event>{});
                 break;
 
             case event_type::gamepad_button_down:
             case event_type::gamepad_button_up:
-                variant_ = gamepad_button_event{
-                    .type = static_cast <event_type>(raw_.gbutton.type),
-                    .timestamp = raw_.gbutton.timestamp,
-                    .which = raw_.gbutton.which,
-                    .button = static_cast <Uint8>(raw_.gbutton.button),
-                    .down = raw_.gbutton.down
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <gamepad_button_event>{});
                 break;
 
             case event_type::gamepad_touchpad_down:
             case event_type::gamepad_touchpad_motion:
             case event_type::gamepad_touchpad_up:
-                variant_ = gamepad_touchpad_event{
-                    .type = static_cast <event_type>(raw_.gtouchpad.type),
-                    .timestamp = raw_.gtouchpad.timestamp,
-                    .which = raw_.gtouchpad.which,
-                    .touchpad = raw_.gtouchpad.touchpad,
-                    .finger = raw_.gtouchpad.finger,
-                    .x = raw_.gtouchpad.x,
-                    .y = raw_.gtouchpad.y,
-                    .pressure = raw_.gtouchpad.pressure
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <gamepad_touchpad_event>{});
                 break;
 
             case event_type::gamepad_sensor_update:
-                variant_ = gamepad_sensor_event{
-                    .type = static_cast <event_type>(raw_.gsensor.type),
-                    .timestamp = raw_.gsensor.timestamp,
-                    .which = raw_.gsensor.which,
-                    .sensor = static_cast<sensor_type>(raw_.gsensor.sensor),
-                    .data = {raw_.gsensor.data[0], raw_.gsensor.data[1], raw_.gsensor.data[2]},
-                    .sensor_timestamp = raw_.gsensor.sensor_timestamp
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <gamepad_sensor_event>{});
                 break;
 
             case event_type::finger_down:
             case event_type::finger_up:
             case event_type::finger_motion:
-                variant_ = touch_finger_event{
-                    .type = static_cast <event_type>(raw_.tfinger.type),
-                    .timestamp = raw_.tfinger.timestamp,
-                    .touchID = raw_.tfinger.touchID,
-                    .fingerID = raw_.tfinger.fingerID,
-                    .x = raw_.tfinger.x,
-                    .y = raw_.tfinger.y,
-                    .dx = raw_.tfinger.dx,
-                    .dy = raw_.tfinger.dy,
-                    .pressure = raw_.tfinger.pressure
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <touch_finger_event>{});
                 break;
 
             case event_type::pen_proximity_in:
             case event_type::pen_proximity_out:
-                variant_ = pen_proximity_event{
-                    .type = static_cast <event_type>(raw_.pproximity.type),
-                    .timestamp = raw_.pproximity.timestamp,
-                    .windowID = raw_.pproximity.windowID,
-                    .which = raw_.pproximity.which
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <pen_proximity_event>{});
                 break;
 
             case event_type::pen_down:
             case event_type::pen_up:
-                variant_ = pen_touch_event{
-                    .type = static_cast <event_type>(raw_.ptouch.type),
-                    .timestamp = raw_.ptouch.timestamp,
-                    .windowID = raw_.ptouch.windowID,
-                    .which = raw_.ptouch.which,
-                    .pen_state = static_cast<pen_input_flags>(raw_.ptouch.pen_state),
-                    .x = raw_.ptouch.x,
-                    .y = raw_.ptouch.y,
-                    .eraser = raw_.ptouch.eraser,
-                    .down = raw_.ptouch.down
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <pen_touch_event>{});
                 break;
 
             case event_type::pen_motion:
-                variant_ = pen_motion_event{
-                    .type = static_cast <event_type>(raw_.pmotion.type),
-                    .timestamp = raw_.pmotion.timestamp,
-                    .windowID = raw_.pmotion.windowID,
-                    .which = raw_.pmotion.which,
-                    .pen_state = static_cast<pen_input_flags>(raw_.pmotion.pen_state),
-                    .x = raw_.pmotion.x,
-                    .y = raw_.pmotion.y
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <pen_motion_event>{});
                 break;
 
             case event_type::pen_button_down:
             case event_type::pen_button_up:
-                variant_ = pen_button_event{
-                    .type = static_cast <event_type>(raw_.pbutton.type),
-                    .timestamp = raw_.pbutton.timestamp,
-                    .windowID = raw_.pbutton.windowID,
-                    .which = raw_.pbutton.which,
-                    .pen_state = static_cast<pen_input_flags>(raw_.pbutton.pen_state),
-                    .x = raw_.pbutton.x,
-                    .y = raw_.pbutton.y,
-                    .button = raw_.pbutton.button,
-                    .down = raw_.pbutton.down
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <pen_button_event>{});
                 break;
 
             case event_type::pen_axis:
-                variant_ = pen_axis_event{
-                    .type = static_cast <event_type>(raw_.paxis.type),
-                    .timestamp = raw_.paxis.timestamp,
-                    .windowID = raw_.paxis.windowID,
-                    .which = raw_.paxis.which,
-                    .pen_state = static_cast<pen_input_flags>(raw_.paxis.pen_state),
-                    .x = raw_.paxis.x,
-                    .y = raw_.paxis.y,
-                    .axis = static_cast<pen_axis>(raw_.paxis.axis),
-                    .value = raw_.paxis.value
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <pen_axis_event>{});
                 break;
 
             case event_type::clipboard_update:
-                variant_ = clipboard_event{
-                    .type = static_cast <event_type>(raw_.clipboard.type),
-                    .timestamp = raw_.clipboard.timestamp,
-                    .owner = raw_.clipboard.owner
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <clipboard_event>{});
                 break;
 
             case event_type::drop_file:
             case event_type::drop_text:
             case event_type::drop_begin:
             case event_type::drop_complete:
-            case event_type::drop_position: {
-                drop_event evt{
-                    .type = static_cast <event_type>(raw_.drop.type),
-                    .timestamp = raw_.drop.timestamp,
-                    .windowID = raw_.drop.windowID,
-                    .x = raw_.drop.x,
-                    .y = raw_.drop.y,
-                    .source = {},  // Initialize source
-                    .data = {}  // Initialize data
-                };
-                evt.set_source_from_sdl(raw_.drop.source);
-                evt.set_data_from_sdl(raw_.drop.data);
-                variant_ = std::move(evt);
-                break;
-            }
+            case event_type::drop_position:
+                variant_ = detail::convert_event(raw_, std::type_identity <drop_event>{});
+                break;
 
             case event_type::audio_device_added:
             case event_type::audio_device_removed:
             case event_type::audio_device_format_changed:
-                variant_ = audio_device_event{
-                    .type = static_cast <event_type>(raw_.adevice.type),
-                    .timestamp = raw_.adevice.timestamp,
-                    .which = raw_.adevice.which,
-                    .recording = raw_.adevice.recording
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <audio_device_event>{});
                 break;
 
             case event_type::camera_device_added:
             case event_type::camera_device_removed:
             case event_type::camera_device_approved:
             case event_type::camera_device_denied:
-                variant_ = camera_device_event{
-                    .type = static_cast <event_type>(raw_.cdevice.type),
-                    .timestamp = raw_.cdevice.timestamp,
-                    .which = raw_.cdevice.which
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <camera_device_event>{});
                 break;
 
             case event_type::sensor_update:
-                variant_ = sensor_event{
-                    .type = static_cast <event_type>(raw_.sensor.type),
-                    .timestamp = raw_.sensor.timestamp,
-                    .which = raw_.sensor.which,
-                    .data = {
-                        raw_.sensor.data[0], raw_.sensor.data[1], raw_.sensor.data[2], raw_.sensor.data[3],
-                        raw_.sensor.data[4], raw_.sensor.data[5]
-                    },
-                    .sensor_timestamp = raw_.sensor.sensor_timestamp
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <sensor_event>{});
                 break;
 
             case event_type::render_targets_reset:
             case event_type::render_device_reset:
             case event_type::render_device_lost:
-                variant_ = render_event{
-                    .type = static_cast <event_type>(raw_.render.type),
-                    .timestamp = raw_.render.timestamp,
-                    .windowID = raw_.render.windowID
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <render_event>{});
                 break;
 
             case event_type::display_orientation:
@@ -466,31 +628,15 @@ namespace sdlpp {
             case event_type::display_desktop_mode_changed:
             case event_type::display_current_mode_changed:
             case event_type::display_content_scale_changed:
-                variant_ = display_event{
-                    .type = static_cast <event_type>(raw_.display.type),
-                    .timestamp = raw_.display.timestamp,
-                    .displayID = raw_.display.displayID,
-                    .data1 = raw_.display.data1,
-                    .data2 = raw_.display.data2
-                };
+                variant_ = detail::convert_event(raw_, std::type_identity <display_event>{});
                 break;
 
             default:
                 // Handle user events and unknown events
                 if (static_cast <Uint32>(type()) >= static_cast <Uint32>(event_type::user)) {
-                    variant_ = user_event{
-                        .type = static_cast <event_type>(raw_.user.type),
-                        .timestamp = raw_.user.timestamp,
-                        .windowID = raw_.user.windowID,
-                        .code = raw_.user.code,
-                        .data1 = raw_.user.data1,
-                        .data2 = raw_.user.data2
-                    };
+                    variant_ = detail::convert_event(raw_, std::type_identity <user_event>{});
                 } else {
-                    variant_ = common_event{
-                        .type = static_cast <event_type>(raw_.common.type),
-                        .timestamp = raw_.common.timestamp
-                    };
+                    variant_ = detail::convert_event(raw_, std::type_identity <common_event>{});
                 }
                 break;
         }
@@ -19,6 +19,8 @@
 #include <variant>
 #include <functional>
 #include <chrono>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 namespace sdlpp {
@@ -169,7 +171,7 @@ namespace sdlpp {
     /**
      * @brief Check if event type is in a range
      */
-    [[nodiscard]] inline bool is_event_type_in_range(event_type type, event_type first, event_type last) noexcept {
+    [[nodiscard]] inline constexpr bool is_event_type_in_range(event_type type, event_type first, event_type last) noexcept {
         auto t = static_cast <Uint32>(type);
         return t >= static_cast <Uint32>(first) && t <= static_cast <Uint32>(last);
     }
@@ -364,96 +366,101 @@ namespace sdlpp {
             [[nodiscard]] const SDL_Event& raw() const noexcept { return raw_; }
     };
 
-    // Template method implementations
+    /**
+     * @brief Check whether an event type maps to a wrapper struct
+     * @tparam T Wrapper type from event_variant (e.g. mouse_motion_event)
+     * @param t Event type
+     * @return true if events of this type convert to T
+     */
     template<typename T>
-    bool event::is() const noexcept {
+    [[nodiscard]] constexpr bool is_event_of(event_type t) noexcept {
         if constexpr (std::is_same_v <T, quit_event>) {
-            return type() == event_type::quit || type() == event_type::terminating ||
-                   type() == event_type::low_memory || type() == event_type::will_enter_background ||
-                   type() == event_type::did_enter_background || type() == event_type::will_enter_foreground ||
-                   type() == event_type::did_enter_foreground || type() == event_type::locale_changed ||
-                   type() == event_type::system_theme_changed;
+            return t == event_type::quit || t == event_type::terminating ||
+                   t == event_type::low_memory || t == event_type::will_enter_background ||
+                   t == event_type::did_enter_background || t == event_type::will_enter_foreground ||
+                   t == event_type::did_enter_foreground || t == event_type::locale_changed ||
+                   t == event_type::system_theme_changed;
         } else if constexpr (std::is_same_v <T, window_event>) {
-            return is_event_type_in_range(type(), event_type::window_shown, event_type::window_hdr_state_changed);
+            return is_event_type_in_range(t, event_type::window_shown, event_type::window_hdr_state_changed);
         } else if constexpr (std::is_same_v <T, keyboard_event>) {
-            return type() == event_type::key_down || type() == event_type::key_up;
+            return t == event_type::key_down || t == event_type::key_up;
         } else if constexpr (std::is_same_v <T, keyboard_device_event>) {
-            return type() == event_type::keyboard_added || type() == event_type::keyboard_removed;
+            return t == event_type::keyboard_added || t == event_type::keyboard_removed;
         } else if constexpr (std::is_same_v <T, text_editing_event>) {
-            return type() == event_type::text_editing;
+            return t == event_type::text_editing;
         } else if constexpr (std::is_same_v <T, text_editing_candidates_event>) {
-            return type() == event_type::text_editing_candidates;
+            return t == event_type::text_editing_candidates;
         } else if constexpr (std::is_same_v <T, text_input_event>) {
-            return type() == event_type::text_input;
+            return t == event_type::text_input;
         } else if constexpr (std::is_same_v <T, mouse_device_event>) {
-            return type() == event_type::mouse_added || type() == event_type::mouse_removed;
+            return t == event_type::mouse_added || t == event_type::mouse_removed;
         } else if constexpr (std::is_same_v <T, mouse_motion_event>) {
-            return type() == event_type::mouse_motion;
+            return t == event_type::mouse_motion;
         } else if constexpr (std::is_same_v <T, mouse_button_event>) {
-            return type() == event_type::mouse_button_down || type() == event_type::mouse_button_up;
+            return t == event_type::mouse_button_down || t == event_type::mouse_button_up;
         } else if constexpr (std::is_same_v <T, mouse_wheel_event>) {
-            return type() == event_type::mouse_wheel;
+            return t == event_type::mouse_wheel;
         } else if constexpr (std::is_same_v <T, joystick_device_event>) {
-            return type() == event_type::joystick_added || type() == event_type::joystick_removed ||
-                   type() == event_type::joystick_update_complete;
+            return t == event_type::joystick_added || t == event_type::joystick_removed ||
+                   t == event_type::joystick_update_complete;
         } else if constexpr (std::is_same_v <T, joystick_axis_event>) {
-            return type() == event_type::joystick_axis_motion;
+            return t == event_type::joystick_axis_motion;
         } else if constexpr (std::is_same_v <T, joystick_ball_event>) {
-            return type() == event_type::joystick_ball_motion;
+            return t == event_type::joystick_ball_motion;
         } else if constexpr (std::is_same_v <T, joystick_hat_event>) {
-            return type() == event_type::joystick_hat_motion;
+            return t == event_type::joystick_hat_motion;
         } else if constexpr (std::is_same_v <T, joystick_button_event>) {
-            return type() == event_type::joystick_button_down || type() == event_type::joystick_button_up;
+            return t == event_type::joystick_button_down || t == event_type::joystick_button_up;
         } else if constexpr (std::is_same_v <T, joystick_battery_event>) {
-            return type() == event_type::joystick_battery_updated;
+            return t == event_type::joystick_battery_updated;
         } else if constexpr (std::is_same_v <T, gamepad_device_event>) {
-            return type() == event_type::gamepad_added || type() == event_type::gamepad_removed ||
-                   type() == event_type::gamepad_remapped || type() == event_type::gamepad_update_complete ||
-                   type() == event_type::gamepad_steam_handle_updated;
+            return t == event_type::gamepad_added || t == event_type::gamepad_removed ||
+                   t == event_type::gamepad_remapped || t == event_type::gamepad_update_complete ||
+                   t == event_type::gamepad_steam_handle_updated;
         } else if constexpr (std::is_same_v <T, gamepad_axis_event>) {
-            return type() == event_type::gamepad_axis_motion;
+            return t == event_type::gamepad_axis_motion;
         } else if constexpr (std::is_same_v <T, gamepad_button_event>) {
-            return type() == event_type::gamepad_button_down || type() == event_type::gamepad_button_up;
+            return t == event_type::gamepad_button_down || t == event_type::gamepad_button_up;
         } else if constexpr (std::is_same_v <T, gamepad_touchpad_event>) {
-            return type() == event_type::gamepad_touchpad_down || type() == event_type::gamepad_touchpad_motion ||
-                   type() == event_type::gamepad_touchpad_up;
+            return t == event_type::gamepad_touchpad_down || t == event_type::gamepad_touchpad_motion ||
+                   t == event_type::gamepad_touchpad_up;
         } else if constexpr (std::is_same_v <T, gamepad_sensor_event>) {
-            return type() == event_type::gamepad_sensor_update;
+            return t == event_type::gamepad_sensor_update;
         } else if constexpr (std::is_same_v <T, audio_device_event>) {
-            return type() == event_type::audio_device_added || type() == event_type::audio_device_removed ||
-                   type() == event_type::audio_device_format_changed;
+            return t == event_type::audio_device_added || t == event_type::audio_device_removed ||
+                   t == event_type::audio_device_format_changed;
         } else if constexpr (std::is_same_v <T, camera_device_event>) {
-            return type() == event_type::camera_device_added || type() == event_type::camera_device_removed ||
-                   type() == event_type::camera_device_approved || type() == event_type::camera_device_denied;
+            return t == event_type::camera_device_added || t == event_type::camera_device_removed ||
+                   t == event_type::camera_device_approved || t == event_type::camera_device_denied;
         } else if constexpr (std::is_same_v <T, sensor_event>) {
-            return type() == event_type::sensor_update;
+            return t == event_type::sensor_update;
         } else if constexpr (std::is_same_v <T, touch_finger_event>) {
-            return type() == event_type::finger_down || type() == event_type::finger_up ||
-                   type() == event_type::finger_motion;
+            return t == event_type::finger_down || t == event_type::finger_up ||
+                   t == event_type::finger_motion;
         } else if constexpr (std::is_same_v <T, pen_proximity_event>) {
-            return type() == event_type::pen_proximity_in || type() == event_type::pen_proximity_out;
+            return t == event_type::pen_proximity_in || t == event_type::pen_proximity_out;
         } else if constexpr (std::is_same_v <T, pen_touch_event>) {
-            return type() == event_type::pen_down || type() == event_type::pen_up;
+            return t == event_type::pen_down || t == event_type::pen_up;
         } else if constexpr (std::is_same_v <T, pen_motion_event>) {
-            return type() == event_type::pen_motion;
+            return t == event_type::pen_motion;
         } else if constexpr (std::is_same_v <T, pen_button_event>) {
-            return type() == event_type::pen_button_down || type() == event_type::pen_button_up;
+            return t == event_type::pen_button_down || t == event_type::pen_button_up;
         } else if constexpr (std::is_same_v <T, pen_axis_event>) {
-            return type() == event_type::pen_axis;
+            return t == event_type::pen_axis;
         } else if constexpr (std::is_same_v <T, drop_event>) {
-            return type() == event_type::drop_file || type() == event_type::drop_text ||
-                   type() == event_type::drop_begin || type() == event_type::drop_complete ||
-                   type() == event_type::drop_position;
+            return t == event_type::drop_file || t == event_type::drop_text ||
+                   t == event_type::drop_begin || t == event_type::drop_complete ||
+                   t == event_type::drop_position;
         } else if constexpr (std::is_same_v <T, clipboard_event>) {
-            return type() == event_type::clipboard_update;
+            return t == event_type::clipboard_update;
         } else if constexpr (std::is_same_v <T, display_event>) {
-            return is_event_type_in_range(type(), event_type::display_orientation,
+            return is_event_type_in_range(t, event_type::display_orientation,
                                           event_type::display_content_scale_changed);
         } else if constexpr (std::is_same_v <T, render_event>) {
-            return type() == event_type::render_targets_reset || type() == event_type::render_device_reset ||
-                   type() == event_type::render_device_lost;
+            return t == event_type::render_targets_reset || t == event_type::render_device_reset ||
+                   t == event_type::render_device_lost;
         } else if constexpr (std::is_same_v <T, user_event>) {
-            return static_cast <Uint32>(type()) >= SDL_EVENT_USER;
+            return static_cast <Uint32>(t) >= SDL_EVENT_USER;
         } else if constexpr (std::is_same_v <T, common_event>) {
             return true; // common_event can represent any event
         } else {
@@ -461,6 +468,12 @@ namespace sdlpp {
         }
     }
 
+    // Template method implementations
+    template<typename T>
+    bool event::is() const noexcept {
+        return is_event_of <T>(type());
+    }
+
     template<typename T>
     T* event::as() noexcept {
         if (is <T>()) {
@@ -504,6 +517,19 @@ namespace sdlpp {
              */
             [[nodiscard]] SDLPP_EXPORT static std::optional <event> poll();
 
+            /**
+             * @brief Drain pending events into a caller-provided array
+             *
+             * Pumps the OS queue once, then removes up to events.size() events
+             * with a single SDL_PeepEvents call. No event wrappers are built;
+             * use event_view to inspect the results.
+             *
+             * @param events Destination array
+             * @param pump Pump OS events before draining
+             * @return Number of events written (0 if the queue was empty or on error)
+             */
+            [[nodiscard]] SDLPP_EXPORT static std::size_t poll_batch(std::span <SDL_Event> events, bool pump = true);
+
             /**
              * @brief Wait for next event
              * @return Event or error
@@ -605,13 +631,13 @@ namespace sdlpp {
         public:
             using watcher_func = SDL_EventFilter;
 
-            explicit event_watcher(watcher_func func, void* userdata = nullptr);
-            ~event_watcher();
+            SDLPP_EXPORT explicit event_watcher(watcher_func func, void* userdata = nullptr);
+            SDLPP_EXPORT ~event_watcher();
 
             event_watcher(const event_watcher&) = delete;
             event_watcher& operator=(const event_watcher&) = delete;
-            event_watcher(event_watcher&& other) noexcept;
-            event_watcher& operator=(event_watcher&& other) noexcept;
+            SDLPP_EXPORT event_watcher(event_watcher&& other) noexcept;
+            SDLPP_EXPORT event_watcher& operator=(event_watcher&& other) noexcept;
 
         private:
             watcher_func func_{nullptr};
@@ -0,0 +1,196 @@
+#pragma once
+
+/**
+ * @file input_trace.hh
+ * @brief Deterministic input recording and replay
+ *
+ * input_recorder captures the raw event stream (through an SDL event watch
+ * or explicit record() calls) into a compact binary trace:
+ *
+ * - header: "SDLPPIRT" followed by a version byte
+ * - one record per event: varint time delta (ns), varint event type,
+ *   varint payload length, payload bytes, then any strings the event points
+ *   to (text input, text editing, drop data) as varint length + bytes
+ *
+ * The payload is the type-specific SDL struct after the common header, with
+ * pointers cleared and trailing zero bytes trimmed, so typical motion and
+ * key events take 10-30 bytes. Writes go to an in-memory buffer that is
+ * flushed to the iostream in large blocks.
+ *
+ * input_replayer loads a trace and injects the events through
+ * event_queue::push() at their original pace, accelerated, or in
+ * fast-forward mode where every update() advances a fixed virtual frame
+ * step regardless of wall time. Combined with the dummy video driver this
+ * gives repeatable runs on headless machines.
+ *
+ * @code
+ * // Record
+ * auto recorder = sdlpp::input_recorder::create("session.irt");
+ * recorder->start();
+ * ...
+ * recorder->stop();
+ *
+ * // Replay as fast as the loop runs, one 60 Hz frame of input per update
+ * auto replayer = sdlpp::input_replayer::load("session.irt");
+ * replayer->set_fast_forward(std::chrono::nanoseconds(16'666'667));
+ * replayer->start();
+ * while (!replayer->finished()) {
+ *     replayer->update();
+ *     run_one_frame();
+ * }
+ * @endcode
+ *
+ * @note Injected events do not update SDL's internal keyboard and mouse
+ *       state; code that polls SDL_GetKeyboardState() during replay should
+ *       track state from events instead.
+ */
+
+#include <sdlpp/events/events.hh>
+#include <sdlpp/io/iostream.hh>
+#include <sdlpp/detail/export.hh>
+#include <sdlpp/detail/expected.hh>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace sdlpp {
+    /**
+     * @brief Records the event stream into a binary trace
+     */
+    class input_recorder {
+        public:
+            /**
+             * @brief Create a recorder writing to a file
+             * @param path Trace file (truncated)
+             * @return Recorder or error message
+             */
+            [[nodiscard]] SDLPP_EXPORT static expected <input_recorder, std::string> create(
+                const std::filesystem::path& path);
+
+            /**
+             * @brief Create a recorder writing to an open stream
+             * @param stream Destination (ownership is taken)
+             */
+            SDLPP_EXPORT explicit input_recorder(iostream stream);
+
+            /**
+             * @brief Stops recording and flushes pending data
+             */
+            SDLPP_EXPORT ~input_recorder();
+
+            input_recorder(const input_recorder&) = delete;
+            input_recorder& operator=(const input_recorder&) = delete;
+            SDLPP_EXPORT input_recorder(input_recorder&&) noexcept;
+            SDLPP_EXPORT input_recorder& operator=(input_recorder&&) noexcept;
+
+            /**
+             * @brief Start capturing every queued event through an event watch
+             */
+            SDLPP_EXPORT void start();
+
+            /**
+             * @brief Stop capturing and flush
+             * @return Expected<void> - empty on success, error message on failure
+             */
+            SDLPP_EXPORT expected <void, std::string> stop();
+
+            [[nodiscard]] SDLPP_EXPORT bool is_recording() const noexcept;
+
+            /**
+             * @brief Append one event (thread-safe)
+             */
+            SDLPP_EXPORT void record(const SDL_Event& e);
+
+            /**
+             * @brief Write buffered records to the stream
+             * @return Expected<void> - empty on success, error message on failure
+             */
+            SDLPP_EXPORT expected <void, std::string> flush();
+
+            /**
+             * @brief Events recorded so far
+             */
+            [[nodiscard]] SDLPP_EXPORT std::size_t event_count() const noexcept;
+
+            /**
+             * @brief Trace bytes produced so far (written or buffered)
+             */
+            [[nodiscard]] SDLPP_EXPORT std::size_t byte_count() const noexcept;
+
+        private:
+            struct state;
+            std::unique_ptr <state> state_;
+    };
+
+    /**
+     * @brief Replays a trace through the event queue
+     */
+    class input_replayer {
+        public:
+            /**
+             * @brief Load a trace file
+             * @return Replayer or error message
+             */
+            [[nodiscard]] SDLPP_EXPORT static expected <input_replayer, std::string> load(
+                const std::filesystem::path& path);
+
+            /**
+             * @brief Decode a trace from memory
+             * @return Replayer or error message
+             */
+            [[nodiscard]] SDLPP_EXPORT static expected <input_replayer, std::string> from_bytes(
+                std::span <const std::uint8_t> data);
+
+            /**
+             * @brief Playback speed for timed replay (1.0 = original timing)
+             */
+            SDLPP_EXPORT void set_speed(double factor) noexcept;
+
+            /**
+             * @brief Advance a fixed virtual step per update() instead of wall time
+             * @param frame_step Virtual time per update(); zero returns to timed replay
+             */
+            SDLPP_EXPORT void set_fast_forward(std::chrono::nanoseconds frame_step) noexcept;
+
+            /**
+             * @brief Start (or restart) playback from the first event
+             */
+            SDLPP_EXPORT void start() noexcept;
+
+            /**
+             * @brief Inject every event that is due
+             * @return Number of events pushed, or error message
+             */
+            SDLPP_EXPORT expected <std::size_t, std::string> update();
+
+            [[nodiscard]] bool finished() const noexcept { return next_ >= entries_.size(); }
+            [[nodiscard]] std::size_t size() const noexcept { return entries_.size(); }
+            [[nodiscard]] std::size_t position() const noexcept { return next_; }
+
+            /**
+             * @brief Time from the first to the last recorded event
+             */
+            [[nodiscard]] SDLPP_EXPORT std::chrono::nanoseconds duration() const noexcept;
+
+        private:
+            struct entry {
+                Uint64 offset_ns;  // Relative to the first event
+                SDL_Event event;
+            };
+
+            input_replayer() = default;
+
+            std::vector <entry> entries_;
+            std::vector <std::unique_ptr <char[]>> strings_;  // Text referenced by entries
+            std::size_t next_ = 0;
+            double speed_ = 1.0;
+            Uint64 frame_step_ns_ = 0;
+            Uint64 start_ns_ = 0;
+            Uint64 virtual_ns_ = 0;
+    };
+} // namespace sdlpp
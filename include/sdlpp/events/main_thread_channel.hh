@@ -0,0 +1,279 @@
+#pragma once
+
+/**
+ * @file main_thread_channel.hh
+ * @brief Bounded lock-free channel from worker threads to the main loop
+ *
+ * Pushing a user_event per result costs SDL's global queue lock, a heap
+ * allocation for the payload and manual lifetime management of data1/data2.
+ * main_thread_channel<T> stores values directly in a bounded ring buffer
+ * (many producers, one consumer) and posts a single wake-up event when the
+ * channel goes from drained to non-empty. The main loop then drains every
+ * pending value in one pass.
+ *
+ * @code
+ * // Shared between workers and the main thread
+ * sdlpp::main_thread_channel<job_result> results(4096);
+ *
+ * // Worker thread
+ * if (!results.try_send(std::move(result))) {
+ *     // Channel full: retry later or drop
+ * }
+ *
+ * // Main thread event handling
+ * if (results.is_wake_event(e.raw())) {
+ *     results.drain([&](job_result&& r) { apply(std::move(r)); });
+ * }
+ * @endcode
+ *
+ * @note The channel must outlive every producer and every wake-up event
+ *       still in the SDL queue (the event carries its address in data1).
+ */
+
+#include <sdlpp/events/events.hh>
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sdlpp {
+    /**
+     * @brief Bounded MPSC channel into the main thread
+     * @tparam T Value type (must be nothrow move constructible)
+     */
+    template<typename T>
+    class main_thread_channel {
+        static_assert(std::is_nothrow_move_constructible_v <T>,
+                      "main_thread_channel values must be nothrow move constructible");
+
+        public:
+            /**
+             * @brief Create a channel
+             * @param capacity Maximum queued values (rounded up to a power of two)
+             * @param wake_type Event type posted on wake-up; use
+             *        event_registry::register_events() to get a private one
+             */
+            explicit main_thread_channel(std::size_t capacity, event_type wake_type = event_type::user)
+                : mask_(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity) - 1),
+                  cells_(std::make_unique <cell[]>(mask_ + 1)),
+                  wake_type_(static_cast <Uint32>(wake_type)) {
+                for (std::size_t i = 0; i <= mask_; ++i) {
+                    cells_[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            ~main_thread_channel() {
+                drain([](T&&) {});
+            }
+
+            main_thread_channel(const main_thread_channel&) = delete;
+            main_thread_channel& operator=(const main_thread_channel&) = delete;
+            main_thread_channel(main_thread_channel&&) = delete;
+            main_thread_channel& operator=(main_thread_channel&&) = delete;
+
+            // ================================================================
+            // Producer side (any thread)
+            // ================================================================
+
+            /**
+             * @brief Queue a value without blocking
+             * @return false if the channel is full (the value is not consumed)
+             */
+            bool try_send(T&& value) {
+                return try_emplace(std::move(value));
+            }
+
+            bool try_send(const T& value) {
+                return try_emplace(value);
+            }
+
+            /**
+             * @brief Construct a value in place without blocking
+             * @return false if the channel is full
+             */
+            template<typename... Args>
+            bool try_emplace(Args&&... args) {
+                std::size_t pos = tail_.load(std::memory_order_relaxed);
+                cell* c = nullptr;
+                for (;;) {
+                    c = &cells_[pos & mask_];
+                    const std::size_t seq = c->sequence.load(std::memory_order_acquire);
+                    const auto diff = static_cast <std::ptrdiff_t>(seq - pos);
+                    if (diff == 0) {
+                        if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                            break;
+                        }
+                    } else if (diff < 0) {
+                        dropped_.fetch_add(1, std::memory_order_relaxed);
+                        return false;
+                    } else {
+                        pos = tail_.load(std::memory_order_relaxed);
+                    }
+                }
+
+                ::new (static_cast <void*>(c->storage)) T(std::forward <Args>(args)...);
+                c->sequence.store(pos + 1, std::memory_order_release);
+
+                // Only the first value after a drain wakes the main thread
+                if (!wake_pending_.exchange(true, std::memory_order_acq_rel)) {
+                    post_wake();
+                }
+                return true;
+            }
+
+            // ================================================================
+            // Consumer side (main thread only)
+            // ================================================================
+
+            /**
+             * @brief Check whether an event is this channel's wake-up
+             */
+            [[nodiscard]] bool is_wake_event(const SDL_Event& e) const noexcept {
+                return e.type == wake_type_ && e.user.data1 == static_cast <const void*>(this);
+            }
+
+            /**
+             * @brief Hand every queued value to a callback
+             * @param fn Callable invoked as fn(T&&)
+             * @param max_items Stop after this many values
+             * @return Number of values drained
+             * @note If fn throws, the value it was given is still removed and
+             *       destroyed; the remaining values stay queued.
+             */
+            template<typename F>
+            std::size_t drain(F&& fn, std::size_t max_items = std::numeric_limits <std::size_t>::max()) {
+                // Re-arm first: a value sent from here on posts a new wake-up,
+                // so nothing queued during the drain can be missed. This must
+                // be a read-modify-write: a plain store could be ordered after
+                // the cell loads below, letting a producer still see `true`
+                // (and skip its wake-up) while we miss its value.
+                wake_pending_.exchange(false, std::memory_order_acq_rel);
+
+                // Whatever is left when we return, normally or because fn
+                // threw, gets another wake-up
+                struct rearm_guard {
+                    main_thread_channel& channel;
+
+                    ~rearm_guard() {
+                        if (!channel.empty() && !channel.wake_pending_.exchange(true, std::memory_order_acq_rel)) {
+                            channel.post_wake();
+                        }
+                    }
+                } rearm{*this};
+
+                // Releases the cell even if fn throws
+                struct release_guard {
+                    main_thread_channel& channel;
+                    cell& c;
+                    T* value;
+                    std::size_t pos;
+
+                    ~release_guard() {
+                        value->~T();
+                        c.sequence.store(pos + channel.mask_ + 1, std::memory_order_release);
+                        channel.head_.store(pos + 1, std::memory_order_relaxed);
+                    }
+                };
+
+                std::size_t pos = head_.load(std::memory_order_relaxed);
+                std::size_t count = 0;
+                while (count < max_items) {
+                    cell& c = cells_[pos & mask_];
+                    if (c.sequence.load(std::memory_order_acquire) != pos + 1) {
+                        break;
+                    }
+
+                    const release_guard release{*this, c, std::launder(reinterpret_cast <T*>(c.storage)), pos};
+                    ++pos;
+                    ++count;
+                    fn(std::move(*release.value));
+                }
+                return count;
+            }
+
+            /**
+             * @brief Move every queued value into a vector
+             * @return Number of values appended
+             */
+            std::size_t drain_into(std::vector <T>& out) {
+                return drain([&out](T&& value) { out.push_back(std::move(value)); });
+            }
+
+            // ================================================================
+            // Status
+            // ================================================================
+
+            [[nodiscard]] std::size_t capacity() const noexcept { return mask_ + 1; }
+
+            /**
+             * @brief Approximate number of queued values
+             */
+            [[nodiscard]] std::size_t size_approx() const noexcept {
+                const std::size_t tail = tail_.load(std::memory_order_relaxed);
+                const std::size_t head = head_.load(std::memory_order_relaxed);
+                return tail > head ? tail - head : 0;
+            }
+
+            [[nodiscard]] bool empty() const noexcept {
+                const cell& c = cells_[head_.load(std::memory_order_relaxed) & mask_];
+                return c.sequence.load(std::memory_order_acquire) != head_.load(std::memory_order_relaxed) + 1;
+            }
+
+            /**
+             * @brief Sends rejected because the channel was full
+             */
+            [[nodiscard]] std::uint64_t dropped() const noexcept {
+                return dropped_.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Wake-up events posted so far
+             */
+            [[nodiscard]] std::uint64_t wake_count() const noexcept {
+                return wakes_.load(std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] event_type wake_type() const noexcept {
+                return static_cast <event_type>(wake_type_);
+            }
+
+        private:
+            static constexpr std::size_t cache_line = 64;
+
+            struct cell {
+                std::atomic <std::size_t> sequence{0};
+                alignas(T) unsigned char storage[sizeof(T)];
+            };
+
+            void post_wake() noexcept {
+                SDL_Event e{};
+                e.type = wake_type_;
+                e.user.type = wake_type_;
+                e.user.timestamp = SDL_GetTicksNS();
+                e.user.data1 = const_cast <void*>(static_cast <const void*>(this));
+                if (SDL_PushEvent(&e)) {
+                    wakes_.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    // Queue full or filtered: let the next send try again
+                    wake_pending_.store(false, std::memory_order_release);
+                }
+            }
+
+            const std::size_t mask_;
+            std::unique_ptr <cell[]> cells_;
+            const Uint32 wake_type_;
+
+            alignas(cache_line) std::atomic <std::size_t> tail_{0};
+            alignas(cache_line) std::atomic <std::size_t> head_{0};
+            alignas(cache_line) std::atomic <bool> wake_pending_{false};
+            std::atomic <std::uint64_t> dropped_{0};
+            std::atomic <std::uint64_t> wakes_{0};
+    };
+} // namespace sdlpp
@@ -122,6 +122,13 @@ public:
     [[nodiscard]] bool is_valid() const noexcept { return m_valid; }
     explicit operator bool() const noexcept { return is_valid(); }
 
+    /**
+     * @brief Content hash of the loaded font data and face index.
+     *
+     * Stable across runs for the same file; used to validate saved caches.
+     */
+    [[nodiscard]] std::uint64_t identity() const noexcept { return m_identity; }
+
     /**
      * @brief Get font type (bitmap, vector, or outline).
      */
@@ -319,6 +326,7 @@ private:
     std::vector<std::uint8_t> m_data;  // Owned font data
     onyx_font::container_info m_container_info;
     float m_size = 12.0f;
+    std::uint64_t m_identity = 0;
     bool m_valid = false;
 
     // Union of possible font types
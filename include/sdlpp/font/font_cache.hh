@@ -4,14 +4,20 @@
 
 #pragma once
 
+#include <sdlpp/font/font.hh>
+#include <sdlpp/font/glyph_atlas.hh>
 #include <sdlpp/video/texture.hh>
 #include <sdlpp/video/renderer.hh>
 #include <sdlpp/video/color.hh>
 #include <sdlpp/detail/expected.hh>
 #include <failsafe/detail/string_utils.hh>
 
+#include <filesystem>
+#include <span>
+#include <string>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 #include <cstdint>
 #include <string_view>
 #include <tuple>
@@ -19,14 +25,11 @@
 
 namespace sdlpp::font {
 
-// Forward declaration
-class font;
-
 /**
- * @brief Cached glyph data (texture + metrics).
+ * @brief Cached glyph data (atlas location + metrics).
  */
 struct glyph_data {
-    texture tex;        ///< Glyph texture
+    atlas_slot slot;    ///< Glyph bitmap location in the cache atlas
     int offset_x = 0;   ///< X offset from pen position
     int offset_y = 0;   ///< Y offset from baseline
     int advance = 0;    ///< Horizontal advance to next glyph
@@ -34,10 +37,27 @@ struct glyph_data {
     int height = 0;     ///< Glyph height
 };
 
+/**
+ * @brief Usage counters for one (size, style) glyph set.
+ */
+struct glyph_set_stats {
+    float size = 0.0f;                      ///< Pixel size
+    text_style style = text_style::normal;  ///< Font style
+    std::size_t glyphs = 0;                 ///< Cached glyphs
+    std::size_t hits = 0;                   ///< Lookups served from the cache
+    std::size_t misses = 0;                 ///< Lookups that had to rasterize
+};
+
 /**
  * @brief Font cache for efficient repeated text rendering.
  *
- * Caches individual glyphs as textures and pre-rendered strings.
+ * Caches individual glyphs in shared atlas pages and pre-rendered strings.
+ *
+ * Glyphs are keyed by (codepoint, size, style). Overloads without a size
+ * use the font's current size and style, so changing the font between
+ * calls selects a different glyph set instead of mixing sizes. All sets
+ * share the same atlas pages. Bitmap fonts only have their native size,
+ * so every requested size maps to the one glyph set at native_size().
  *
  * @code
  * font_cache cache(renderer, my_font);
@@ -48,6 +68,9 @@ struct glyph_data {
  * // Render using cached glyphs
  * cache.render_text("Hello", 100, 100, colors::white);
  *
+ * // Other sizes share the same cache and atlas
+ * cache.render_text("Heading", 100, 40, colors::white, 32.0f);
+ *
  * // Cache entire strings for static text
  * auto id = cache.store_string("Score: 0");
  * cache.render_string(id, 10, 10);
@@ -117,6 +140,22 @@ public:
      */
     [[nodiscard]] SDLPP_EXPORT const glyph_data* find_glyph(char32_t codepoint) const;
 
+    /**
+     * @brief Get a glyph, caching it on demand.
+     *
+     * Counts a hit or miss in the statistics of the font's current size
+     * and style, as the render functions do.
+     *
+     * @return Pointer to glyph data, or nullptr if the glyph cannot be cached
+     */
+    SDLPP_EXPORT const glyph_data* get_glyph(char32_t codepoint);
+
+    /**
+     * @brief Get a glyph at a specific size and style, caching it on demand.
+     * @return Pointer to glyph data, or nullptr if the glyph cannot be cached
+     */
+    SDLPP_EXPORT const glyph_data* get_glyph(char32_t codepoint, float size, text_style style);
+
     /**
      * @brief Check if glyph is cached.
      */
@@ -124,6 +163,24 @@ public:
         return find_glyph(codepoint) != nullptr;
     }
 
+    /**
+     * @brief Pre-cache a glyph at a specific size and style.
+     * @return true if glyph was cached
+     */
+    SDLPP_EXPORT bool store_glyph(char32_t codepoint, float size, text_style style);
+
+    /**
+     * @brief Pre-cache a range of glyphs at a specific size and style.
+     */
+    SDLPP_EXPORT void store_glyphs(char32_t begin, char32_t end, float size, text_style style);
+
+    /**
+     * @brief Find a glyph cached at a specific size and style.
+     * @return Pointer to glyph data, or nullptr if not cached
+     */
+    [[nodiscard]] SDLPP_EXPORT const glyph_data* find_glyph(char32_t codepoint, float size,
+                                                            text_style style) const;
+
     // ========================================================================
     // String Caching
     // ========================================================================
@@ -168,6 +225,13 @@ public:
      */
     SDLPP_EXPORT int render_glyph(char32_t codepoint, int x, int y, const color& fg);
 
+    /**
+     * @brief Render a single glyph at a specific size.
+     * @return X position for next glyph, or x if glyph not found
+     */
+    SDLPP_EXPORT int render_glyph(char32_t codepoint, int x, int y, const color& fg,
+                                  float size, text_style style);
+
     /**
      * @brief Render text using cached glyphs.
      *
@@ -195,6 +259,29 @@ public:
             fg);
     }
 
+    /**
+     * @brief Render text at a pixel size using the font's current style.
+     * @return Width of rendered text
+     */
+    SDLPP_EXPORT int render_text(std::string_view text, int x, int y, const color& fg, float size);
+
+    /**
+     * @brief Render text at a pixel size and style.
+     * @return Width of rendered text
+     */
+    SDLPP_EXPORT int render_text(std::string_view text, int x, int y, const color& fg,
+                                 float size, text_style style);
+
+    /**
+     * @brief Line height of the cached font in whole pixels.
+     */
+    [[nodiscard]] SDLPP_EXPORT int line_height() const;
+
+    /**
+     * @brief Line height at a specific size and style.
+     */
+    [[nodiscard]] SDLPP_EXPORT int line_height(float size, text_style style);
+
     /**
      * @brief Render a cached string.
      * @param id String ID from store_string()
@@ -226,20 +313,118 @@ public:
     }
 
     /**
-     * @brief Get number of cached glyphs.
+     * @brief Get number of cached glyphs (all sizes).
+     */
+    [[nodiscard]] SDLPP_EXPORT std::size_t glyph_count() const noexcept;
+
+    /**
+     * @brief Per-size usage counters, one entry per glyph set.
      */
-    [[nodiscard]] std::size_t glyph_count() const noexcept { return m_glyphs.size(); }
+    [[nodiscard]] SDLPP_EXPORT std::vector<glyph_set_stats> statistics() const;
+
+    /**
+     * @brief Reset hit/miss counters of every glyph set.
+     */
+    SDLPP_EXPORT void reset_statistics() noexcept;
 
     /**
      * @brief Get number of cached strings.
      */
     [[nodiscard]] std::size_t string_count() const noexcept { return m_strings.size(); }
 
+    // ========================================================================
+    // Snapshots
+    // ========================================================================
+
+    /**
+     * @brief Serialize cached glyphs (atlas pages + metrics) to a byte buffer.
+     *
+     * Layout is fixed-offset and little-endian: a 64-byte header, a table of
+     * glyph records, then raw 8-bit atlas pages aligned to 64 bytes. A mapped
+     * file can therefore be handed directly to load_snapshot().
+     *
+     * Cached strings are not included.
+     */
+    [[nodiscard]] SDLPP_EXPORT std::vector<std::uint8_t> save_snapshot() const;
+
+    /**
+     * @brief Write a snapshot to a file.
+     * @return Expected<void> - empty on success, error message on failure
+     */
+    SDLPP_EXPORT expected<void, std::string> save_snapshot(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Replace cached glyphs with a snapshot.
+     *
+     * Fails without touching the cache if the snapshot was produced for a
+     * different font file. Every glyph set in the snapshot is restored,
+     * whatever the font's current size. Page textures are uploaded
+     * immediately so the first frame does not stall.
+     *
+     * @param data Snapshot bytes (e.g. a memory-mapped file)
+     * @return Expected<void> - empty on success, error message on failure
+     */
+    SDLPP_EXPORT expected<void, std::string> load_snapshot(std::span<const std::uint8_t> data);
+
+    /**
+     * @brief Load a snapshot file.
+     * @return Expected<void> - empty on success, error message on failure
+     */
+    SDLPP_EXPORT expected<void, std::string> load_snapshot(const std::filesystem::path& path);
+
+    // ========================================================================
+    // Atlas Access
+    // ========================================================================
+
+    /**
+     * @brief Glyph atlas holding the coverage of every cached glyph.
+     */
+    [[nodiscard]] const glyph_atlas& atlas() const noexcept { return m_atlas; }
+
+    /**
+     * @brief Get the texture for an atlas page, uploading pending glyphs first.
+     * @return Page texture, or nullptr on failure
+     */
+    [[nodiscard]] SDLPP_EXPORT texture* page_texture(int page);
+
+    /**
+     * @brief Renderer this cache draws with.
+     */
+    [[nodiscard]] renderer& get_renderer() const noexcept { return *m_renderer; }
+
+    /**
+     * @brief Font this cache rasterizes from.
+     */
+    [[nodiscard]] font& get_font() const noexcept { return *m_font; }
+
 private:
+    struct page_entry {
+        texture tex;
+        std::uint64_t revision = 0;
+    };
+
+    struct glyph_set {
+        float size = 0.0f;
+        text_style style = text_style::normal;
+        int line_height = 0;
+        std::unordered_map<char32_t, glyph_data> glyphs;
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+    };
+
+    [[nodiscard]] static std::uint64_t set_key(float size, text_style style) noexcept;
+    [[nodiscard]] float set_size(float size) const;
+    [[nodiscard]] const glyph_set* find_set(float size, text_style style) const;
+    glyph_set& get_set(float size, text_style style);
+    bool store_glyph(glyph_set& set, char32_t codepoint);
+    const glyph_data* lookup(glyph_set& set, char32_t codepoint);
+
     renderer* m_renderer;
     font* m_font;
 
-    std::unordered_map<char32_t, glyph_data> m_glyphs;
+    glyph_atlas m_atlas;
+    std::vector<page_entry> m_pages;
+    std::unordered_map<std::uint64_t, glyph_set> m_sets;
     std::unordered_map<string_id, texture> m_strings;
     string_id m_next_string_id = 1;
 };
@@ -0,0 +1,160 @@
+//
+// Glyph atlas for SDL++
+//
+
+#pragma once
+
+#include <sdlpp/video/texture.hh>
+#include <sdlpp/video/renderer.hh>
+#include <sdlpp/detail/expected.hh>
+#include <sdlpp/detail/export.hh>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sdlpp::font {
+
+/**
+ * @brief Location of a glyph bitmap inside a glyph_atlas.
+ */
+struct atlas_slot {
+    int page = -1;      ///< Atlas page index, -1 if not allocated
+    int x = 0;          ///< Left edge on the page (texels)
+    int y = 0;          ///< Top edge on the page (texels)
+    int width = 0;      ///< Width in texels
+    int height = 0;     ///< Height in texels
+
+    [[nodiscard]] bool valid() const noexcept { return page >= 0; }
+};
+
+/**
+ * @brief Single-channel glyph atlas with shelf packing.
+ *
+ * Keeps 8-bit pages in system memory; each texel is either glyph coverage
+ * or an encoded distance value. Pages are uploaded to white RGBA textures
+ * on demand, optionally remapping every byte through an alpha lookup table.
+ *
+ * Each page carries a revision counter that is bumped on every write, so
+ * owners of page textures know when they are stale.
+ *
+ * @code
+ * glyph_atlas atlas;
+ * auto slot = atlas.allocate(w, h);
+ * atlas.write(slot, bitmap.data(), w);
+ * auto tex = atlas.make_texture(renderer, slot.page);
+ * @endcode
+ */
+class glyph_atlas {
+public:
+    /// Maps a stored byte to the alpha written into the page texture.
+    using alpha_lut = std::array<std::uint8_t, 256>;
+
+    static constexpr int default_page_size = 512;
+
+    /**
+     * @brief Create an empty atlas.
+     * @param page_width Width of every page in texels
+     * @param page_height Height of every page in texels
+     * @param padding Empty texels kept between neighbouring slots
+     */
+    SDLPP_EXPORT explicit glyph_atlas(int page_width = default_page_size,
+                                      int page_height = default_page_size,
+                                      int padding = 1);
+
+    // ========================================================================
+    // Packing
+    // ========================================================================
+
+    /**
+     * @brief Reserve a rectangle on the current page, opening a new page if needed.
+     * @return Slot, or an invalid slot if the size exceeds a page
+     */
+    [[nodiscard]] SDLPP_EXPORT atlas_slot allocate(int width, int height);
+
+    /**
+     * @brief Copy a bitmap into a previously allocated slot.
+     * @param slot Destination slot
+     * @param src Source bytes (slot.width x slot.height)
+     * @param src_pitch Bytes per source row
+     */
+    SDLPP_EXPORT void write(const atlas_slot& slot, const std::uint8_t* src, int src_pitch);
+
+    /**
+     * @brief Append a fully packed page from existing bytes.
+     *
+     * Used to restore saved atlases; later allocations start on a new page.
+     *
+     * @param pixels page_width() * page_height() bytes
+     * @return Index of the new page
+     */
+    SDLPP_EXPORT int append_page(const std::uint8_t* pixels);
+
+    /**
+     * @brief Drop all pages.
+     */
+    SDLPP_EXPORT void clear();
+
+    // ========================================================================
+    // Page Access
+    // ========================================================================
+
+    [[nodiscard]] int page_count() const noexcept { return static_cast<int>(m_pages.size()); }
+    [[nodiscard]] int page_width() const noexcept { return m_page_width; }
+    [[nodiscard]] int page_height() const noexcept { return m_page_height; }
+
+    /**
+     * @brief Bytes per page row (pages are tightly packed).
+     */
+    [[nodiscard]] int pitch() const noexcept { return m_page_width; }
+
+    /**
+     * @brief Raw page bytes, or nullptr if the page does not exist.
+     */
+    [[nodiscard]] SDLPP_EXPORT const std::uint8_t* page_pixels(int page) const;
+
+    /**
+     * @brief Revision of a page; changes whenever the page is written.
+     */
+    [[nodiscard]] SDLPP_EXPORT std::uint64_t page_revision(int page) const;
+
+    // ========================================================================
+    // Texture Upload
+    // ========================================================================
+
+    /**
+     * @brief Create a blendable texture holding a page.
+     * @param renderer Renderer that will draw the texture
+     * @param page Page index
+     * @param lut Optional byte-to-alpha mapping (identity if nullptr)
+     */
+    [[nodiscard]] SDLPP_EXPORT expected<texture, std::string> make_texture(
+        renderer& renderer, int page, const alpha_lut* lut = nullptr) const;
+
+    /**
+     * @brief Re-upload a page into a texture created by make_texture().
+     */
+    SDLPP_EXPORT expected<void, std::string> upload(
+        texture& tex, int page, const alpha_lut* lut = nullptr) const;
+
+private:
+    struct page_data {
+        std::vector<std::uint8_t> pixels;
+        std::uint64_t revision = 0;
+        int shelf_y = 0;        // Top of the open shelf
+        int shelf_height = 0;   // Tallest slot on the open shelf
+        int cursor_x = 0;       // Next free column on the open shelf
+    };
+
+    void add_page();
+
+    int m_page_width;
+    int m_page_height;
+    int m_padding;
+    std::vector<page_data> m_pages;
+    std::uint64_t m_revision = 0;
+    mutable std::vector<std::uint8_t> m_upload;
+};
+
+} // namespace sdlpp::font
@@ -0,0 +1,224 @@
+//
+// Signed distance field glyph cache for SDL++
+//
+
+#pragma once
+
+#include <sdlpp/font/glyph_atlas.hh>
+#include <sdlpp/video/texture.hh>
+#include <sdlpp/video/renderer.hh>
+#include <sdlpp/video/surface_renderer.hh>
+#include <sdlpp/video/color.hh>
+#include <sdlpp/detail/export.hh>
+
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+namespace sdlpp::font {
+
+// Forward declaration
+class font;
+
+/**
+ * @brief Distance field glyph entry (metrics in reference-size pixels).
+ */
+struct sdf_glyph {
+    atlas_slot slot;        ///< Field location in the atlas
+    float left = 0.0f;      ///< Left edge of the field box relative to the pen
+    float top = 0.0f;       ///< Top edge of the field box relative to the line top
+    float advance = 0.0f;   ///< Horizontal advance to next glyph
+};
+
+/**
+ * @brief Scale-independent glyph cache built on signed distance fields.
+ *
+ * Each glyph is rasterized once at a reference size and converted into a
+ * distance field stored in a shared glyph_atlas. Text can then be drawn at
+ * any pixel size without touching the font again.
+ *
+ * The hardware renderer has no programmable shading, so the threshold is
+ * baked when a page is uploaded: sizes are grouped into half-octave zoom
+ * bands, each with its own copy of the page remapped through a smoothstep
+ * lookup. Zooming across a band boundary costs one page upload, never a
+ * glyph rasterization. The software path thresholds every pixel exactly.
+ *
+ * Output is sharpest at or below the reference size; pick a reference size
+ * close to the largest size you expect to draw.
+ *
+ * @code
+ * sdf_font_cache cache(renderer, my_font);
+ * cache.store_basic_latin();
+ *
+ * // Any size, same cached glyphs
+ * cache.render_text("Zoom", 10.0f, 10.0f, 12.0f * zoom, colors::white);
+ *
+ * // Software target
+ * surface_renderer sw(canvas);
+ * cache.render_text(sw, "Zoom", 10, 10, 18.0f, colors::black);
+ * @endcode
+ */
+class sdf_font_cache {
+public:
+    static constexpr float default_reference_size = 64.0f;
+    static constexpr int default_spread = 8;
+
+    /**
+     * @brief Create an SDF cache.
+     * @param renderer Renderer for page textures
+     * @param fnt Font to build fields from
+     * @param reference_size Pixel size glyphs are rasterized at
+     * @param spread Distance (in reference pixels) encoded on each side of an edge
+     */
+    SDLPP_EXPORT sdf_font_cache(renderer& renderer, font& fnt,
+                                float reference_size = default_reference_size,
+                                int spread = default_spread);
+
+    /**
+     * @brief Destructor.
+     */
+    SDLPP_EXPORT ~sdf_font_cache();
+
+    // Move-only
+    sdf_font_cache(const sdf_font_cache&) = delete;
+    sdf_font_cache& operator=(const sdf_font_cache&) = delete;
+    SDLPP_EXPORT sdf_font_cache(sdf_font_cache&&) noexcept;
+    SDLPP_EXPORT sdf_font_cache& operator=(sdf_font_cache&&) noexcept;
+
+    // ========================================================================
+    // Glyph Caching
+    // ========================================================================
+
+    /**
+     * @brief Build and cache the distance field of a glyph.
+     * @param codepoint Unicode codepoint
+     * @return true if glyph was cached
+     */
+    SDLPP_EXPORT bool store_glyph(char32_t codepoint);
+
+    /**
+     * @brief Pre-cache a range of glyphs.
+     * @param begin First codepoint (inclusive)
+     * @param end Last codepoint (exclusive)
+     */
+    SDLPP_EXPORT void store_glyphs(char32_t begin, char32_t end);
+
+    /**
+     * @brief Pre-cache Basic Latin characters (U+0020 to U+007E).
+     */
+    void store_basic_latin() { store_glyphs(0x0020, 0x007F); }
+
+    /**
+     * @brief Find a cached glyph.
+     * @return Pointer to glyph data, or nullptr if not cached
+     */
+    [[nodiscard]] SDLPP_EXPORT const sdf_glyph* find_glyph(char32_t codepoint) const;
+
+    /**
+     * @brief Check if glyph is cached.
+     */
+    [[nodiscard]] bool has_glyph(char32_t codepoint) const {
+        return find_glyph(codepoint) != nullptr;
+    }
+
+    // ========================================================================
+    // Rendering
+    // ========================================================================
+
+    /**
+     * @brief Render text at an arbitrary pixel size.
+     *
+     * Glyphs are cached on-demand; consecutive glyphs on the same atlas page
+     * are submitted with a single render_geometry() call.
+     *
+     * @param text UTF-8 text
+     * @param x X position
+     * @param y Y position (top of text, not baseline)
+     * @param size Pixel size to draw at
+     * @param fg Text color
+     * @return Width of rendered text
+     */
+    SDLPP_EXPORT float render_text(std::string_view text, float x, float y,
+                                   float size, const color& fg);
+
+    /**
+     * @brief Render text into a software surface renderer.
+     *
+     * Samples the distance field per destination pixel and thresholds it
+     * exactly, so edges stay crisp at every size.
+     *
+     * @param target Software renderer to draw into
+     * @param text UTF-8 text
+     * @param x X position
+     * @param y Y position (top of text, not baseline)
+     * @param size Pixel size to draw at
+     * @param fg Text color
+     * @return Width of rendered text
+     */
+    SDLPP_EXPORT float render_text(surface_renderer& target, std::string_view text,
+                                   int x, int y, float size, const color& fg);
+
+    /**
+     * @brief Measure the advance width of text at a pixel size.
+     */
+    [[nodiscard]] SDLPP_EXPORT float measure(std::string_view text, float size);
+
+    /**
+     * @brief Line height at a pixel size.
+     */
+    [[nodiscard]] float line_height(float size) const noexcept {
+        return m_line_height * size / m_reference_size;
+    }
+
+    // ========================================================================
+    // Cache Management
+    // ========================================================================
+
+    /**
+     * @brief Clear all cached glyphs and page textures.
+     */
+    SDLPP_EXPORT void clear();
+
+    /**
+     * @brief Get number of cached glyphs.
+     */
+    [[nodiscard]] std::size_t glyph_count() const noexcept { return m_glyphs.size(); }
+
+    /**
+     * @brief Get number of page textures currently resident (all zoom bands).
+     */
+    [[nodiscard]] SDLPP_EXPORT std::size_t texture_count() const noexcept;
+
+    [[nodiscard]] float reference_size() const noexcept { return m_reference_size; }
+    [[nodiscard]] int spread() const noexcept { return m_spread; }
+    [[nodiscard]] const glyph_atlas& atlas() const noexcept { return m_atlas; }
+
+private:
+    struct band_page {
+        texture tex;
+        std::uint64_t revision = 0;
+    };
+
+    const sdf_glyph* ensure_glyph(char32_t codepoint);
+    texture* page_texture(int page, float scale);
+    void flush_quads(texture* tex);
+
+    renderer* m_renderer;
+    font* m_font;
+    float m_reference_size;
+    int m_spread;
+    float m_ascent = 0.0f;
+    float m_line_height = 0.0f;
+
+    glyph_atlas m_atlas;
+    std::unordered_map<char32_t, sdf_glyph> m_glyphs;
+    std::unordered_map<int, std::vector<band_page>> m_bands;
+
+    // Scratch buffers reused between calls
+    std::vector<SDL_Vertex> m_vertices;
+    std::vector<int> m_indices;
+    std::vector<std::uint8_t> m_mask;
+};
+
+} // namespace sdlpp::font
@@ -117,4 +117,54 @@ private:
 static_assert(onyx_font::raster_target<surface_raster_target>);
 static_assert(onyx_font::raster_target_with_span<surface_raster_target>);
 
+/**
+ * @brief Raster target that collects glyph coverage into an 8-bit buffer.
+ *
+ * Overlapping writes keep the maximum coverage. Used to fill glyph atlas
+ * slots, where color is applied later through texture or vertex modulation.
+ */
+class coverage_raster_target {
+public:
+    /**
+     * @brief Construct target over a tightly packed byte buffer.
+     * @param pixels Buffer of at least width * height bytes
+     * @param width Buffer width
+     * @param height Buffer height
+     */
+    coverage_raster_target(std::uint8_t* pixels, int width, int height)
+        : m_pixels(pixels)
+        , m_width(width)
+        , m_height(height) {}
+
+    void put_pixel(int x, int y, std::uint8_t alpha) {
+        if (x < 0 || x >= m_width || y < 0 || y >= m_height) {
+            return;
+        }
+        std::uint8_t& dst = m_pixels[y * m_width + x];
+        dst = std::max(dst, alpha);
+    }
+
+    void put_span(int x, int y, const std::uint8_t* alphas, int count) {
+        if (y < 0 || y >= m_height) return;
+
+        int x0 = std::max(0, x);
+        int x1 = std::min(m_width, x + count);
+
+        for (int px = x0; px < x1; ++px) {
+            put_pixel(px, y, alphas[px - x]);
+        }
+    }
+
+    [[nodiscard]] int width() const noexcept { return m_width; }
+    [[nodiscard]] int height() const noexcept { return m_height; }
+
+private:
+    std::uint8_t* m_pixels;
+    int m_width;
+    int m_height;
+};
+
+static_assert(onyx_font::raster_target<coverage_raster_target>);
+static_assert(onyx_font::raster_target_with_span<coverage_raster_target>);
+
 } // namespace sdlpp::font
@@ -0,0 +1,164 @@
+//
+// Frame-level text batching for SDL++
+//
+
+#pragma once
+
+#include <sdlpp/font/font_cache.hh>
+#include <sdlpp/video/renderer.hh>
+#include <sdlpp/video/color.hh>
+#include <sdlpp/detail/expected.hh>
+#include <failsafe/detail/string_utils.hh>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace sdlpp::font {
+
+/**
+ * @brief Collects text from a whole frame and submits it in a few draw calls.
+ *
+ * Each add() lays out its glyphs immediately (caching them on demand) and
+ * queues one quad per glyph, clipped on the CPU. flush() groups the quads
+ * by atlas page and issues one render_geometry() call per page, so the
+ * number of submissions depends on the number of pages in use, not on the
+ * number of strings.
+ *
+ * Quads on the same page keep their submission order; text on different
+ * pages may be reordered, so overlapping labels that must stack in a
+ * specific order should be flushed separately.
+ *
+ * Vertex and index buffers are kept between frames, so a steady workload
+ * does not allocate after the first flush.
+ *
+ * @code
+ * font_cache cache(renderer, my_font);
+ * text_batch batch(cache);
+ *
+ * for (const auto& cell : visible_cells) {
+ *     batch.add(cell.text, cell.x, cell.y, colors::white, cell.bounds);
+ * }
+ * batch.flush();
+ * @endcode
+ *
+ * @note The batch refers to the cache by address; do not move or clear
+ *       the cache while entries are queued.
+ */
+class text_batch {
+public:
+    /**
+     * @brief Create a batch drawing glyphs from a cache.
+     * @param cache Glyph cache (must outlive the batch)
+     */
+    SDLPP_EXPORT explicit text_batch(font_cache& cache);
+
+    /**
+     * @brief Destructor. Queued entries are discarded, not drawn.
+     */
+    SDLPP_EXPORT ~text_batch();
+
+    // Move-only
+    text_batch(const text_batch&) = delete;
+    text_batch& operator=(const text_batch&) = delete;
+    SDLPP_EXPORT text_batch(text_batch&&) noexcept;
+    SDLPP_EXPORT text_batch& operator=(text_batch&&) noexcept;
+
+    // ========================================================================
+    // Queueing
+    // ========================================================================
+
+    /**
+     * @brief Queue text for the next flush.
+     * @param text UTF-8 text
+     * @param x X position
+     * @param y Y position (top of text, not baseline)
+     * @param fg Text color
+     * @param clip Optional clip rectangle in render coordinates
+     * @return Width of the text (unclipped)
+     */
+    SDLPP_EXPORT int add(std::string_view text, int x, int y, const color& fg,
+                         const std::optional<rect<int>>& clip = std::nullopt);
+
+    /**
+     * @brief Queue text at a pixel size using the font's current style.
+     * @param size Pixel size; glyphs for it are cached on demand
+     * @return Width of the text (unclipped)
+     */
+    SDLPP_EXPORT int add(std::string_view text, int x, int y, const color& fg, float size,
+                         const std::optional<rect<int>>& clip = std::nullopt);
+
+    template<typename... Args>
+    requires ((sizeof...(Args) > 0)
+              && !(sizeof...(Args) == 1
+                   && std::is_convertible_v<std::remove_cvref_t<
+                          std::tuple_element_t<0, std::tuple<Args...>>>,
+                      std::string_view>))
+    int add(int x, int y, const color& fg, Args&&... args) {
+        return add(
+            failsafe::detail::build_message(std::forward<Args>(args)...),
+            x,
+            y,
+            fg);
+    }
+
+    // ========================================================================
+    // Submission
+    // ========================================================================
+
+    /**
+     * @brief Draw all queued text and reset the queue.
+     * @return Expected<void> - empty on success, error message on failure
+     */
+    SDLPP_EXPORT expected<void, std::string> flush();
+
+    /**
+     * @brief Drop queued text without drawing it.
+     */
+    SDLPP_EXPORT void clear();
+
+    // ========================================================================
+    // Statistics
+    // ========================================================================
+
+    [[nodiscard]] bool empty() const noexcept { return m_quad_count == 0; }
+
+    /**
+     * @brief Number of add() calls since the last flush.
+     */
+    [[nodiscard]] std::size_t entry_count() const noexcept { return m_entry_count; }
+
+    /**
+     * @brief Number of glyph quads queued.
+     */
+    [[nodiscard]] std::size_t quad_count() const noexcept { return m_quad_count; }
+
+    /**
+     * @brief render_geometry() calls issued by the last flush.
+     */
+    [[nodiscard]] std::size_t last_draw_calls() const noexcept { return m_last_draw_calls; }
+
+private:
+    struct quad {
+        float x0, y0, x1, y1;   // Screen rectangle
+        float u0, v0, u1, v1;   // Texture rectangle (normalized)
+        color fg;
+    };
+
+    font_cache* m_cache;
+
+    // Quads bucketed by atlas page; inner vectors keep their capacity
+    std::vector<std::vector<quad>> m_pages;
+    std::vector<SDL_Vertex> m_vertices;
+    std::vector<int> m_indices;
+
+    std::size_t m_entry_count = 0;
+    std::size_t m_quad_count = 0;
+    std::size_t m_last_draw_calls = 0;
+};
+
+} // namespace sdlpp::font
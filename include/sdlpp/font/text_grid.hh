@@ -0,0 +1,243 @@
+//
+// Fixed-grid text renderer for SDL++
+//
+
+#pragma once
+
+#include <sdlpp/font/font_cache.hh>
+#include <sdlpp/video/texture.hh>
+#include <sdlpp/video/renderer.hh>
+#include <sdlpp/video/color.hh>
+#include <sdlpp/detail/expected.hh>
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sdlpp::font {
+
+/**
+ * @brief Per-cell text attributes.
+ */
+enum class cell_attr : std::uint8_t {
+    none = 0,
+    bold = 1 << 0,        ///< Glyph drawn twice, one pixel apart
+    underline = 1 << 1,   ///< Line under the glyph in the foreground color
+    inverse = 1 << 2,     ///< Foreground and background swapped
+};
+
+[[nodiscard]] inline constexpr cell_attr operator|(cell_attr a, cell_attr b) noexcept {
+    return static_cast<cell_attr>(static_cast<std::uint8_t>(a) | static_cast<std::uint8_t>(b));
+}
+
+[[nodiscard]] inline constexpr cell_attr operator&(cell_attr a, cell_attr b) noexcept {
+    return static_cast<cell_attr>(static_cast<std::uint8_t>(a) & static_cast<std::uint8_t>(b));
+}
+
+inline constexpr cell_attr& operator|=(cell_attr& a, cell_attr b) noexcept {
+    return a = a | b;
+}
+
+/**
+ * @brief Content of one grid cell.
+ */
+struct grid_cell {
+    char32_t codepoint = U' ';
+    color fg = colors::white;
+    color bg = colors::black;
+    cell_attr attrs = cell_attr::none;
+
+    [[nodiscard]] bool operator==(const grid_cell&) const = default;
+};
+
+/**
+ * @brief Terminal-style renderer for monospaced text on a fixed grid.
+ *
+ * Keeps a cell buffer and a render-target texture holding the last drawn
+ * state. Writes only mark cells whose content actually changed; update()
+ * redraws those cells into the target with one background pass and one
+ * glyph pass per atlas page, and render() blits the whole target.
+ *
+ * Rows are stored as a ring: scrolling moves the index of the top row
+ * instead of the cells, so only the exposed rows are redrawn and render()
+ * blits the target in two pieces.
+ *
+ * Cell size comes from the cache: the advance of 'M' by the font's line
+ * height. Glyphs are clipped to their cell so a redraw never touches
+ * neighbouring cells.
+ *
+ * @code
+ * font_cache cache(renderer, console_font);
+ * text_grid grid(cache, 200, 60);
+ *
+ * grid.write(0, 0, "Build finished", colors::green, colors::black);
+ * grid.scroll_up(1, colors::black);
+ * grid.render(0, 0);  // Redraws only what changed
+ * @endcode
+ */
+class text_grid {
+public:
+    /**
+     * @brief Create a grid.
+     * @param cache Glyph cache for the grid font (must outlive the grid)
+     * @param columns Number of columns
+     * @param rows Number of rows
+     */
+    SDLPP_EXPORT text_grid(font_cache& cache, int columns, int rows);
+
+    /**
+     * @brief Destructor.
+     */
+    SDLPP_EXPORT ~text_grid();
+
+    // Move-only
+    text_grid(const text_grid&) = delete;
+    text_grid& operator=(const text_grid&) = delete;
+    SDLPP_EXPORT text_grid(text_grid&&) noexcept;
+    SDLPP_EXPORT text_grid& operator=(text_grid&&) noexcept;
+
+    // ========================================================================
+    // Geometry
+    // ========================================================================
+
+    [[nodiscard]] int columns() const noexcept { return m_columns; }
+    [[nodiscard]] int rows() const noexcept { return m_rows; }
+    [[nodiscard]] int cell_width() const noexcept { return m_cell_width; }
+    [[nodiscard]] int cell_height() const noexcept { return m_cell_height; }
+
+    /**
+     * @brief Change the grid size, keeping the overlapping cells.
+     */
+    SDLPP_EXPORT void resize(int columns, int rows);
+
+    // ========================================================================
+    // Cell Access
+    // ========================================================================
+
+    /**
+     * @brief Get a cell (out-of-range positions return a blank cell).
+     */
+    [[nodiscard]] SDLPP_EXPORT grid_cell get(int column, int row) const;
+
+    /**
+     * @brief Set a single cell.
+     */
+    SDLPP_EXPORT void set(int column, int row, const grid_cell& cell);
+
+    /**
+     * @brief Write UTF-8 text starting at a cell, clipped at the row end.
+     * @return Number of cells written
+     */
+    SDLPP_EXPORT int write(int column, int row, std::string_view text,
+                           const color& fg, const color& bg,
+                           cell_attr attrs = cell_attr::none);
+
+    /**
+     * @brief Replace cells of a row starting at a column.
+     * @param row Row index
+     * @param cells New cell contents (clipped at the row end)
+     * @param column First column to write
+     */
+    SDLPP_EXPORT void write_row(int row, std::span<const grid_cell> cells, int column = 0);
+
+    /**
+     * @brief Fill a run of cells in a row with the same cell.
+     */
+    SDLPP_EXPORT void fill(int column, int row, int count, const grid_cell& cell);
+
+    /**
+     * @brief Blank every cell with a background color.
+     */
+    SDLPP_EXPORT void clear(const color& bg = colors::black);
+
+    /**
+     * @brief Move all rows up, blanking the rows exposed at the bottom.
+     *
+     * Only the exposed rows are marked dirty.
+     */
+    SDLPP_EXPORT void scroll_up(int lines, const color& bg = colors::black);
+
+    // ========================================================================
+    // Rendering
+    // ========================================================================
+
+    /**
+     * @brief Redraw dirty cells into the cached target texture.
+     * @return Expected<void> - empty on success, error message on failure
+     */
+    SDLPP_EXPORT expected<void, std::string> update();
+
+    /**
+     * @brief Update, then copy the grid to the current render target.
+     * @param x Destination X
+     * @param y Destination Y
+     * @return Expected<void> - empty on success, error message on failure
+     */
+    SDLPP_EXPORT expected<void, std::string> render(int x, int y);
+
+    /**
+     * @brief Force a full redraw on the next update.
+     */
+    SDLPP_EXPORT void invalidate();
+
+    /**
+     * @brief Cached target texture (valid after the first update()).
+     */
+    [[nodiscard]] const texture& target() const noexcept { return m_target; }
+
+    // ========================================================================
+    // Statistics
+    // ========================================================================
+
+    /**
+     * @brief Cells waiting to be redrawn.
+     */
+    [[nodiscard]] std::size_t dirty_cells() const noexcept { return m_dirty_count; }
+
+    /**
+     * @brief Cells redrawn by the last update().
+     */
+    [[nodiscard]] std::size_t last_redrawn_cells() const noexcept { return m_last_redrawn; }
+
+private:
+    // Storage position of a cell on a grid row (rows are rotated by m_top)
+    [[nodiscard]] std::size_t index(int column, int row) const noexcept {
+        return storage_index(column, (row + m_top) % m_rows);
+    }
+
+    // Storage rows match the rows of the target texture
+    [[nodiscard]] std::size_t storage_index(int column, int storage_row) const noexcept {
+        return static_cast<std::size_t>(storage_row) * static_cast<std::size_t>(m_columns)
+               + static_cast<std::size_t>(column);
+    }
+
+    void assign(std::size_t idx, const grid_cell& cell);
+    void mark_all_dirty();
+    expected<void, std::string> ensure_target();
+    void add_rect(std::vector<SDL_Vertex>& vertices, float x0, float y0, float x1, float y1, const color& c);
+
+    font_cache* m_cache;
+    int m_columns;
+    int m_rows;
+    int m_cell_width = 0;
+    int m_cell_height = 0;
+    int m_top = 0;                            // Storage row shown as grid row 0
+
+    std::vector<grid_cell> m_cells;           // Storage order
+    std::vector<std::uint8_t> m_dirty;        // Per cell
+    std::vector<std::uint8_t> m_dirty_rows;   // Per storage row, set if any cell is dirty
+    std::size_t m_dirty_count = 0;
+    std::size_t m_last_redrawn = 0;
+
+    texture m_target;
+
+    // Scratch buffers reused between updates
+    std::vector<SDL_Vertex> m_fill_vertices;
+    std::vector<std::vector<SDL_Vertex>> m_glyph_vertices;  // Per atlas page
+    std::vector<SDL_Vertex> m_line_vertices;
+    std::vector<int> m_indices;
+};
+
+} // namespace sdlpp::font
@@ -0,0 +1,489 @@
+#pragma once
+
+/**
+ * @file input_snapshot.hh
+ * @brief Frame-coherent keyboard, mouse and gamepad button snapshots
+ *
+ * keyboard_state and get_mouse_state() read SDL's live state, which keeps
+ * changing while a frame is being processed and does not say what changed
+ * since the previous frame. input_tracker folds input events into packed
+ * bitmaps and, once per frame, publishes an immutable input_snapshot with:
+ *
+ * - down: buttons currently held
+ * - pressed: buttons that went down during the frame
+ * - released: buttons that went up during the frame
+ * - held: buttons down in both this and the previous frame
+ *
+ * Edges are computed with word-wide AND/XOR over the bitmaps (512 keyboard
+ * scancodes fit in eight 64-bit words), and a press and release inside the
+ * same frame is reported as both pressed and released rather than lost.
+ * Iteration visits set bits only, so walking the changed keys costs one
+ * step per change rather than one per scancode.
+ *
+ * @code
+ * sdlpp::input_tracker input;
+ *
+ * // Event loop
+ * while (auto e = sdlpp::event_queue::poll()) {
+ *     input.process(e->raw());
+ * }
+ * const auto& snap = input.next_frame();
+ *
+ * if (snap.key_pressed(sdlpp::scancode::space)) {
+ *     jump();
+ * }
+ * snap.for_each_changed_key([](sdlpp::scancode sc) { log_key(sc); });
+ * @endcode
+ */
+
+#include <sdlpp/core/sdl.hh>
+#include <sdlpp/events/keyboard_codes.hh>
+#include <sdlpp/events/mouse_codes.hh>
+#include <sdlpp/input/gamepad.hh>
+#include <sdlpp/detail/export.hh>
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+
+namespace sdlpp {
+    /**
+     * @brief Fixed-size bitmap packed into 64-bit words
+     * @tparam Bits Number of bits
+     *
+     * Bitwise operators work a word at a time; the loops have a fixed trip
+     * count, so compilers turn them into vector instructions.
+     */
+    template<std::size_t Bits>
+    class packed_bitset {
+        public:
+            using word_type = std::uint64_t;
+            static constexpr std::size_t bit_count = Bits;
+            static constexpr std::size_t word_bits = 64;
+            static constexpr std::size_t word_count = (Bits + word_bits - 1) / word_bits;
+
+            /**
+             * @brief Forward iterator over the indices of set bits
+             */
+            class iterator {
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = std::size_t;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = void;
+                    using reference = std::size_t;
+
+                    constexpr iterator() noexcept = default;
+
+                    constexpr iterator(const packed_bitset* bits, std::size_t word) noexcept
+                        : bits_(bits), word_(word) {
+                        load();
+                    }
+
+                    constexpr std::size_t operator*() const noexcept {
+                        return word_ * word_bits + static_cast <std::size_t>(std::countr_zero(current_));
+                    }
+
+                    constexpr iterator& operator++() noexcept {
+                        current_ &= current_ - 1;
+                        if (current_ == 0) {
+                            ++word_;
+                            load();
+                        }
+                        return *this;
+                    }
+
+                    constexpr iterator operator++(int) noexcept {
+                        auto tmp = *this;
+                        ++*this;
+                        return tmp;
+                    }
+
+                    constexpr bool operator==(const iterator& other) const noexcept {
+                        return word_ == other.word_ && current_ == other.current_;
+                    }
+
+                private:
+                    constexpr void load() noexcept {
+                        while (word_ < word_count && (current_ = bits_->words_[word_]) == 0) {
+                            ++word_;
+                        }
+                        if (word_ >= word_count) {
+                            word_ = word_count;
+                            current_ = 0;
+                        }
+                    }
+
+                    const packed_bitset* bits_ = nullptr;
+                    std::size_t word_ = word_count;
+                    word_type current_ = 0;
+            };
+
+            [[nodiscard]] constexpr bool test(std::size_t index) const noexcept {
+                return index < Bits && ((words_[index / word_bits] >> (index % word_bits)) & 1u) != 0;
+            }
+
+            constexpr void set(std::size_t index, bool value = true) noexcept {
+                if (index >= Bits) {
+                    return;
+                }
+                const word_type mask = word_type{1} << (index % word_bits);
+                if (value) {
+                    words_[index / word_bits] |= mask;
+                } else {
+                    words_[index / word_bits] &= ~mask;
+                }
+            }
+
+            constexpr void reset() noexcept {
+                words_ = {};
+            }
+
+            [[nodiscard]] constexpr bool any() const noexcept {
+                word_type acc = 0;
+                for (std::size_t i = 0; i < word_count; ++i) {
+                    acc |= words_[i];
+                }
+                return acc != 0;
+            }
+
+            [[nodiscard]] constexpr bool none() const noexcept { return !any(); }
+
+            [[nodiscard]] constexpr std::size_t count() const noexcept {
+                std::size_t n = 0;
+                for (std::size_t i = 0; i < word_count; ++i) {
+                    n += static_cast <std::size_t>(std::popcount(words_[i]));
+                }
+                return n;
+            }
+
+            [[nodiscard]] constexpr iterator begin() const noexcept { return iterator(this, 0); }
+            [[nodiscard]] constexpr iterator end() const noexcept { return iterator(); }
+
+            [[nodiscard]] constexpr std::span <const word_type, word_count> words() const noexcept {
+                return words_;
+            }
+
+            [[nodiscard]] constexpr std::span <word_type, word_count> words() noexcept {
+                return words_;
+            }
+
+            [[nodiscard]] friend constexpr packed_bitset operator&(const packed_bitset& a,
+                                                                   const packed_bitset& b) noexcept {
+                packed_bitset r;
+                for (std::size_t i = 0; i < word_count; ++i) {
+                    r.words_[i] = a.words_[i] & b.words_[i];
+                }
+                return r;
+            }
+
+            [[nodiscard]] friend constexpr packed_bitset operator|(const packed_bitset& a,
+                                                                   const packed_bitset& b) noexcept {
+                packed_bitset r;
+                for (std::size_t i = 0; i < word_count; ++i) {
+                    r.words_[i] = a.words_[i] | b.words_[i];
+                }
+                return r;
+            }
+
+            [[nodiscard]] friend constexpr packed_bitset operator^(const packed_bitset& a,
+                                                                   const packed_bitset& b) noexcept {
+                packed_bitset r;
+                for (std::size_t i = 0; i < word_count; ++i) {
+                    r.words_[i] = a.words_[i] ^ b.words_[i];
+                }
+                return r;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(const packed_bitset&, const packed_bitset&) noexcept = default;
+
+        private:
+            std::array <word_type, word_count> words_{};
+    };
+
+    /**
+     * @brief Immutable per-frame view of button state
+     */
+    class input_snapshot {
+        public:
+            static constexpr std::size_t max_gamepads = 8;
+            static constexpr std::size_t gamepad_stride = 32;  ///< Bits reserved per gamepad slot
+
+            static_assert(SDL_GAMEPAD_BUTTON_COUNT <= gamepad_stride);
+
+            using key_bits = packed_bitset <SDL_SCANCODE_COUNT>;
+            using mouse_bits = packed_bitset <32>;
+            using gamepad_bits = packed_bitset <max_gamepads * gamepad_stride>;
+
+            /**
+             * @brief down / pressed / released / held masks of one device class
+             */
+            template<std::size_t Bits>
+            struct button_edges {
+                packed_bitset <Bits> down;
+                packed_bitset <Bits> pressed;
+                packed_bitset <Bits> released;
+                packed_bitset <Bits> held;
+            };
+
+            // ================================================================
+            // Keyboard
+            // ================================================================
+
+            [[nodiscard]] bool key_down(scancode sc) const noexcept { return keys_.down.test(key_index(sc)); }
+            [[nodiscard]] bool key_pressed(scancode sc) const noexcept { return keys_.pressed.test(key_index(sc)); }
+            [[nodiscard]] bool key_released(scancode sc) const noexcept { return keys_.released.test(key_index(sc)); }
+            [[nodiscard]] bool key_held(scancode sc) const noexcept { return keys_.held.test(key_index(sc)); }
+
+            [[nodiscard]] const button_edges <SDL_SCANCODE_COUNT>& keys() const noexcept { return keys_; }
+
+            /**
+             * @brief Scancodes pressed or released this frame
+             */
+            [[nodiscard]] key_bits changed_keys() const noexcept { return keys_.pressed | keys_.released; }
+
+            /**
+             * @brief Call fn(scancode) for every key pressed or released this frame
+             */
+            template<typename F>
+            void for_each_changed_key(F&& fn) const {
+                for (std::size_t index : changed_keys()) {
+                    fn(static_cast <scancode>(index));
+                }
+            }
+
+            /**
+             * @brief Modifier state at the last key event
+             */
+            [[nodiscard]] keymod mods() const noexcept { return mods_; }
+
+            // ================================================================
+            // Mouse
+            // ================================================================
+
+            [[nodiscard]] bool mouse_down(mouse_button b) const noexcept { return mouse_.down.test(static_cast <std::size_t>(b)); }
+            [[nodiscard]] bool mouse_pressed(mouse_button b) const noexcept { return mouse_.pressed.test(static_cast <std::size_t>(b)); }
+            [[nodiscard]] bool mouse_released(mouse_button b) const noexcept { return mouse_.released.test(static_cast <std::size_t>(b)); }
+            [[nodiscard]] bool mouse_held(mouse_button b) const noexcept { return mouse_.held.test(static_cast <std::size_t>(b)); }
+
+            [[nodiscard]] const button_edges <32>& mouse() const noexcept { return mouse_; }
+
+            /**
+             * @brief Mouse position at the last motion or button event
+             */
+            [[nodiscard]] float mouse_x() const noexcept { return mouse_x_; }
+            [[nodiscard]] float mouse_y() const noexcept { return mouse_y_; }
+
+            // ================================================================
+            // Gamepads
+            // ================================================================
+
+            /**
+             * @brief Joystick instance in a slot (0 if the slot is unused)
+             */
+            [[nodiscard]] SDL_JoystickID gamepad_id(std::size_t slot) const noexcept {
+                return slot < max_gamepads ? gamepad_ids_[slot] : 0;
+            }
+
+            /**
+             * @brief Slot of a joystick instance, or max_gamepads if it is not tracked
+             */
+            [[nodiscard]] std::size_t gamepad_slot(SDL_JoystickID id) const noexcept {
+                for (std::size_t i = 0; i < max_gamepads; ++i) {
+                    if (id != 0 && gamepad_ids_[i] == id) {
+                        return i;
+                    }
+                }
+                return max_gamepads;
+            }
+
+            [[nodiscard]] bool gamepad_down(std::size_t slot, gamepad_button b) const noexcept {
+                return gamepad_.down.test(gamepad_index(slot, b));
+            }
+
+            [[nodiscard]] bool gamepad_pressed(std::size_t slot, gamepad_button b) const noexcept {
+                return gamepad_.pressed.test(gamepad_index(slot, b));
+            }
+
+            [[nodiscard]] bool gamepad_released(std::size_t slot, gamepad_button b) const noexcept {
+                return gamepad_.released.test(gamepad_index(slot, b));
+            }
+
+            [[nodiscard]] bool gamepad_held(std::size_t slot, gamepad_button b) const noexcept {
+                return gamepad_.held.test(gamepad_index(slot, b));
+            }
+
+            /**
+             * @brief All gamepad buttons; bit slot * gamepad_stride + button
+             */
+            [[nodiscard]] const button_edges <max_gamepads * gamepad_stride>& gamepads() const noexcept {
+                return gamepad_;
+            }
+
+            // ================================================================
+            // Timing
+            // ================================================================
+
+            /**
+             * @brief Frame counter (1 for the first published snapshot)
+             */
+            [[nodiscard]] std::uint64_t frame() const noexcept { return frame_; }
+
+            /**
+             * @brief Timestamp of the first input event folded into this frame (0 if none)
+             */
+            [[nodiscard]] Uint64 first_event_ns() const noexcept { return first_event_ns_; }
+
+            /**
+             * @brief Timestamp of the last input event folded into this frame (0 if none)
+             */
+            [[nodiscard]] Uint64 last_event_ns() const noexcept { return last_event_ns_; }
+
+            /**
+             * @brief SDL_GetTicksNS() when the snapshot was published
+             */
+            [[nodiscard]] Uint64 capture_ns() const noexcept { return capture_ns_; }
+
+            /**
+             * @brief Age of the oldest input in this frame when it was published
+             */
+            [[nodiscard]] std::chrono::nanoseconds input_latency() const noexcept {
+                if (first_event_ns_ == 0 || capture_ns_ < first_event_ns_) {
+                    return std::chrono::nanoseconds::zero();
+                }
+                return std::chrono::nanoseconds(static_cast <std::int64_t>(capture_ns_ - first_event_ns_));
+            }
+
+            /**
+             * @brief True if any button changed this frame
+             */
+            [[nodiscard]] bool any_changes() const noexcept {
+                return (keys_.pressed | keys_.released).any()
+                       || (mouse_.pressed | mouse_.released).any()
+                       || (gamepad_.pressed | gamepad_.released).any();
+            }
+
+        private:
+            friend class input_tracker;
+
+            static constexpr std::size_t key_index(scancode sc) noexcept {
+                return static_cast <std::size_t>(sc);
+            }
+
+            static constexpr std::size_t gamepad_index(std::size_t slot, gamepad_button b) noexcept {
+                const auto button = static_cast <std::size_t>(b);
+                if (slot >= max_gamepads || button >= gamepad_stride) {
+                    return max_gamepads * gamepad_stride;  // Out of range: test() yields false
+                }
+                return slot * gamepad_stride + button;
+            }
+
+            button_edges <SDL_SCANCODE_COUNT> keys_;
+            button_edges <32> mouse_;
+            button_edges <max_gamepads * gamepad_stride> gamepad_;
+            std::array <SDL_JoystickID, max_gamepads> gamepad_ids_{};
+            keymod mods_ = keymod::none;
+            float mouse_x_ = 0.0f;
+            float mouse_y_ = 0.0f;
+            std::uint64_t frame_ = 0;
+            Uint64 first_event_ns_ = 0;
+            Uint64 last_event_ns_ = 0;
+            Uint64 capture_ns_ = 0;
+    };
+
+    /**
+     * @brief Accumulates input events and publishes double-buffered snapshots
+     */
+    class input_tracker {
+        public:
+            SDLPP_EXPORT input_tracker() noexcept;
+
+            /**
+             * @brief Fold one event into the pending frame
+             *
+             * Keyboard, mouse button, mouse motion and gamepad button events
+             * are tracked; gamepad removal releases that pad's buttons. Other
+             * events are ignored.
+             */
+            SDLPP_EXPORT void process(const SDL_Event& e) noexcept;
+
+            /**
+             * @brief Fold a batch of events (e.g. event_buffer::raw())
+             */
+            void process(std::span <const SDL_Event> events) noexcept {
+                for (const auto& e : events) {
+                    process(e);
+                }
+            }
+
+            /**
+             * @brief Publish the pending frame
+             * @return The new current snapshot; the previous one stays valid until the next call
+             */
+            SDLPP_EXPORT const input_snapshot& next_frame() noexcept;
+
+            [[nodiscard]] const input_snapshot& current() const noexcept { return snapshots_[current_]; }
+            [[nodiscard]] const input_snapshot& previous() const noexcept { return snapshots_[current_ ^ 1u]; }
+
+            /**
+             * @brief Reload the keyboard bitmap from SDL_GetKeyboardState()
+             *
+             * Useful when events were not processed for a while (e.g. after
+             * regaining focus); differences show up as edges in the next frame.
+             */
+            SDLPP_EXPORT void sync_keyboard() noexcept;
+
+            /**
+             * @brief Release every button (edges are reported in the next frame)
+             */
+            SDLPP_EXPORT void release_all() noexcept;
+
+        private:
+            [[nodiscard]] std::size_t acquire_gamepad_slot(SDL_JoystickID id) noexcept;
+            void stamp(Uint64 timestamp) noexcept;
+
+            template<std::size_t Bits>
+            struct live_buttons;
+
+            template<std::size_t Bits>
+            static void publish_edges(input_snapshot::button_edges <Bits>& out,
+                                      const packed_bitset <Bits>& previous_down,
+                                      live_buttons <Bits>& live) noexcept;
+
+            template<std::size_t Bits>
+            struct live_buttons {
+                packed_bitset <Bits> down;
+                packed_bitset <Bits> went_down;  // Down events since the last frame
+                packed_bitset <Bits> went_up;    // Up events since the last frame
+
+                void press(std::size_t index) noexcept {
+                    down.set(index);
+                    went_down.set(index);
+                }
+
+                void release(std::size_t index) noexcept {
+                    down.set(index, false);
+                    went_up.set(index);
+                }
+            };
+
+            std::array <input_snapshot, 2> snapshots_;
+            unsigned current_ = 0;
+
+            live_buttons <SDL_SCANCODE_COUNT> keys_;
+            live_buttons <32> mouse_;
+            live_buttons <input_snapshot::max_gamepads * input_snapshot::gamepad_stride> gamepad_;
+            std::array <SDL_JoystickID, input_snapshot::max_gamepads> gamepad_ids_{};
+            std::uint32_t removed_gamepads_ = 0;  // Slots freed after the next publish
+            keymod mods_ = keymod::none;
+            float mouse_x_ = 0.0f;
+            float mouse_y_ = 0.0f;
+            std::uint64_t frame_ = 0;
+            Uint64 first_event_ns_ = 0;
+            Uint64 last_event_ns_ = 0;
+    };
+} // namespace sdlpp
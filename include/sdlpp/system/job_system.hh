@@ -0,0 +1,262 @@
+#pragma once
+
+/**
+ * @file job_system.hh
+ * @brief Work-stealing job scheduler
+ *
+ * job_system runs small jobs on a fixed pool of worker threads. Each worker
+ * owns a Chase-Lev deque: it pushes and pops its own jobs at the bottom
+ * (LIFO, cache friendly) while idle workers steal from the top of other
+ * deques (FIFO, oldest and usually largest work first). Jobs submitted
+ * from threads outside the pool go through a shared injection queue.
+ *
+ * Completion is tracked with job_counter: submitting a job with a counter
+ * increments it, finishing the job decrements it, and wait() on a counter
+ * executes other jobs while it is non-zero instead of blocking, so nested
+ * waits from inside jobs cannot deadlock the pool.
+ *
+ * @code
+ * sdlpp::job_system jobs;
+ *
+ * // Fire-and-forget with a completion counter
+ * sdlpp::job_counter decoded;
+ * for (auto& file : files) {
+ *     jobs.submit([&file] { file.decode(); }, &decoded);
+ * }
+ * jobs.wait(decoded);
+ *
+ * // Data parallel loop; the calling thread takes part
+ * jobs.parallel_for(0, particles.size(), [&](std::size_t i) {
+ *     particles[i].integrate(dt);
+ * });
+ * @endcode
+ *
+ * @note Jobs must not throw; an exception escaping a job terminates the
+ *       program.
+ */
+
+#include <sdlpp/detail/export.hh>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sdlpp {
+    class job_system;
+
+    /**
+     * @brief Number of unfinished jobs in a group
+     */
+    class job_counter {
+        public:
+            job_counter() = default;
+            job_counter(const job_counter&) = delete;
+            job_counter& operator=(const job_counter&) = delete;
+
+            /**
+             * @brief True once every job submitted with this counter has finished
+             */
+            [[nodiscard]] bool done() const noexcept {
+                return value_.load(std::memory_order_acquire) == 0;
+            }
+
+            [[nodiscard]] std::int64_t pending() const noexcept {
+                return value_.load(std::memory_order_acquire);
+            }
+
+        private:
+            friend class job_system;
+            std::atomic <std::int64_t> value_{0};
+    };
+
+    /**
+     * @brief Per-worker activity counters
+     */
+    struct job_worker_stats {
+        std::uint64_t jobs_executed = 0;
+        std::uint64_t jobs_stolen = 0;        ///< Jobs taken from another worker's deque
+        std::chrono::nanoseconds busy{0};     ///< Time spent running jobs
+        std::chrono::nanoseconds idle{0};     ///< Time spent asleep waiting for work
+    };
+
+    namespace detail {
+        /**
+         * @brief Type-erased job with inline storage for small callables
+         */
+        class job {
+            public:
+                static constexpr std::size_t inline_size = 48;
+
+                job() = default;
+                job(const job&) = delete;
+                job& operator=(const job&) = delete;
+
+                ~job() {
+                    if (destroy_) {
+                        destroy_(*this);
+                    }
+                }
+
+                template<typename F>
+                void emplace(F&& fn, job_counter* counter, bool owned_by_pool) {
+                    using fn_type = std::decay_t <F>;
+                    counter_ = counter;
+                    owned_ = owned_by_pool;
+                    if constexpr (fits_inline <fn_type>()) {
+                        ::new (static_cast <void*>(storage_)) fn_type(std::forward <F>(fn));
+                        invoke_ = [](job& j) { (*std::launder(reinterpret_cast <fn_type*>(j.storage_)))(); };
+                        destroy_ = [](job& j) { std::launder(reinterpret_cast <fn_type*>(j.storage_))->~fn_type(); };
+                    } else {
+                        auto* heap = new fn_type(std::forward <F>(fn));
+                        ::new (static_cast <void*>(storage_)) fn_type*(heap);
+                        invoke_ = [](job& j) { (**std::launder(reinterpret_cast <fn_type**>(j.storage_)))(); };
+                        destroy_ = [](job& j) { delete *std::launder(reinterpret_cast <fn_type**>(j.storage_)); };
+                    }
+                }
+
+                void run() noexcept { invoke_(*this); }
+
+                [[nodiscard]] job_counter* counter() const noexcept { return counter_; }
+                [[nodiscard]] bool owned() const noexcept { return owned_; }
+
+            private:
+                template<typename T>
+                static constexpr bool fits_inline() noexcept {
+                    return sizeof(T) <= inline_size && alignof(T) <= alignof(std::max_align_t)
+                           && std::is_nothrow_move_constructible_v <T>;
+                }
+
+                void (*invoke_)(job&) = nullptr;
+                void (*destroy_)(job&) = nullptr;
+                job_counter* counter_ = nullptr;
+                bool owned_ = false;
+                alignas(std::max_align_t) unsigned char storage_[inline_size];
+        };
+    } // namespace detail
+
+    /**
+     * @brief Fixed pool of workers with work-stealing deques
+     */
+    class job_system {
+        public:
+            /**
+             * @brief Start the worker threads
+             * @param worker_count Number of workers; 0 = one per logical core
+             *        minus one, since the waiting thread helps execute jobs
+             */
+            SDLPP_EXPORT explicit job_system(std::size_t worker_count = 0);
+
+            /**
+             * @brief Run every queued job, then stop and join the workers
+             */
+            SDLPP_EXPORT ~job_system();
+
+            job_system(const job_system&) = delete;
+            job_system& operator=(const job_system&) = delete;
+
+            /**
+             * @brief Queue a job
+             * @param fn Callable invoked as fn() on some worker
+             * @param counter Optional completion counter (must outlive the job)
+             */
+            template<typename F>
+            void submit(F&& fn, job_counter* counter = nullptr) {
+                auto* j = new detail::job();
+                j->emplace(std::forward <F>(fn), counter, true);
+                enqueue(j);
+            }
+
+            /**
+             * @brief Run fn over [begin, end) in parallel and wait for it
+             *
+             * fn is called either as fn(i) for each index or as fn(first, last)
+             * for each chunk, whichever it accepts. An exception thrown from
+             * the chunk run on the calling thread propagates once every other
+             * chunk has finished; one thrown on a worker calls std::terminate.
+             *
+             * @param grain Indices per job; 0 picks a size giving a few chunks per worker
+             */
+            template<typename F>
+            void parallel_for(std::size_t begin, std::size_t end, F&& fn, std::size_t grain = 0) {
+                if (begin >= end) {
+                    return;
+                }
+                const std::size_t count = end - begin;
+                if (grain == 0) {
+                    grain = count / (4 * (worker_count() + 1));
+                }
+                grain = grain > 0 ? grain : 1;
+                const std::size_t chunks = (count + grain - 1) / grain;
+
+                auto run_chunk = [&fn](std::size_t first, std::size_t last) {
+                    if constexpr (std::is_invocable_v <F&, std::size_t, std::size_t>) {
+                        fn(first, last);
+                    } else {
+                        for (std::size_t i = first; i < last; ++i) {
+                            fn(i);
+                        }
+                    }
+                };
+
+                if (chunks == 1) {
+                    run_chunk(begin, end);
+                    return;
+                }
+
+                // One allocation for all chunk jobs; they live in this frame
+                // until wait() returns
+                job_counter counter;
+                auto jobs = std::make_unique <detail::job[]>(chunks - 1);
+                for (std::size_t c = 1; c < chunks; ++c) {
+                    const std::size_t first = begin + c * grain;
+                    const std::size_t last = first + grain < end ? first + grain : end;
+                    jobs[c - 1].emplace([&run_chunk, first, last] { run_chunk(first, last); }, &counter, false);
+                    enqueue(&jobs[c - 1]);
+                }
+
+                // The chunk jobs reference this frame: if the caller's own
+                // chunk throws, they must still finish before it unwinds
+                struct wait_guard {
+                    job_system& jobs;
+                    job_counter& counter;
+                    ~wait_guard() { jobs.wait(counter); }
+                } guard{*this, counter};
+
+                run_chunk(begin, begin + grain);
+            }
+
+            /**
+             * @brief Execute queued jobs until the counter reaches zero
+             */
+            SDLPP_EXPORT void wait(job_counter& counter);
+
+            /**
+             * @brief Number of worker threads
+             */
+            [[nodiscard]] std::size_t worker_count() const noexcept { return workers_.size(); }
+
+            /**
+             * @brief Snapshot of per-worker counters
+             */
+            [[nodiscard]] SDLPP_EXPORT std::vector <job_worker_stats> statistics() const;
+
+            SDLPP_EXPORT void reset_statistics() noexcept;
+
+        private:
+            struct worker;
+
+            SDLPP_EXPORT void enqueue(detail::job* j);
+            detail::job* find_job(std::size_t self);
+            void execute(detail::job* j, worker* self) noexcept;
+
+            std::vector <std::unique_ptr <worker>> workers_;
+            struct shared_state;
+            std::unique_ptr <shared_state> shared_;
+    };
+} // namespace sdlpp
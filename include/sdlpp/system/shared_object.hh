@@ -317,12 +317,12 @@ namespace sdlpp {
                 const shared_object& obj,
                 std::index_sequence <Is...>) noexcept {
                 auto symbols = Derived::symbols();
-                std::string error;
+                std::string message;
 
-                bool success = (load_symbol(obj, std::get <Is>(symbols), error) && ...);
+                bool success = (load_symbol(obj, std::get <Is>(symbols), message) && ...);
 
                 if (!success) {
-                    return make_unexpectedf(error);
+                    return make_unexpectedf(message);
                 }
 
                 return {};
@@ -331,10 +331,10 @@ namespace sdlpp {
             template<typename T>
             bool load_symbol(const shared_object& obj,
                              const symbol_binding <T>& binding,
-                             std::string& error) noexcept {
+                             std::string& message) noexcept {
                 auto symbol = obj.get_symbol(binding.name);
                 if (!symbol) {
-                    error = "Failed to load symbol '" + std::string(binding.name) +
+                    message = "Failed to load symbol '" + std::string(binding.name) +
                             "': " + symbol.error();
                     return false;
                 }
@@ -0,0 +1,123 @@
+#pragma once
+
+/**
+ * @file triple_buffer.hh
+ * @brief Lock-free single-producer/single-consumer state handoff
+ *
+ * A triple buffer lets one thread keep producing complete snapshots of some
+ * state while another thread reads the most recent finished one, without
+ * either side ever blocking or seeing a half-written snapshot:
+ *
+ * - the producer fills write_buffer() and calls publish()
+ * - the consumer calls update() and reads read_buffer()
+ *
+ * Three slots are rotated through one atomic index; snapshots the consumer
+ * did not pick up in time are simply replaced by newer ones.
+ *
+ * @code
+ * sdlpp::triple_buffer<world_view> views;
+ *
+ * // Update thread
+ * auto& view = views.write_buffer();
+ * fill_view(view, world);
+ * views.publish();
+ *
+ * // Render thread
+ * views.update();
+ * draw(views.read_buffer());
+ * @endcode
+ *
+ * @note write_buffer() is not cleared on publish(); it holds whatever
+ *       snapshot the consumer released last, so producers should overwrite
+ *       the whole state (or copy from their own authoritative copy).
+ */
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace sdlpp {
+    /**
+     * @brief Three-slot buffer for handing whole states between two threads
+     * @tparam T State type
+     */
+    template<typename T>
+    class triple_buffer {
+        public:
+            triple_buffer() = default;
+
+            /**
+             * @brief Initialize every slot with the same value
+             */
+            explicit triple_buffer(const T& initial)
+                : slots_{initial, initial, initial} {
+            }
+
+            triple_buffer(const triple_buffer&) = delete;
+            triple_buffer& operator=(const triple_buffer&) = delete;
+
+            // ================================================================
+            // Producer side
+            // ================================================================
+
+            /**
+             * @brief Slot owned by the producer
+             */
+            [[nodiscard]] T& write_buffer() noexcept { return slots_[write_]; }
+
+            /**
+             * @brief Make the producer slot the latest state
+             */
+            void publish() noexcept {
+                const auto prev = shared_.exchange(write_ | fresh_bit, std::memory_order_acq_rel);
+                write_ = prev & index_mask;
+            }
+
+            /**
+             * @brief Overwrite the producer slot and publish it
+             */
+            void publish(T value) {
+                slots_[write_] = std::move(value);
+                publish();
+            }
+
+            // ================================================================
+            // Consumer side
+            // ================================================================
+
+            /**
+             * @brief Take the latest published state, if there is a new one
+             * @return true if read_buffer() now refers to a newer state
+             */
+            bool update() noexcept {
+                if ((shared_.load(std::memory_order_relaxed) & fresh_bit) == 0) {
+                    return false;
+                }
+                const auto prev = shared_.exchange(read_, std::memory_order_acq_rel);
+                read_ = prev & index_mask;
+                return true;
+            }
+
+            /**
+             * @brief Slot owned by the consumer
+             */
+            [[nodiscard]] const T& read_buffer() const noexcept { return slots_[read_]; }
+
+            /**
+             * @brief True if a state was published since the last update()
+             */
+            [[nodiscard]] bool has_update() const noexcept {
+                return (shared_.load(std::memory_order_acquire) & fresh_bit) != 0;
+            }
+
+        private:
+            static constexpr std::uint32_t index_mask = 0x3;
+            static constexpr std::uint32_t fresh_bit = 0x4;
+
+            std::array <T, 3> slots_{};
+            std::uint32_t write_ = 0;                      // Producer only
+            std::uint32_t read_ = 2;                       // Consumer only
+            alignas(64) std::atomic <std::uint32_t> shared_{1};  // Middle slot index + fresh flag
+    };
+} // namespace sdlpp
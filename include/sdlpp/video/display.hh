@@ -347,9 +347,9 @@ namespace sdlpp {
                 SDL_DisplayOrientation orient = SDL_GetCurrentDisplayOrientation(id);
                 if (orient == SDL_ORIENTATION_UNKNOWN) {
                     // Check if it's an actual error or just unknown
-                    auto error = get_error();
-                    if (!error.empty()) {
-                        return make_unexpectedf(error);
+                    auto message = get_error();
+                    if (!message.empty()) {
+                        return make_unexpectedf(message);
                     }
                 }
 
@@ -368,9 +368,9 @@ namespace sdlpp {
                 SDL_DisplayOrientation orient = SDL_GetNaturalDisplayOrientation(id);
                 if (orient == SDL_ORIENTATION_UNKNOWN) {
                     // Check if it's an actual error or just unknown
-                    auto error = get_error();
-                    if (!error.empty()) {
-                        return make_unexpectedf(error);
+                    auto message = get_error();
+                    if (!message.empty()) {
+                        return make_unexpectedf(message);
                     }
                 }
 
@@ -15,6 +15,7 @@
 #include <sdlpp/core/sdl.hh>
 #include <sdlpp/detail/export.hh>
 #include <sdlpp/core/error.hh>
+#include <sdlpp/core/profiler.hh>
 #include <sdlpp/detail/expected.hh>
 #include <sdlpp/detail/pointer.hh>
 #include <sdlpp/utility/geometry.hh>
@@ -150,9 +151,10 @@ namespace sdlpp {
              * @brief Clear the entire rendering target with draw color
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> clear() {
+            expected <void, error> clear() {
+                SDLPP_PROFILE_ZONE("renderer::clear");
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 SDL_RenderClear(ptr.get());
@@ -164,9 +166,10 @@ namespace sdlpp {
              * @brief Present the backbuffer to the screen
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> present() {
+            expected <void, error> present() {
+                SDLPP_PROFILE_ZONE("renderer::present");
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 SDL_RenderPresent(ptr.get());
@@ -179,9 +182,9 @@ namespace sdlpp {
              * @param c Color to use for drawing operations
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> set_draw_color(const color& c) {
+            expected <void, error> set_draw_color(const color& c) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 SDL_SetRenderDrawColor(ptr.get(), c.r, c.g, c.b, c.a);
@@ -193,14 +196,14 @@ namespace sdlpp {
              * @brief Get the current draw color
              * @return Expected containing color, or error message
              */
-            expected <color, std::string> get_draw_color() const {
+            expected <color, error> get_draw_color() const {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 uint8_t r, g, b, a;
                 if (!SDL_GetRenderDrawColor(ptr.get(), &r, &g, &b, &a)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return color{r, g, b, a};
@@ -211,13 +214,13 @@ namespace sdlpp {
              * @param mode Blend mode to use (defaults to none)
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> set_draw_blend_mode(blend_mode mode = blend_mode::none) {
+            expected <void, error> set_draw_blend_mode(blend_mode mode = blend_mode::none) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (!SDL_SetRenderDrawBlendMode(ptr.get(), static_cast <SDL_BlendMode>(mode))) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -227,14 +230,14 @@ namespace sdlpp {
              * @brief Get the blend mode for drawing operations
              * @return Expected containing blend mode, or error message
              */
-            expected <blend_mode, std::string> get_draw_blend_mode() const {
+            expected <blend_mode, error> get_draw_blend_mode() const {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 SDL_BlendMode mode;
                 if (!SDL_GetRenderDrawBlendMode(ptr.get(), &mode)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return static_cast <blend_mode>(mode);
@@ -246,13 +249,13 @@ namespace sdlpp {
              * @param y Y coordinate
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> draw_point(int x, int y) {
+            expected <void, error> draw_point(int x, int y) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (!SDL_RenderPoint(ptr.get(), static_cast <float>(x), static_cast <float>(y))) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -264,7 +267,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<point_like P>
-            expected <void, std::string> draw_point(const P& p) {
+            expected <void, error> draw_point(const P& p) {
                 return draw_point(static_cast <float>(p.x), static_cast <float>(p.y));
             }
 
@@ -274,13 +277,13 @@ namespace sdlpp {
              * @param y Y coordinate
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> draw_point(float x, float y) {
+            expected <void, error> draw_point(float x, float y) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (!SDL_RenderPoint(ptr.get(), x, y)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -294,7 +297,7 @@ namespace sdlpp {
              */
             template<point_like P>
             requires std::is_floating_point_v<typename P::value_type>
-            expected <void, std::string> draw_point(const P& p) {
+            expected <void, error> draw_point(const P& p) {
                 return draw_point(static_cast<float>(get_x(p)), static_cast<float>(get_y(p)));
             }
 
@@ -311,9 +314,10 @@ namespace sdlpp {
                 { std::begin(c) };
                 { std::end(c) };
             }
-            expected <void, std::string> draw_points(const Container& points) {
+            expected <void, error> draw_points(const Container& points) {
+                SDLPP_PROFILE_ZONE("renderer::draw_points");
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (std::begin(points) == std::end(points)) {
@@ -328,12 +332,12 @@ namespace sdlpp {
                 }
 
                 if (sdl_points.size() > static_cast <size_t>(std::numeric_limits <int>::max())) {
-                    return make_unexpectedf("Too many points for SDL API");
+                    return make_error(errc::invalid_argument, error_subsystem::render, "Too many points for SDL API");
                 }
 
                 if (!SDL_RenderPoints(ptr.get(), sdl_points.data(),
                                       static_cast <int>(sdl_points.size()))) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -347,15 +351,15 @@ namespace sdlpp {
              * @param y2 End Y coordinate
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> draw_line(int x1, int y1, int x2, int y2) {
+            expected <void, error> draw_line(int x1, int y1, int x2, int y2) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (!SDL_RenderLine(ptr.get(),
                                     static_cast <float>(x1), static_cast <float>(y1),
                                     static_cast <float>(x2), static_cast <float>(y2))) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -368,7 +372,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<point_like P1, point_like P2>
-            expected <void, std::string> draw_line(const P1& start, const P2& end) {
+            expected <void, error> draw_line(const P1& start, const P2& end) {
                 return draw_line(static_cast <float>(start.x), static_cast <float>(start.y),
                                  static_cast <float>(end.x), static_cast <float>(end.y));
             }
@@ -381,13 +385,13 @@ namespace sdlpp {
              * @param y2 End Y coordinate
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> draw_line(float x1, float y1, float x2, float y2) {
+            expected <void, error> draw_line(float x1, float y1, float x2, float y2) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (!SDL_RenderLine(ptr.get(), x1, y1, x2, y2)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -406,9 +410,10 @@ namespace sdlpp {
                 { std::begin(c) };
                 { std::end(c) };
             }
-            expected <void, std::string> draw_lines(const Container& points) {
+            expected <void, error> draw_lines(const Container& points) {
+                SDLPP_PROFILE_ZONE("renderer::draw_lines");
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 auto count = std::distance(std::begin(points), std::end(points));
@@ -424,12 +429,12 @@ namespace sdlpp {
                 }
 
                 if (sdl_points.size() > static_cast <size_t>(std::numeric_limits <int>::max())) {
-                    return make_unexpectedf("Too many points for SDL API");
+                    return make_error(errc::invalid_argument, error_subsystem::render, "Too many points for SDL API");
                 }
 
                 if (!SDL_RenderLines(ptr.get(), sdl_points.data(),
                                      static_cast <int>(sdl_points.size()))) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -441,9 +446,9 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<rect_like R>
-            expected <void, std::string> draw_rect(const R& r) {
+            expected <void, error> draw_rect(const R& r) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 SDL_FRect sdl_rect{
@@ -452,7 +457,7 @@ namespace sdlpp {
                 };
 
                 if (!SDL_RenderRect(ptr.get(), &sdl_rect)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -466,9 +471,9 @@ namespace sdlpp {
              */
             template<rect_like R>
             requires std::is_floating_point_v<typename R::value_type>
-            expected <void, std::string> draw_rect(const R& r) {
+            expected <void, error> draw_rect(const R& r) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 SDL_FRect sdl_rect{
@@ -477,7 +482,7 @@ namespace sdlpp {
                 };
 
                 if (!SDL_RenderRect(ptr.get(), &sdl_rect)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -496,9 +501,10 @@ namespace sdlpp {
                 { std::begin(c) };
                 { std::end(c) };
             }
-            expected <void, std::string> draw_rects(const Container& rects) {
+            expected <void, error> draw_rects(const Container& rects) {
+                SDLPP_PROFILE_ZONE("renderer::draw_rects");
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (std::begin(rects) == std::end(rects)) {
@@ -516,12 +522,12 @@ namespace sdlpp {
                 }
 
                 if (sdl_rects.size() > static_cast <size_t>(std::numeric_limits <int>::max())) {
-                    return make_unexpectedf("Too many rectangles for SDL API");
+                    return make_error(errc::invalid_argument, error_subsystem::render, "Too many rectangles for SDL API");
                 }
 
                 if (!SDL_RenderRects(ptr.get(), sdl_rects.data(),
                                      static_cast <int>(sdl_rects.size()))) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -533,9 +539,9 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<rect_like R>
-            expected <void, std::string> fill_rect(const R& r) {
+            expected <void, error> fill_rect(const R& r) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 SDL_FRect sdl_rect{
@@ -544,7 +550,7 @@ namespace sdlpp {
                 };
 
                 if (!SDL_RenderFillRect(ptr.get(), &sdl_rect)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -558,9 +564,9 @@ namespace sdlpp {
              */
             template<rect_like R>
             requires std::is_floating_point_v<typename R::value_type>
-            expected <void, std::string> fill_rect(const R& r) {
+            expected <void, error> fill_rect(const R& r) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 SDL_FRect sdl_rect{
@@ -569,7 +575,7 @@ namespace sdlpp {
                 };
 
                 if (!SDL_RenderFillRect(ptr.get(), &sdl_rect)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -588,9 +594,10 @@ namespace sdlpp {
                 { std::begin(c) };
                 { std::end(c) };
             }
-            expected <void, std::string> fill_rects(const Container& rects) {
+            expected <void, error> fill_rects(const Container& rects) {
+                SDLPP_PROFILE_ZONE("renderer::fill_rects");
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (std::begin(rects) == std::end(rects)) {
@@ -608,12 +615,12 @@ namespace sdlpp {
                 }
 
                 if (sdl_rects.size() > static_cast <size_t>(std::numeric_limits <int>::max())) {
-                    return make_unexpectedf("Too many rectangles for SDL API");
+                    return make_error(errc::invalid_argument, error_subsystem::render, "Too many rectangles for SDL API");
                 }
 
                 if (!SDL_RenderFillRects(ptr.get(), sdl_rects.data(),
                                          static_cast <int>(sdl_rects.size()))) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -626,9 +633,9 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<rect_like R = void>
-            expected <void, std::string> set_viewport(const std::optional <R>& viewport) {
+            expected <void, error> set_viewport(const std::optional <R>& viewport) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (viewport) {
@@ -639,11 +646,11 @@ namespace sdlpp {
                         static_cast<int>(get_height(*viewport))
                     };
                     if (!SDL_SetRenderViewport(ptr.get(), &sdl_rect)) {
-                        return make_unexpectedf(get_error());
+                        return make_sdl_error(error_subsystem::render);
                     }
                 } else {
                     if (!SDL_SetRenderViewport(ptr.get(), nullptr)) {
-                        return make_unexpectedf(get_error());
+                        return make_sdl_error(error_subsystem::render);
                     }
                 }
 
@@ -662,15 +669,15 @@ namespace sdlpp {
                 void
 #endif
             >
-            expected <R, std::string> get_viewport() const
+            expected <R, error> get_viewport() const
                 requires (!std::is_void_v<R>) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 SDL_Rect viewport;
                 if (!SDL_GetRenderViewport(ptr.get(), &viewport)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return R{viewport.x, viewport.y, viewport.w, viewport.h};
@@ -683,9 +690,9 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<rect_like R = void>
-            expected <void, std::string> set_clip_rect(const std::optional <R>& clip) {
+            expected <void, error> set_clip_rect(const std::optional <R>& clip) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (clip) {
@@ -696,11 +703,11 @@ namespace sdlpp {
                         static_cast<int>(get_height(*clip))
                     };
                     if (!SDL_SetRenderClipRect(ptr.get(), &sdl_rect)) {
-                        return make_unexpectedf(get_error());
+                        return make_sdl_error(error_subsystem::render);
                     }
                 } else {
                     if (!SDL_SetRenderClipRect(ptr.get(), nullptr)) {
-                        return make_unexpectedf(get_error());
+                        return make_sdl_error(error_subsystem::render);
                     }
                 }
 
@@ -719,15 +726,15 @@ namespace sdlpp {
                 void
 #endif
             >
-            expected <std::optional <R>, std::string> get_clip_rect() const
+            expected <std::optional <R>, error> get_clip_rect() const
                 requires (!std::is_void_v<R>) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 SDL_Rect clip;
                 if (!SDL_GetRenderClipRect(ptr.get(), &clip)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 // Check if clipping is enabled (SDL returns non-zero rect)
@@ -752,13 +759,13 @@ namespace sdlpp {
              * @param scale_y Y axis scale factor
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> set_scale(float scale_x, float scale_y) {
+            expected <void, error> set_scale(float scale_x, float scale_y) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (!SDL_SetRenderScale(ptr.get(), scale_x, scale_y)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -776,15 +783,15 @@ namespace sdlpp {
                 void
 #endif
             >
-            expected <P, std::string> get_scale() const
+            expected <P, error> get_scale() const
                 requires (!std::is_void_v<P>) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 float scale_x, scale_y;
                 if (!SDL_GetRenderScale(ptr.get(), &scale_x, &scale_y)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return P{static_cast<typename P::value_type>(scale_x), static_cast<typename P::value_type>(scale_y)};
@@ -802,15 +809,15 @@ namespace sdlpp {
                 void
 #endif
             >
-            expected <S, std::string> get_output_size() const
+            expected <S, error> get_output_size() const
                 requires (!std::is_void_v<S>) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 int w, h;
                 if (!SDL_GetRenderOutputSize(ptr.get(), &w, &h)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return S{w, h};
@@ -828,15 +835,15 @@ namespace sdlpp {
                 void
 #endif
             >
-            expected <S, std::string> get_current_output_size() const
+            expected <S, error> get_current_output_size() const
                 requires (!std::is_void_v<S>) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 int w, h;
                 if (!SDL_GetCurrentRenderOutputSize(ptr.get(), &w, &h)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return S{w, h};
@@ -847,13 +854,13 @@ namespace sdlpp {
              * @param vsync 0 to disable, 1 to enable, -1 for adaptive vsync
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> set_vsync(int vsync) {
+            expected <void, error> set_vsync(int vsync) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (!SDL_SetRenderVSync(ptr.get(), vsync)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -863,14 +870,14 @@ namespace sdlpp {
              * @brief Get VSync mode
              * @return Expected containing vsync mode, or error message
              */
-            expected <int, std::string> get_vsync() const {
+            expected <int, error> get_vsync() const {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 int vsync;
                 if (!SDL_GetRenderVSync(ptr.get(), &vsync)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return vsync;
@@ -880,13 +887,14 @@ namespace sdlpp {
              * @brief Flush any pending rendering commands
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> flush() {
+            expected <void, error> flush() {
+                SDLPP_PROFILE_ZONE("renderer::flush");
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (!SDL_FlushRenderer(ptr.get())) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -903,7 +911,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<rect_like R = void>
-            expected <void, std::string> copy(
+            expected <void, error> copy(
                 const texture& texture,
                 const std::optional <R>& src_rect = std::nullopt,
                 const std::optional <R>& dst_rect = std::nullopt);
@@ -918,7 +926,7 @@ namespace sdlpp {
              */
             template<rect_like R>
             requires std::is_floating_point_v<typename R::value_type>
-            expected <void, std::string> copy(
+            expected <void, error> copy(
                 const texture& texture,
                 const std::optional <R>& src_rect,
                 const std::optional <R>& dst_rect);
@@ -934,7 +942,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<rect_like R = void, point_like P = void>
-            expected <void, std::string> copy_ex(
+            expected <void, error> copy_ex(
                 const texture& texture,
                 const std::optional <R>& src_rect,
                 const std::optional <R>& dst_rect,
@@ -955,7 +963,7 @@ namespace sdlpp {
             template<rect_like R, point_like P>
             requires (std::is_floating_point_v<typename R::value_type> && 
                      std::is_floating_point_v<typename P::value_type>)
-            expected <void, std::string> copy_ex(
+            expected <void, error> copy_ex(
                 const texture& texture,
                 const std::optional <R>& src_rect,
                 const std::optional <R>& dst_rect,
@@ -974,7 +982,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<rect_like R = void, point_like P = void>
-            expected <void, std::string> copy_ex(
+            expected <void, error> copy_ex(
                 const texture& texture,
                 const std::optional <R>& src_rect,
                 const std::optional <R>& dst_rect,
@@ -997,7 +1005,7 @@ namespace sdlpp {
             template<rect_like R, point_like P>
             requires (std::is_floating_point_v<typename R::value_type> && 
                      std::is_floating_point_v<typename P::value_type>)
-            expected <void, std::string> copy_ex(
+            expected <void, error> copy_ex(
                 const texture& texture,
                 const std::optional <R>& src_rect,
                 const std::optional <R>& dst_rect,
@@ -1018,7 +1026,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<rect_like R = void, point_like P = void>
-            expected <void, std::string> copy_ex(
+            expected <void, error> copy_ex(
                 const texture& texture,
                 const std::optional <R>& src_rect,
                 const std::optional <R>& dst_rect,
@@ -1041,7 +1049,7 @@ namespace sdlpp {
             template<rect_like R, point_like P>
             requires (std::is_floating_point_v<typename R::value_type> && 
                      std::is_floating_point_v<typename P::value_type>)
-            expected <void, std::string> copy_ex(
+            expected <void, error> copy_ex(
                 const texture& texture,
                 const std::optional <R>& src_rect,
                 const std::optional <R>& dst_rect,
@@ -1055,14 +1063,14 @@ namespace sdlpp {
              * @brief Get current render target
              * @return Expected containing target texture (empty texture for default), or error
              */
-            [[nodiscard]] expected <texture, std::string> get_target() const;
+            [[nodiscard]] expected <texture, error> get_target() const;
 
             /**
              * @brief Set render target
              * @param target Target texture (empty texture for default target)
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> set_target(const texture& target);
+            expected <void, error> set_target(const texture& target);
 
             /**
              * @brief Render texture using 9-grid tiled scaling (SDL 3.4.0+)
@@ -1081,7 +1089,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<rect_like R>
-            expected<void, std::string> copy_9grid_tiled(
+            expected<void, error> copy_9grid_tiled(
                 const texture& texture,
                 const std::optional<R>& src_rect,
                 float left_width, float right_width,
@@ -1099,16 +1107,16 @@ namespace sdlpp {
              * @param mode Address mode to use for both U and V axes
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected<void, std::string> set_texture_address_mode(texture_address_mode mode) {
+            expected<void, error> set_texture_address_mode(texture_address_mode mode) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (!SDL_SetRenderTextureAddressMode(
                     ptr.get(),
                     static_cast<SDL_TextureAddressMode>(mode),
                     static_cast<SDL_TextureAddressMode>(mode))) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -1121,18 +1129,18 @@ namespace sdlpp {
              * @param mode_v Address mode for V (vertical) axis
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected<void, std::string> set_texture_address_mode(
+            expected<void, error> set_texture_address_mode(
                 texture_address_mode mode_u,
                 texture_address_mode mode_v) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (!SDL_SetRenderTextureAddressMode(
                     ptr.get(),
                     static_cast<SDL_TextureAddressMode>(mode_u),
                     static_cast<SDL_TextureAddressMode>(mode_v))) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -1143,15 +1151,15 @@ namespace sdlpp {
              *
              * @return Expected containing pair of (mode_u, mode_v), or error message
              */
-            [[nodiscard]] expected<std::pair<texture_address_mode, texture_address_mode>, std::string>
+            [[nodiscard]] expected<std::pair<texture_address_mode, texture_address_mode>, error>
             get_texture_address_mode() const {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 SDL_TextureAddressMode mode_u, mode_v;
                 if (!SDL_GetRenderTextureAddressMode(ptr.get(), &mode_u, &mode_v)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return std::make_pair(
@@ -1168,12 +1176,13 @@ namespace sdlpp {
              * @param indices Index data for triangles (3 indices per triangle)
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> render_geometry(
+            expected <void, error> render_geometry(
                 SDL_Texture* texture,
                 std::span <const SDL_Vertex> vertices,
                 std::span <const int> indices) {
+                SDLPP_PROFILE_ZONE("renderer::render_geometry");
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
 
                 if (vertices.empty() || indices.empty()) {
@@ -1181,26 +1190,26 @@ namespace sdlpp {
                 }
 
                 if (indices.size() % 3 != 0) {
-                    return make_unexpectedf("Index count must be multiple of 3 for triangles");
+                    return make_error(errc::invalid_argument, error_subsystem::render, "Index count must be multiple of 3 for triangles");
                 }
 
                 // Check for size limits
                 if (vertices.size() > static_cast <size_t>(std::numeric_limits <int>::max()) ||
                     indices.size() > static_cast <size_t>(std::numeric_limits <int>::max())) {
-                    return make_unexpectedf("Too many vertices or indices for SDL API");
+                    return make_error(errc::invalid_argument, error_subsystem::render, "Too many vertices or indices for SDL API");
                 }
 
                 // Validate indices are within bounds
                 for (const auto& idx : indices) {
                     if (idx < 0 || idx >= static_cast <int>(vertices.size())) {
-                        return make_unexpectedf("Index out of bounds");
+                        return make_error(errc::invalid_argument, error_subsystem::render, "Index out of bounds");
                     }
                 }
 
                 if (!SDL_RenderGeometry(ptr.get(), texture,
                                         vertices.data(), static_cast <int>(vertices.size()),
                                         indices.data(), static_cast <int>(indices.size()))) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -1212,7 +1221,7 @@ namespace sdlpp {
              * @param indices Index data for triangles
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> render_geometry(
+            expected <void, error> render_geometry(
                 std::span <const SDL_Vertex> vertices,
                 std::span <const int> indices) {
                 return render_geometry(nullptr, vertices, indices);
@@ -1226,7 +1235,7 @@ namespace sdlpp {
              * @param v2 Third vertex
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> render_triangle(
+            expected <void, error> render_triangle(
                 SDL_Texture* texture,
                 const SDL_Vertex& v0,
                 const SDL_Vertex& v1,
@@ -1244,7 +1253,7 @@ namespace sdlpp {
              * @param v2 Third vertex
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> render_triangle(
+            expected <void, error> render_triangle(
                 const SDL_Vertex& v0,
                 const SDL_Vertex& v1,
                 const SDL_Vertex& v2) {
@@ -1281,7 +1290,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<triangle_like T>
-            expected <void, std::string> render_triangle(
+            expected <void, error> render_triangle(
                 const T& tri,
                 const color& c) {
                 auto v0 = make_vertex(tri.a, c);
@@ -1302,7 +1311,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<triangle_like T1, triangle_like T2>
-            expected <void, std::string> render_textured_triangle(
+            expected <void, error> render_textured_triangle(
                 SDL_Texture* texture,
                 const T1& tri,
                 const color& c,
@@ -1385,7 +1394,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              * @note Uses Wu's or Gupta-Sproull algorithm for smooth antialiasing
              */
-            SDLPP_EXPORT expected<void, std::string> draw_line_aa(float x1, float y1, float x2, float y2);
+            SDLPP_EXPORT expected<void, error> draw_line_aa(float x1, float y1, float x2, float y2);
 
             /**
              * @brief Draw an antialiased line using DDA algorithms
@@ -1394,7 +1403,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<point_like P1, point_like P2>
-            expected<void, std::string> draw_line_aa(const P1& start, const P2& end) {
+            expected<void, error> draw_line_aa(const P1& start, const P2& end) {
                 return draw_line_aa(static_cast<float>(get_x(start)), 
                                   static_cast<float>(get_y(start)), 
                                   static_cast<float>(get_x(end)), 
@@ -1410,7 +1419,7 @@ namespace sdlpp {
              * @param width Line width in pixels
              * @return Expected<void> - empty on success, error message on failure
              */
-            SDLPP_EXPORT expected<void, std::string> draw_line_thick(float x1, float y1, float x2, float y2, float width);
+            SDLPP_EXPORT expected<void, error> draw_line_thick(float x1, float y1, float x2, float y2, float width);
 
             /**
              * @brief Draw a thick line with specified width
@@ -1420,7 +1429,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<point_like P1, point_like P2>
-            expected<void, std::string> draw_line_thick(const P1& start, const P2& end, float width) {
+            expected<void, error> draw_line_thick(const P1& start, const P2& end, float width) {
                 return draw_line_thick(static_cast<float>(get_x(start)), 
                                      static_cast<float>(get_y(start)), 
                                      static_cast<float>(get_x(end)), 
@@ -1435,7 +1444,7 @@ namespace sdlpp {
              * @param radius Circle radius
              * @return Expected<void> - empty on success, error message on failure
              */
-            SDLPP_EXPORT expected<void, std::string> draw_circle(int x, int y, int radius);
+            SDLPP_EXPORT expected<void, error> draw_circle(int x, int y, int radius);
 
             /**
              * @brief Draw a circle outline using DDA algorithm
@@ -1444,7 +1453,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<point_like P>
-            expected<void, std::string> draw_circle(const P& center, int radius) {
+            expected<void, error> draw_circle(const P& center, int radius) {
                 return draw_circle(static_cast<int>(get_x(center)), 
                                  static_cast<int>(get_y(center)), 
                                  radius);
@@ -1457,7 +1466,7 @@ namespace sdlpp {
              * @param radius Circle radius
              * @return Expected<void> - empty on success, error message on failure
              */
-            SDLPP_EXPORT expected<void, std::string> fill_circle(int x, int y, int radius);
+            SDLPP_EXPORT expected<void, error> fill_circle(int x, int y, int radius);
 
             /**
              * @brief Draw a filled circle using DDA algorithm
@@ -1466,7 +1475,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<point_like P>
-            expected<void, std::string> fill_circle(const P& center, int radius) {
+            expected<void, error> fill_circle(const P& center, int radius) {
                 return fill_circle(static_cast<int>(get_x(center)), 
                                  static_cast<int>(get_y(center)), 
                                  radius);
@@ -1480,7 +1489,7 @@ namespace sdlpp {
              * @param ry Vertical radius
              * @return Expected<void> - empty on success, error message on failure
              */
-            SDLPP_EXPORT expected<void, std::string> draw_ellipse(int x, int y, int rx, int ry);
+            SDLPP_EXPORT expected<void, error> draw_ellipse(int x, int y, int rx, int ry);
 
             /**
              * @brief Draw an ellipse outline using DDA algorithm
@@ -1490,7 +1499,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<point_like P>
-            expected<void, std::string> draw_ellipse(const P& center, int rx, int ry) {
+            expected<void, error> draw_ellipse(const P& center, int rx, int ry) {
                 return draw_ellipse(static_cast<int>(get_x(center)), 
                                   static_cast<int>(get_y(center)), 
                                   rx, ry);
@@ -1504,7 +1513,7 @@ namespace sdlpp {
              * @param ry Vertical radius
              * @return Expected<void> - empty on success, error message on failure
              */
-            SDLPP_EXPORT expected<void, std::string> fill_ellipse(int x, int y, int rx, int ry);
+            SDLPP_EXPORT expected<void, error> fill_ellipse(int x, int y, int rx, int ry);
 
             /**
              * @brief Draw a filled ellipse using DDA algorithm
@@ -1514,7 +1523,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<point_like P>
-            expected<void, std::string> fill_ellipse(const P& center, int rx, int ry) {
+            expected<void, error> fill_ellipse(const P& center, int rx, int ry) {
                 return fill_ellipse(static_cast<int>(get_x(center)), 
                                   static_cast<int>(get_y(center)), 
                                   rx, ry);
@@ -1530,7 +1539,7 @@ namespace sdlpp {
              * @param end_angle Ending angle in radians
              * @return Expected<void> - empty on success, error message on failure
              */
-            SDLPP_EXPORT expected<void, std::string> draw_ellipse_arc(int x, int y, int rx, int ry, float start_angle, float end_angle);
+            SDLPP_EXPORT expected<void, error> draw_ellipse_arc(int x, int y, int rx, int ry, float start_angle, float end_angle);
 
             /**
              * @brief Draw an ellipse arc using DDA algorithm
@@ -1542,7 +1551,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<point_like P>
-            expected<void, std::string> draw_ellipse_arc(const P& center, int rx, int ry, float start_angle, float end_angle) {
+            expected<void, error> draw_ellipse_arc(const P& center, int rx, int ry, float start_angle, float end_angle) {
                 return draw_ellipse_arc(static_cast<int>(get_x(center)), 
                                       static_cast<int>(get_y(center)), 
                                       rx, ry, start_angle, end_angle);
@@ -1558,7 +1567,7 @@ namespace sdlpp {
              * @param end_angle Ending angle
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected<void, std::string> draw_ellipse_arc(int x, int y, int rx, int ry, 
+            expected<void, error> draw_ellipse_arc(int x, int y, int rx, int ry, 
                                                         euler::radian<float> start_angle, 
                                                         euler::radian<float> end_angle) {
                 return draw_ellipse_arc(x, y, rx, ry, start_angle.value(), end_angle.value());
@@ -1574,7 +1583,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<point_like P>
-            expected<void, std::string> draw_ellipse_arc(const P& center, int rx, int ry,
+            expected<void, error> draw_ellipse_arc(const P& center, int rx, int ry,
                                                         euler::radian<float> start_angle,
                                                         euler::radian<float> end_angle) {
                 return draw_ellipse_arc(static_cast<int>(get_x(center)), 
@@ -1592,7 +1601,7 @@ namespace sdlpp {
              * @param y2 Ending point Y coordinate
              * @return Expected<void> - empty on success, error message on failure
              */
-            SDLPP_EXPORT expected<void, std::string> draw_bezier_quad(float x0, float y0, float x1, float y1, float x2, float y2);
+            SDLPP_EXPORT expected<void, error> draw_bezier_quad(float x0, float y0, float x1, float y1, float x2, float y2);
 
             /**
              * @brief Draw a quadratic Bezier curve using DDA algorithm
@@ -1602,7 +1611,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<point_like P1, point_like P2, point_like P3>
-            expected<void, std::string> draw_bezier_quad(const P1& p0, const P2& p1, const P3& p2) {
+            expected<void, error> draw_bezier_quad(const P1& p0, const P2& p1, const P3& p2) {
                 return draw_bezier_quad(static_cast<float>(get_x(p0)), static_cast<float>(get_y(p0)),
                                       static_cast<float>(get_x(p1)), static_cast<float>(get_y(p1)),
                                       static_cast<float>(get_x(p2)), static_cast<float>(get_y(p2)));
@@ -1620,7 +1629,7 @@ namespace sdlpp {
              * @param y3 Ending point Y coordinate
              * @return Expected<void> - empty on success, error message on failure
              */
-            SDLPP_EXPORT expected<void, std::string> draw_bezier_cubic(float x0, float y0, float x1, float y1, 
+            SDLPP_EXPORT expected<void, error> draw_bezier_cubic(float x0, float y0, float x1, float y1, 
                                                                       float x2, float y2, float x3, float y3);
 
             /**
@@ -1632,7 +1641,7 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<point_like P1, point_like P2, point_like P3, point_like P4>
-            expected<void, std::string> draw_bezier_cubic(const P1& p0, const P2& p1, const P3& p2, const P4& p3) {
+            expected<void, error> draw_bezier_cubic(const P1& p0, const P2& p1, const P3& p2, const P4& p3) {
                 return draw_bezier_cubic(static_cast<float>(get_x(p0)), static_cast<float>(get_y(p0)),
                                        static_cast<float>(get_x(p1)), static_cast<float>(get_y(p1)),
                                        static_cast<float>(get_x(p2)), static_cast<float>(get_y(p2)),
@@ -1653,7 +1662,7 @@ namespace sdlpp {
                 { std::begin(c) };
                 { std::end(c) };
             }
-            SDLPP_EXPORT expected<void, std::string> draw_bspline(const Container& control_points, int degree = 3);
+            SDLPP_EXPORT expected<void, error> draw_bspline(const Container& control_points, int degree = 3);
 
             /**
              * @brief Draw a Catmull-Rom spline curve using DDA algorithm
@@ -1670,7 +1679,7 @@ namespace sdlpp {
                 { std::begin(c) };
                 { std::end(c) };
             }
-            SDLPP_EXPORT expected<void, std::string> draw_catmull_rom(const Container& points, float tension = 0.5f);
+            SDLPP_EXPORT expected<void, error> draw_catmull_rom(const Container& points, float tension = 0.5f);
 
             /**
              * @brief Draw a general parametric curve using DDA algorithm
@@ -1686,7 +1695,7 @@ namespace sdlpp {
             requires requires(CurveFunc f, float t) {
                 { f(t) } -> point_like;
             }
-            SDLPP_EXPORT expected<void, std::string> draw_curve(CurveFunc&& curve, 
+            SDLPP_EXPORT expected<void, error> draw_curve(CurveFunc&& curve, 
                                                                float t_start = 0.0f, 
                                                                float t_end = 1.0f, 
                                                                int steps = 100);
@@ -1705,9 +1714,9 @@ namespace sdlpp {
                 { std::begin(c) };
                 { std::end(c) };
             }
-            expected<void, std::string> draw_polygon(const Container& vertices, bool close = true) {
+            expected<void, error> draw_polygon(const Container& vertices, bool close = true) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
                 
                 auto count = std::distance(std::begin(vertices), std::end(vertices));
@@ -1729,7 +1738,7 @@ namespace sdlpp {
                 }
                 
                 if (!SDL_RenderLines(ptr.get(), sdl_points.data(), static_cast<int>(sdl_points.size()))) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
                 
                 return {};
@@ -1749,9 +1758,9 @@ namespace sdlpp {
                 { std::begin(c) };
                 { std::end(c) };
             }
-            expected<void, std::string> fill_polygon(const Container& vertices) {
+            expected<void, error> fill_polygon(const Container& vertices) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
                 
                 auto count = std::distance(std::begin(vertices), std::end(vertices));
@@ -1762,7 +1771,7 @@ namespace sdlpp {
                 // Get current draw color
                 auto color_result = get_draw_color();
                 if (!color_result) {
-                    return make_unexpectedf(color_result.error());
+                    return make_unexpected(color_result.error());
                 }
                 color draw_color = color_result.value();
                 
@@ -1801,9 +1810,9 @@ namespace sdlpp {
                 { std::begin(c) };
                 { std::end(c) };
             }
-            expected<void, std::string> draw_polygon_aa(const Container& vertices, bool close = true) {
+            expected<void, error> draw_polygon_aa(const Container& vertices, bool close = true) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid renderer");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
                 }
                 
                 auto it = std::begin(vertices);
@@ -14,14 +14,14 @@ namespace sdlpp {
             { std::begin(c) };
             { std::end(c) };
         }
-    expected <void, std::string> renderer::draw_bspline(const Container& control_points, int degree) {
+    expected <void, error> renderer::draw_bspline(const Container& control_points, int degree) {
         if (!ptr) {
-            return make_unexpectedf("Invalid renderer");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
         }
 
         auto points_count = static_cast <size_t>(std::distance(std::begin(control_points), std::end(control_points)));
         if (points_count < static_cast <size_t>(degree + 1)) {
-            return make_unexpectedf("Not enough control points for specified degree");
+            return make_error(errc::invalid_argument, error_subsystem::render, "Not enough control points for specified degree");
         }
 
         // Use euler's B-spline iterator with manual batching
@@ -62,14 +62,14 @@ namespace sdlpp {
             { std::begin(c) };
             { std::end(c) };
         }
-    expected <void, std::string> renderer::draw_catmull_rom(const Container& points, float tension) {
+    expected <void, error> renderer::draw_catmull_rom(const Container& points, float tension) {
         if (!ptr) {
-            return make_unexpectedf("Invalid renderer");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
         }
 
         auto points_count = static_cast <size_t>(std::distance(std::begin(points), std::end(points)));
         if (points_count < 2) {
-            return make_unexpectedf("Need at least 2 points for Catmull-Rom spline");
+            return make_error(errc::invalid_argument, error_subsystem::render, "Need at least 2 points for Catmull-Rom spline");
         }
 
         // Use euler's Catmull-Rom iterator with manual batching
@@ -107,20 +107,20 @@ namespace sdlpp {
         {
             { f(t) } -> point_like;
         }
-    expected <void, std::string> renderer::draw_curve(CurveFunc&& curve,
+    expected <void, error> renderer::draw_curve(CurveFunc&& curve,
                                                       float t_start,
                                                       float t_end,
                                                       int steps) {
         if (!ptr) {
-            return make_unexpectedf("Invalid renderer");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
         }
 
         if (steps <= 0) {
-            return make_unexpectedf("Steps must be positive");
+            return make_error(errc::invalid_argument, error_subsystem::render, "Steps must be positive");
         }
 
         if (t_start >= t_end) {
-            return make_unexpectedf("t_start must be less than t_end");
+            return make_error(errc::invalid_argument, error_subsystem::render, "t_start must be less than t_end");
         }
 
         // Use manual batching for parametric curves
@@ -19,6 +19,7 @@
 #include <cstdlib>
 #include <algorithm>
 #include <climits>
+#include <span>
 #include <vector>
 
 // Euler DDA includes (with warning suppression)
@@ -1262,6 +1263,24 @@ public:
         return {};
     }
     
+    /**
+     * @brief Blend the current draw color through an 8-bit coverage mask
+     * @param x Destination X of the mask's top-left corner
+     * @param y Destination Y of the mask's top-left corner
+     * @param mask Coverage values (0 = untouched, 255 = full draw color)
+     * @param width Mask width in pixels
+     * @param height Mask height in pixels
+     * @param pitch Bytes per mask row (0 means tightly packed)
+     * @return Expected<void> - empty on success, error message on failure
+     *
+     * Used for glyph and other alpha-only imagery rendered in software.
+     */
+    SDLPP_EXPORT expected<void, std::string> blend_mask(
+        int x, int y,
+        std::span<const uint8_t> mask,
+        int width, int height,
+        int pitch = 0);
+
     /**
      * @brief Fill a rectangle with gradient
      * @param rect Rectangle to fill
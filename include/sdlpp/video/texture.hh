@@ -85,14 +85,14 @@ namespace sdlpp {
              * @brief Get texture properties
              * @return Expected containing properties ID, or error message
              */
-            [[nodiscard]] expected <SDL_PropertiesID, std::string> get_properties() const {
+            [[nodiscard]] expected <SDL_PropertiesID, error> get_properties() const {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid texture");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
                 }
 
                 SDL_PropertiesID props = SDL_GetTextureProperties(ptr.get());
                 if (!props) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return props;
@@ -102,14 +102,14 @@ namespace sdlpp {
              * @brief Get texture size
              * @return Expected containing size, or error message
              */
-            [[nodiscard]] expected <size_i, std::string> get_size() const {
+            [[nodiscard]] expected <size_i, error> get_size() const {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid texture");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
                 }
 
                 float w, h;
                 if (!SDL_GetTextureSize(ptr.get(), &w, &h)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return size_i{static_cast <int>(w), static_cast <int>(h)};
@@ -120,13 +120,13 @@ namespace sdlpp {
              * @param mode Blend mode to set (defaults to none)
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> set_blend_mode(blend_mode mode = blend_mode::none) {
+            expected <void, error> set_blend_mode(blend_mode mode = blend_mode::none) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid texture");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
                 }
 
                 if (!SDL_SetTextureBlendMode(ptr.get(), static_cast <SDL_BlendMode>(mode))) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -136,14 +136,14 @@ namespace sdlpp {
              * @brief Get blend mode
              * @return Expected containing blend mode, or error message
              */
-            [[nodiscard]] expected <blend_mode, std::string> get_blend_mode() const {
+            [[nodiscard]] expected <blend_mode, error> get_blend_mode() const {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid texture");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
                 }
 
                 SDL_BlendMode mode;
                 if (!SDL_GetTextureBlendMode(ptr.get(), &mode)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return static_cast <blend_mode>(mode);
@@ -154,13 +154,13 @@ namespace sdlpp {
              * @param c Color for modulation (RGB components used)
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> set_color_mod(const color& c) {
+            expected <void, error> set_color_mod(const color& c) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid texture");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
                 }
 
                 if (!SDL_SetTextureColorMod(ptr.get(), c.r, c.g, c.b)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -170,14 +170,14 @@ namespace sdlpp {
              * @brief Get color modulation
              * @return Expected containing color, or error message
              */
-            [[nodiscard]] expected <color, std::string> get_color_mod() const {
+            [[nodiscard]] expected <color, error> get_color_mod() const {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid texture");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
                 }
 
                 uint8_t r, g, b;
                 if (!SDL_GetTextureColorMod(ptr.get(), &r, &g, &b)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return color{r, g, b, 255};
@@ -188,13 +188,13 @@ namespace sdlpp {
              * @param alpha Alpha value (0-255)
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> set_alpha_mod(uint8_t alpha) {
+            expected <void, error> set_alpha_mod(uint8_t alpha) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid texture");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
                 }
 
                 if (!SDL_SetTextureAlphaMod(ptr.get(), alpha)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -204,14 +204,14 @@ namespace sdlpp {
              * @brief Get alpha modulation
              * @return Expected containing alpha value, or error message
              */
-            [[nodiscard]] expected <uint8_t, std::string> get_alpha_mod() const {
+            [[nodiscard]] expected <uint8_t, error> get_alpha_mod() const {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid texture");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
                 }
 
                 uint8_t alpha;
                 if (!SDL_GetTextureAlphaMod(ptr.get(), &alpha)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return alpha;
@@ -222,13 +222,13 @@ namespace sdlpp {
              * @param mode Scale mode to use
              * @return Expected<void> - empty on success, error message on failure
              */
-            expected <void, std::string> set_scale_mode(scale_mode mode) {
+            expected <void, error> set_scale_mode(scale_mode mode) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid texture");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
                 }
 
                 if (!SDL_SetTextureScaleMode(ptr.get(), static_cast <SDL_ScaleMode>(mode))) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return {};
@@ -238,14 +238,14 @@ namespace sdlpp {
              * @brief Get scale mode
              * @return Expected containing scale mode, or error message
              */
-            [[nodiscard]] expected <scale_mode, std::string> get_scale_mode() const {
+            [[nodiscard]] expected <scale_mode, error> get_scale_mode() const {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid texture");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
                 }
 
                 SDL_ScaleMode mode;
                 if (!SDL_GetTextureScaleMode(ptr.get(), &mode)) {
-                    return make_unexpectedf(get_error());
+                    return make_sdl_error(error_subsystem::render);
                 }
 
                 return static_cast <scale_mode>(mode);
@@ -259,14 +259,14 @@ namespace sdlpp {
              * @return Expected<void> - empty on success, error message on failure
              */
             template<rect_like R = void>
-            expected <void, std::string> update(const std::optional <R>& update_rect,
+            expected <void, error> update(const std::optional <R>& update_rect,
                                                 const void* pixels, int pitch) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid texture");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
                 }
 
                 if (!pixels) {
-                    return make_unexpectedf("Invalid pixel data");
+                    return make_error(errc::invalid_argument, error_subsystem::render, "Invalid pixel data");
                 }
 
                 if (update_rect) {
@@ -277,11 +277,11 @@ namespace sdlpp {
                         static_cast<int>(get_height(*update_rect))
                     };
                     if (!SDL_UpdateTexture(ptr.get(), &sdl_rect, pixels, pitch)) {
-                        return make_unexpectedf(get_error());
+                        return make_sdl_error(error_subsystem::render);
                     }
                 } else {
                     if (!SDL_UpdateTexture(ptr.get(), nullptr, pixels, pitch)) {
-                        return make_unexpectedf(get_error());
+                        return make_sdl_error(error_subsystem::render);
                     }
                 }
 
@@ -295,9 +295,9 @@ namespace sdlpp {
              * @note Only works for streaming textures
              */
             template<rect_like R = void>
-            expected <std::pair <void*, int>, std::string> lock(const std::optional <R>& lock_rect = std::nullopt) {
+            expected <std::pair <void*, int>, error> lock(const std::optional <R>& lock_rect = std::nullopt) {
                 if (!ptr) {
-                    return make_unexpectedf("Invalid texture");
+                    return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
                 }
 
                 void* pixels;
@@ -311,11 +311,11 @@ namespace sdlpp {
                         static_cast<int>(get_height(*lock_rect))
                     };
                     if (!SDL_LockTexture(ptr.get(), &sdl_rect, &pixels, &pitch)) {
-                        return make_unexpectedf(get_error());
+                        return make_sdl_error(error_subsystem::render);
                     }
                 } else {
                     if (!SDL_LockTexture(ptr.get(), nullptr, &pixels, &pitch)) {
-                        return make_unexpectedf(get_error());
+                        return make_sdl_error(error_subsystem::render);
                     }
                 }
 
@@ -429,16 +429,16 @@ namespace sdlpp {
 
     // Now add texture-related methods to renderer
     template<rect_like R>
-    inline expected <void, std::string> renderer::copy(
+    inline expected <void, error> renderer::copy(
         const texture& texture,
         const std::optional <R>& src_rect,
         const std::optional <R>& dst_rect) {
         if (!ptr) {
-            return make_unexpectedf("Invalid renderer");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
         }
 
         if (!texture) {
-            return make_unexpectedf("Invalid texture");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
         }
 
         SDL_FRect src, dst;
@@ -462,7 +462,7 @@ namespace sdlpp {
         }
 
         if (!SDL_RenderTexture(ptr.get(), texture.get(), src_ptr, dst_ptr)) {
-            return make_unexpectedf(get_error());
+            return make_sdl_error(error_subsystem::render);
         }
 
         return {};
@@ -470,16 +470,16 @@ namespace sdlpp {
 
     template<rect_like R>
     requires std::is_floating_point_v<typename R::value_type>
-    inline expected <void, std::string> renderer::copy(
+    inline expected <void, error> renderer::copy(
         const texture& texture,
         const std::optional <R>& src_rect,
         const std::optional <R>& dst_rect) {
         if (!ptr) {
-            return make_unexpectedf("Invalid renderer");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
         }
 
         if (!texture) {
-            return make_unexpectedf("Invalid texture");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
         }
 
         SDL_FRect src, dst;
@@ -497,14 +497,14 @@ namespace sdlpp {
         }
 
         if (!SDL_RenderTexture(ptr.get(), texture.get(), src_ptr, dst_ptr)) {
-            return make_unexpectedf(get_error());
+            return make_sdl_error(error_subsystem::render);
         }
 
         return {};
     }
 
     template<rect_like R, point_like P>
-    inline expected <void, std::string> renderer::copy_ex(
+    inline expected <void, error> renderer::copy_ex(
         const texture& texture,
         const std::optional <R>& src_rect,
         const std::optional <R>& dst_rect,
@@ -512,11 +512,11 @@ namespace sdlpp {
         const std::optional <P>& center,
         flip_mode flip) {
         if (!ptr) {
-            return make_unexpectedf("Invalid renderer");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
         }
 
         if (!texture) {
-            return make_unexpectedf("Invalid texture");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
         }
 
         SDL_FRect src, dst;
@@ -544,7 +544,7 @@ namespace sdlpp {
                                       src_ptr, dst_ptr,
                                       angle, cnt_ptr,
                                       static_cast <SDL_FlipMode>(flip))) {
-            return make_unexpectedf(get_error());
+            return make_sdl_error(error_subsystem::render);
         }
 
         return {};
@@ -553,7 +553,7 @@ namespace sdlpp {
     template<rect_like R, point_like P>
     requires (std::is_floating_point_v<typename R::value_type> && 
              std::is_floating_point_v<typename P::value_type>)
-    inline expected <void, std::string> renderer::copy_ex(
+    inline expected <void, error> renderer::copy_ex(
         const texture& texture,
         const std::optional <R>& src_rect,
         const std::optional <R>& dst_rect,
@@ -561,11 +561,11 @@ namespace sdlpp {
         const std::optional <P>& center,
         flip_mode flip) {
         if (!ptr) {
-            return make_unexpectedf("Invalid renderer");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
         }
 
         if (!texture) {
-            return make_unexpectedf("Invalid texture");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
         }
 
         SDL_FRect src, dst;
@@ -593,7 +593,7 @@ namespace sdlpp {
                                       src_ptr, dst_ptr,
                                       angle, cnt_ptr,
                                       static_cast <SDL_FlipMode>(flip))) {
-            return make_unexpectedf(get_error());
+            return make_sdl_error(error_subsystem::render);
         }
 
         return {};
@@ -626,7 +626,7 @@ namespace sdlpp {
      * @endcode
      */
     template<rect_like R>
-    inline expected<void, std::string> renderer::copy_9grid_tiled(
+    inline expected<void, error> renderer::copy_9grid_tiled(
         const texture& texture,
         const std::optional<R>& src_rect,
         float left_width, float right_width,
@@ -635,11 +635,11 @@ namespace sdlpp {
         const R& dst_rect,
         float tile_scale) {
         if (!ptr) {
-            return make_unexpectedf("Invalid renderer");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
         }
 
         if (!texture) {
-            return make_unexpectedf("Invalid texture");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid texture");
         }
 
         SDL_FRect src;
@@ -667,15 +667,15 @@ namespace sdlpp {
                                          left_width, right_width,
                                          top_height, bottom_height,
                                          scale, &dst, tile_scale)) {
-            return make_unexpectedf(get_error());
+            return make_sdl_error(error_subsystem::render);
         }
 
         return {};
     }
 
-    inline expected <texture, std::string> renderer::get_target() const {
+    inline expected <texture, error> renderer::get_target() const {
         if (!ptr) {
-            return make_unexpectedf("Invalid renderer");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
         }
 
         SDL_Texture* target = SDL_GetRenderTarget(ptr.get());
@@ -688,16 +688,16 @@ namespace sdlpp {
         return texture(target);
     }
 
-    inline expected <void, std::string> renderer::set_target(const texture& target) {
+    inline expected <void, error> renderer::set_target(const texture& target) {
         if (!ptr) {
-            return make_unexpectedf("Invalid renderer");
+            return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
         }
 
         // nullptr means render to default target (window)
         SDL_Texture* tex_ptr = target ? target.get() : nullptr;
 
         if (!SDL_SetRenderTarget(ptr.get(), tex_ptr)) {
-            return make_unexpectedf(get_error());
+            return make_sdl_error(error_subsystem::render);
         }
 
         return {};
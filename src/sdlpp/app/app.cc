@@ -2,8 +2,34 @@
 // Created by igor on 12/01/2026.
 //
 #include <sdlpp/app/app.hh>
+#include <string>
+#include <utility>
 
 namespace sdlpp {
+    namespace {
+        std::string subsystem_phase_name(init_flags flags) {
+            static constexpr std::pair<init_flags, const char*> names[] = {
+                {init_flags::audio, "audio"},
+                {init_flags::video, "video"},
+                {init_flags::joystick, "joystick"},
+                {init_flags::haptic, "haptic"},
+                {init_flags::gamepad, "gamepad"},
+                {init_flags::events, "events"},
+                {init_flags::sensor, "sensor"},
+                {init_flags::camera, "camera"},
+            };
+
+            std::string name = "init";
+            for (const auto& [flag, label] : names) {
+                if (has_flag(flags, flag)) {
+                    name += ' ';
+                    name += label;
+                }
+            }
+            return name;
+        }
+    }
+
     abstract_application::abstract_application(init_flags flags): init_flags_(flags) {}
 
     void abstract_application::on_init([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {}
@@ -66,7 +92,36 @@ namespace sdlpp {
         return running_.load(std::memory_order_acquire);
     }
 
-    void abstract_application::init_sdl_() { sdl_init_.emplace(init_flags_); }
+    job_system& abstract_application::jobs() {
+        if (!jobs_) {
+            jobs_ = std::make_unique<job_system>();
+        }
+        return *jobs_;
+    }
+
+    phase_profiler& abstract_application::startup_profile() noexcept { return startup_profile_; }
+
+    const phase_profiler& abstract_application::startup_profile() const noexcept { return startup_profile_; }
+
+    bool abstract_application::require_subsystem(init_flags flags) {
+        if (!sdl_init_) {
+            return false;
+        }
+        if (sdl_init_->was_init(flags)) {
+            return true;
+        }
+        auto phase = startup_profile_.begin(subsystem_phase_name(flags));
+        return sdl_init_->init_subsystem(flags);
+    }
+
+    void abstract_application::init_sdl_() {
+        auto phase = startup_profile_.begin("sdl_init");
+        sdl_init_.emplace(init_flags_);
+    }
 
-    void abstract_application::shutdown_sdl_() noexcept { sdl_init_.reset(); }
+    void abstract_application::shutdown_sdl_() noexcept {
+        // Workers may still be running jobs that use SDL
+        jobs_.reset();
+        sdl_init_.reset();
+    }
 }
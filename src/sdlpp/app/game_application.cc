@@ -3,11 +3,219 @@
 //
 
 #include <sdlpp/app/game_application.hh>
+#include <sdlpp/config/hints.hh>
+#include <sdlpp/core/profiler.hh>
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 namespace sdlpp {
+    /**
+     * @brief Runs on_update batches on a dedicated thread, one batch per frame
+     */
+    struct game_application::update_worker {
+        explicit update_worker(game_application& app)
+            : app_(app), thread_([this] { run(); }) {}
+
+        ~update_worker() {
+            {
+                std::lock_guard lock(mutex_);
+                stop_ = true;
+            }
+            cv_.notify_all();
+            thread_.join();
+        }
+
+        update_worker(const update_worker&) = delete;
+        update_worker& operator=(const update_worker&) = delete;
+
+        void start(int steps, float delta) {
+            {
+                std::lock_guard lock(mutex_);
+                steps_ = steps;
+                delta_ = delta;
+                pending_ = true;
+            }
+            cv_.notify_all();
+        }
+
+        // Wait for the batch and rethrow anything on_update threw
+        void finish() {
+            std::unique_lock lock(mutex_);
+            cv_.wait(lock, [this] { return !pending_; });
+            if (error_) {
+                std::rethrow_exception(std::exchange(error_, nullptr));
+            }
+        }
+
+        // Wait for the batch and drop its exception (the frame is already failing)
+        void abandon() noexcept {
+            std::unique_lock lock(mutex_);
+            cv_.wait(lock, [this] { return !pending_; });
+            error_ = nullptr;
+        }
+
+    private:
+        void run() {
+            SDLPP_PROFILE_THREAD("update worker");
+            std::unique_lock lock(mutex_);
+            for (;;) {
+                cv_.wait(lock, [this] { return pending_ || stop_; });
+                if (stop_) {
+                    return;
+                }
+
+                const int steps = steps_;
+                const float delta = delta_;
+                lock.unlock();
+                try {
+                    app_.run_updates(steps, delta);
+                } catch (...) {
+                    lock.lock();
+                    error_ = std::current_exception();
+                    lock.unlock();
+                }
+                lock.lock();
+
+                pending_ = false;
+                cv_.notify_all();
+            }
+        }
+
+        game_application& app_;
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        int steps_ = 0;
+        float delta_ = 0.0f;
+        bool pending_ = false;
+        bool stop_ = false;
+        std::exception_ptr error_;
+        std::thread thread_;  // Last: started once the state above exists
+    };
+
     game_application::game_application() = default;
     game_application::~game_application() = default;
 
+    void game_application::run_updates(int steps, float delta) {
+        SDLPP_PROFILE_ZONE("game_application::update");
+        for (int i = 0; i < steps; ++i) {
+            on_update(delta);
+        }
+    }
+
+    bool game_application::is_pipelined() const { return worker_ != nullptr && !worker_release_; }
+
+    void game_application::set_pipelined(bool enabled) {
+        if (enabled) {
+            worker_release_ = false;
+            if (!worker_) {
+                worker_ = std::make_unique<update_worker>(*this);
+            }
+        } else if (worker_batch_) {
+            // Called from on_render: the worker is mid-batch, stop it once
+            // the frame has waited for it
+            worker_release_ = true;
+        } else {
+            worker_.reset();
+        }
+    }
+
+    bool game_application::is_on_demand() const {
+        return on_demand_.load(std::memory_order_relaxed);
+    }
+
+    void game_application::set_on_demand(bool enabled) {
+        if (enabled && wake_event_type_.load(std::memory_order_relaxed) == 0) {
+            auto type = event_registry::register_events(1);
+            if (!type) {
+                throw std::runtime_error("Failed to register redraw event: " + type.error());
+            }
+            wake_event_type_.store(*type, std::memory_order_relaxed);
+        }
+
+        on_demand_.store(enabled, std::memory_order_release);
+        frame_needed_ = true;
+        if (!enabled) {
+            set_wait_for_events(false);
+        }
+    }
+
+    void game_application::request_redraw() {
+        redraw_requested_.store(true, std::memory_order_release);
+        if (!on_demand_.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        // One wake-up event in flight is enough
+        if (wake_pending_.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+        SDL_Event e{};
+        e.type = wake_event_type_.load(std::memory_order_relaxed);
+        e.user.type = e.type;
+        e.user.timestamp = SDL_GetTicksNS();
+        if (!SDL_PushEvent(&e)) {
+            wake_pending_.store(false, std::memory_order_release);
+        }
+    }
+
+    void game_application::request_redraw_after(clock::duration delay) {
+        const auto deadline = clock::now() + delay;
+        if (redraw_timer_.is_active() && redraw_at_ <= deadline) {
+            return;
+        }
+
+        auto timer = timer_handle_ns::create(
+            std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(delay), std::chrono::nanoseconds(1)),
+            [this](std::chrono::nanoseconds) {
+                request_redraw();
+                return std::chrono::nanoseconds(0);
+            });
+        if (!timer) {
+            // No timer available: redraw now rather than never
+            request_redraw();
+            return;
+        }
+        redraw_timer_ = std::move(*timer);
+        redraw_at_ = deadline;
+    }
+
+    void game_application::animate_until(time_point deadline) {
+        const auto ticks = deadline.time_since_epoch().count();
+        auto current = animating_until_.load(std::memory_order_relaxed);
+        while (ticks > current &&
+               !animating_until_.compare_exchange_weak(current, ticks, std::memory_order_relaxed)) {
+        }
+        request_redraw();
+    }
+
+    void game_application::animate_for(clock::duration length) {
+        animate_until(clock::now() + length);
+    }
+
+    bool game_application::is_animating() const {
+        return clock::now().time_since_epoch().count() < animating_until_.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t game_application::skipped_frames() const { return skipped_frames_; }
+
+    void game_application::set_wait_for_events(bool wait) {
+        if (wait == waiting_for_events_) {
+            return;
+        }
+        waiting_for_events_ = wait;
+
+        // SDL owns the loop in the main-callback model; this hint makes it
+        // block in SDL_WaitEvent() between iterations
+        if (wait) {
+            [[maybe_unused]] bool ok = hint_manager::set(hints::main_callback_rate, "waitevent");
+        } else {
+            [[maybe_unused]] bool ok = hint_manager::reset(hints::main_callback_rate);
+        }
+    }
+
     std::optional<surface> game_application::get_window_icon() { return std::nullopt; }
 
     void game_application::on_config([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {}
@@ -18,6 +226,10 @@ namespace sdlpp {
 
     void game_application::on_render([[maybe_unused]] renderer& r) {}
 
+    void game_application::on_render(renderer& r, [[maybe_unused]] float alpha) {
+        on_render(r);
+    }
+
     void game_application::on_window_shown() {}
 
     void game_application::on_window_hidden() {}
@@ -77,12 +289,51 @@ namespace sdlpp {
 
     void game_application::set_target_fps(int fps) {
         target_fps_ = fps;
-        if (fps > 0) {
-            frame_duration_ = duration(1.0f / static_cast<float>(fps));
+        pacer_.set_target_fps(static_cast<double>(fps));
+    }
+
+    const frame_pacer& game_application::pacer() const { return pacer_; }
+
+    int game_application::tick_rate() const {
+        if (tick_duration_.count() <= 0) {
+            return 0;
+        }
+        return static_cast<int>(std::chrono::seconds(1) / tick_duration_);
+    }
+
+    void game_application::set_tick_rate(int hz) {
+        if (hz > 0) {
+            tick_duration_ = std::chrono::duration_cast<clock::duration>(std::chrono::seconds(1)) / hz;
+            tick_seconds_ = 1.0f / static_cast<float>(hz);
+        } else {
+            tick_duration_ = clock::duration::zero();
+            tick_seconds_ = 0.0f;
         }
+        accumulator_ = clock::duration::zero();
+    }
+
+    int game_application::max_catch_up_steps() const { return max_catch_up_steps_; }
+
+    void game_application::set_max_catch_up_steps(int steps) {
+        max_catch_up_steps_ = steps > 0 ? steps : 1;
     }
 
+    float game_application::interpolation_alpha() const { return alpha_; }
+
+    std::uint64_t game_application::tick_count() const { return tick_count_; }
+
+    std::uint64_t game_application::dropped_ticks() const { return dropped_ticks_; }
+
     void game_application::on_event(const event& e) {
+        const Uint32 wake_type = wake_event_type_.load(std::memory_order_relaxed);
+        if (wake_type != 0 && static_cast<Uint32>(e.type()) == wake_type) {
+            wake_pending_.store(false, std::memory_order_release);
+            return;
+        }
+
+        // Anything else may change what is on screen
+        frame_needed_ = true;
+
         // Dispatch window events
         if (e.is<window_event>()) {
             auto* we = e.as<window_event>();
@@ -142,38 +393,47 @@ namespace sdlpp {
     }
 
     void game_application::on_init(int argc, char* argv[]) {
+        auto& profile = startup_profile();
+
         // Configure failsafe to use SDL logging
-        failsafe::logger::set_backend(create_failsafe_sdl_backend());
+        profile.measure("failsafe_backend", [] {
+            failsafe::logger::set_backend(create_failsafe_sdl_backend());
+        });
 
         // Let user handle command line args
-        on_config(argc, argv);
+        profile.measure("on_config", [&] { on_config(argc, argv); });
 
         // Get window configuration
         auto config = get_window_config();
-        target_fps_ = config.target_fps;
-        if (target_fps_ > 0) {
-            frame_duration_ = duration(1.0f / static_cast<float>(target_fps_));
-        }
+        set_target_fps(config.target_fps);
+        set_tick_rate(config.tick_rate);
+        set_max_catch_up_steps(config.max_catch_up_steps);
 
         // Create window
-        auto window_result = window::create(config.title, config.width, config.height, config.flags);
-        if (!window_result) {
-            throw std::runtime_error("Failed to create window: " + window_result.error());
-        }
-        window_ = std::move(window_result.value());
+        {
+            auto phase = profile.begin("window");
+            auto window_result = window::create(config.title, config.width, config.height, config.flags);
+            if (!window_result) {
+                throw std::runtime_error("Failed to create window: " + window_result.error());
+            }
+            window_ = std::move(window_result.value());
 
-        // Set icon if provided
-        auto icon = get_window_icon();
-        if (icon) {
-            window_.set_icon(icon->get());
+            // Set icon if provided
+            auto icon = get_window_icon();
+            if (icon) {
+                window_.set_icon(icon->get());
+            }
         }
 
         // Create renderer
-        auto renderer_result = renderer::create(window_);
-        if (!renderer_result) {
-            throw std::runtime_error("Failed to create renderer: " + renderer_result.error());
+        {
+            auto phase = profile.begin("renderer");
+            auto renderer_result = renderer::create(window_);
+            if (!renderer_result) {
+                throw std::runtime_error("Failed to create renderer: " + renderer_result.error());
+            }
+            renderer_ = std::move(renderer_result.value());
         }
-        renderer_ = std::move(renderer_result.value());
 
         // Initialize timing
         last_frame_time_ = clock::now();
@@ -181,12 +441,46 @@ namespace sdlpp {
         frame_count_ = 0;
 
         // Let user do post-init
-        on_ready();
+        profile.measure("on_ready", [this] { on_ready(); });
+
+        // Start the update thread last, so on_ready runs alone
+        set_pipelined(config.pipelined);
+        if (config.on_demand) {
+            set_on_demand(true);
+        }
+    }
+
+    void game_application::render_frame() {
+        SDLPP_PROFILE_ZONE("game_application::render");
+        on_render(renderer_, alpha_);
     }
 
     void game_application::on_iterate() {
         auto current_time = clock::now();
 
+        const bool on_demand = on_demand_.load(std::memory_order_acquire);
+        if (on_demand) {
+            const bool redraw = redraw_requested_.exchange(false, std::memory_order_acq_rel);
+            if (!frame_needed_ && !redraw &&
+                current_time.time_since_epoch().count() >= animating_until_.load(std::memory_order_relaxed)) {
+                idle_ = true;
+                ++skipped_frames_;
+                set_wait_for_events(true);
+                return;
+            }
+            frame_needed_ = false;
+
+            if (idle_) {
+                // Waking up: the idle gap is not simulated time
+                idle_ = false;
+                last_frame_time_ = current_time;
+                accumulator_ = clock::duration::zero();
+                pacer_.reset();
+            }
+        }
+
+        SDLPP_PROFILE_FRAME();
+
         // Calculate delta time
         duration delta = current_time - last_frame_time_;
         delta_time_ = delta.count();
@@ -200,19 +494,71 @@ namespace sdlpp {
             fps_update_time_ = current_time;
         }
 
+        // Work out how many updates this frame needs
+        int steps = 1;
+        float step_delta = delta_time_;
+        float next_alpha = 1.0f;
+        if (tick_duration_ > clock::duration::zero()) {
+            accumulator_ += current_time - last_frame_time_;
+
+            const auto due = accumulator_ / tick_duration_;
+            steps = static_cast<int>(std::min<decltype(due)>(due, max_catch_up_steps_));
+            accumulator_ -= tick_duration_ * steps;
+
+            // Too far behind: drop whole ticks instead of spiralling
+            if (accumulator_ >= tick_duration_) {
+                dropped_ticks_ += static_cast<std::uint64_t>(accumulator_ / tick_duration_);
+                accumulator_ %= tick_duration_;
+            }
+
+            step_delta = tick_seconds_;
+            tick_count_ += static_cast<std::uint64_t>(steps);
+            next_alpha = std::chrono::duration<float>(accumulator_) / std::chrono::duration<float>(tick_duration_);
+        }
+
         // Call user callbacks
-        on_update(delta_time_);
-        on_render(renderer_);
+        if (worker_) {
+            // Update the next frame on the worker while this thread renders
+            // the state published by the previous update
+            update_worker& worker = *worker_;
+            worker.start(steps, step_delta);
+            worker_batch_ = true;
+
+            // on_update is running against the application's state: wait for
+            // it even if on_render throws, before anything is torn down
+            struct batch_guard {
+                game_application& app;
+                update_worker& worker;
+
+                ~batch_guard() {
+                    worker.abandon();
+                    app.worker_batch_ = false;
+                    if (app.worker_release_) {
+                        app.worker_release_ = false;
+                        app.worker_.reset();
+                    }
+                }
+            } guard{*this, worker};
+
+            render_frame();
+            worker.finish();
+            alpha_ = next_alpha;
+        } else {
+            run_updates(steps, step_delta);
+            alpha_ = next_alpha;
+            render_frame();
+        }
 
-        // Enforce FPS limit
-        if (target_fps_ > 0) {
-            auto frame_end = clock::now();
-            duration frame_time = frame_end - last_frame_time_;
+        // Keep iterating while animating or a redraw is queued, otherwise
+        // let the next iteration block until an event arrives
+        if (on_demand) {
+            set_wait_for_events(!is_animating() && !redraw_requested_.load(std::memory_order_acquire));
+        }
 
-            if (frame_time < frame_duration_) {
-                duration sleep_time = frame_duration_ - frame_time;
-                std::this_thread::sleep_for(sleep_time);
-            }
+        // Enforce FPS limit against absolute deadlines
+        if (target_fps_ > 0) {
+            SDLPP_PROFILE_ZONE("frame_pacer::wait");
+            pacer_.wait();
         }
 
         last_frame_time_ = current_time;
@@ -0,0 +1,405 @@
+#include <sdlpp/core/async_log_backend.hh>
+
+#include <algorithm>
+#include <bit>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+namespace sdlpp {
+    struct async_log_backend::record {
+        std::int64_t timestamp_ns;
+        std::thread::id thread;
+        log_priority priority;
+        int line;
+        std::uint16_t category_length;
+        std::uint16_t file_length;
+        std::uint16_t message_length;
+        bool truncated;
+        char text[record_text_capacity];  // Category, file and message back to back
+    };
+
+    struct async_log_backend::slot {
+        // position + 1 once the record at position is written, position + capacity once emitted
+        std::atomic <std::uint64_t> sequence{0};
+        record rec;
+    };
+
+    namespace {
+        constexpr std::size_t max_category_length = 32;
+        constexpr std::size_t max_file_length = 128;
+
+        constexpr int crash_signals[] = {SIGSEGV, SIGABRT, SIGFPE, SIGILL};
+        using signal_handler = void (*)(int);
+
+        std::atomic <async_log_backend*> crash_backend{nullptr};
+        std::terminate_handler previous_terminate = nullptr;
+        signal_handler previous_signals[std::size(crash_signals)] = {};
+        std::once_flag crash_handlers_installed;
+
+        std::uint16_t copy_text(char* out, std::string_view text) {
+            if (!text.empty()) {
+                std::memcpy(out, text.data(), text.size());
+            }
+            return static_cast <std::uint16_t>(text.size());
+        }
+    } // anonymous namespace
+
+    async_log_backend::async_log_backend()
+        : async_log_backend(config{}) {
+    }
+
+    async_log_backend::async_log_backend(const config& cfg)
+        : config_(cfg) {
+        const std::size_t capacity = std::bit_ceil(std::max <std::size_t>(config_.capacity, 2));
+        mask_ = capacity - 1;
+        slots_ = std::make_unique <slot[]>(capacity);
+        for (std::size_t i = 0; i < capacity; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        writer_ = std::thread([this] { run(); });
+    }
+
+    async_log_backend::~async_log_backend() {
+        async_log_backend* self = this;
+        crash_backend.compare_exchange_strong(self, nullptr);
+
+        {
+            std::lock_guard lock(mutex_);
+            stop_.store(true, std::memory_order_release);
+        }
+        wake_cv_.notify_all();
+        writer_.join();
+    }
+
+    bool async_log_backend::claim(std::uint64_t& position) {
+        position = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            const auto sequence = slots_[position & mask_].sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast <std::int64_t>(sequence - position);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    return true;
+                }
+            } else if (diff < 0) {
+                // Full. The writer itself must never wait for room it has to make.
+                if (config_.overflow != overflow_policy::block ||
+                    stop_.load(std::memory_order_relaxed) ||
+                    std::this_thread::get_id() == writer_.get_id()) {
+                    return false;
+                }
+                wake_cv_.notify_one();
+                std::this_thread::yield();
+                position = tail_.load(std::memory_order_relaxed);
+            } else {
+                position = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool async_log_backend::log(log_priority priority, std::string_view category,
+                                const char* file, int line, std::string_view message) {
+        std::uint64_t position = 0;
+        if (!claim(position)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        auto& s = slots_[position & mask_];
+        auto& r = s.rec;
+        r.timestamp_ns = std::chrono::duration_cast <std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        r.thread = std::this_thread::get_id();
+        r.priority = priority;
+        r.line = line;
+
+        // Keep the end of long paths: the file name is the useful part
+        std::string_view file_name = file ? std::string_view(file) : std::string_view();
+        if (file_name.size() > max_file_length) {
+            file_name.remove_prefix(file_name.size() - max_file_length);
+        }
+        category = category.substr(0, max_category_length);
+        const std::size_t room = record_text_capacity - category.size() - file_name.size();
+
+        char* out = r.text;
+        r.category_length = copy_text(out, category);
+        out += r.category_length;
+        r.file_length = copy_text(out, file_name);
+        out += r.file_length;
+        r.message_length = copy_text(out, message.substr(0, room));
+        r.truncated = message.size() > room;
+
+        s.sequence.store(position + 1, std::memory_order_release);
+
+        // Waking the writer per message would cost a syscall each; it polls
+        // every idle_wait instead, and is woken early for errors or once
+        // the queue is half full
+        if ((priority >= log_priority::error ||
+             position - head_.load(std::memory_order_relaxed) >= (mask_ + 1) / 2) &&
+            writer_sleeping_.load(std::memory_order_relaxed)) {
+            wake_cv_.notify_one();
+        }
+        return true;
+    }
+
+    void async_log_backend::flush() {
+        const auto target = tail_.load(std::memory_order_acquire);
+        if (std::this_thread::get_id() == writer_.get_id()) {
+            return;
+        }
+
+        std::unique_lock lock(mutex_);
+        wake_cv_.notify_one();
+        flushed_cv_.wait(lock, [this, target] {
+            return head_.load(std::memory_order_acquire) >= target;
+        });
+    }
+
+    void async_log_backend::map_category(const std::string& name, int sdl_category) {
+        std::lock_guard lock(mutex_);
+        category_map_[name] = sdl_category;
+    }
+
+    void async_log_backend::set_default_category(int category) {
+        std::lock_guard lock(mutex_);
+        default_category_ = category;
+    }
+
+    bool async_log_backend::pending() const noexcept {
+        const auto head = head_.load(std::memory_order_relaxed);
+        return slots_[head & mask_].sequence.load(std::memory_order_acquire) == head + 1;
+    }
+
+    void async_log_backend::run() {
+        std::string line;
+        for (;;) {
+            if (drain(line)) {
+                // Empty critical section: a flusher between its check and
+                // its wait cannot miss this notification
+                { std::lock_guard lock(mutex_); }
+                flushed_cv_.notify_all();
+            }
+
+            std::unique_lock lock(mutex_);
+            if (stop_.load(std::memory_order_acquire)) {
+                lock.unlock();
+                drain(line);
+                { std::lock_guard relock(mutex_); }
+                flushed_cv_.notify_all();
+                return;
+            }
+
+            writer_sleeping_.store(true, std::memory_order_relaxed);
+            wake_cv_.wait_for(lock, config_.idle_wait, [this] {
+                return stop_.load(std::memory_order_acquire) || pending();
+            });
+            writer_sleeping_.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    bool async_log_backend::drain(std::string& line) {
+        if (draining_.test_and_set(std::memory_order_acquire)) {
+            return false;
+        }
+        const bool emitted = drain_records(line);
+        report_drops(line);
+        draining_.clear(std::memory_order_release);
+        return emitted;
+    }
+
+    bool async_log_backend::drain_records(std::string& line) {
+        bool emitted = false;
+        auto head = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& s = slots_[head & mask_];
+            if (s.sequence.load(std::memory_order_acquire) != head + 1) {
+                break;
+            }
+            emit(s.rec, line);
+            s.sequence.store(head + mask_ + 1, std::memory_order_release);
+            head_.store(++head, std::memory_order_release);
+            emitted = true;
+        }
+        return emitted;
+    }
+
+    void async_log_backend::emit(const record& r, std::string& line) {
+        const std::string_view category(r.text, r.category_length);
+        const std::string_view file(r.text + r.category_length, r.file_length);
+        const std::string_view message(r.text + r.category_length + r.file_length, r.message_length);
+
+        int sdl_category = 0;
+        try {
+            line.clear();
+            if (config_.show_timestamp) {
+                line += '[';
+                append_timestamp(line, r.timestamp_ns);
+                line += "] ";
+            }
+            if (config_.show_thread_id) {
+                if (r.thread != cached_thread_) {
+                    std::ostringstream oss;
+                    oss << r.thread;
+                    cached_thread_ = r.thread;
+                    cached_thread_text_ = oss.str();
+                }
+                line += '[';
+                line += cached_thread_text_;
+                line += "] ";
+            }
+            if (!category.empty()) {
+                line += '[';
+                line += category;
+                line += "] ";
+            }
+            if (config_.show_file_line && !file.empty()) {
+                line += '[';
+                line += file;
+                line += ':';
+                line += std::to_string(r.line);
+                line += "] ";
+            }
+            line += message;
+            if (r.truncated) {
+                line += "...";
+            }
+
+            category_key_.assign(category);
+            std::lock_guard lock(mutex_);
+            const auto it = category_map_.find(category_key_);
+            sdl_category = it != category_map_.end() ? it->second : default_category_;
+        } catch (...) {
+            return;  // Out of memory: lose this message rather than the writer
+        }
+
+        SDL_LogMessage(sdl_category, to_sdl_priority(r.priority), "%s", line.c_str());
+    }
+
+    void async_log_backend::append_timestamp(std::string& line, std::int64_t timestamp_ns) {
+        const std::int64_t second = timestamp_ns / 1'000'000'000;
+        if (second != cached_second_) {
+            const auto time_t_val = static_cast <std::time_t>(second);
+            std::tm tm{};
+#if defined(_MSC_VER)
+            localtime_s(&tm, &time_t_val);
+#else
+            localtime_r(&time_t_val, &tm);
+#endif
+            std::ostringstream oss;
+            oss << std::put_time(&tm, config_.timestamp_format.c_str());
+            cached_timestamp_ = oss.str();
+            cached_second_ = second;
+        }
+
+        const auto ms = static_cast <int>((timestamp_ns / 1'000'000) % 1000);
+        line += cached_timestamp_;
+        line += '.';
+        line += static_cast <char>('0' + ms / 100);
+        line += static_cast <char>('0' + ms / 10 % 10);
+        line += static_cast <char>('0' + ms % 10);
+    }
+
+    void async_log_backend::report_drops(std::string& line) {
+        const auto dropped = dropped_.load(std::memory_order_relaxed);
+        if (dropped == reported_drops_) {
+            return;
+        }
+        const auto lost = dropped - reported_drops_;
+        reported_drops_ = dropped;
+
+        if (config_.overflow == overflow_policy::count) {
+            try {
+                line = std::to_string(lost) + " log message(s) dropped: queue full";
+            } catch (...) {
+                return;
+            }
+            int sdl_category = 0;
+            {
+                std::lock_guard lock(mutex_);
+                sdl_category = default_category_;
+            }
+            SDL_LogMessage(sdl_category, to_sdl_priority(log_priority::warn), "%s", line.c_str());
+        }
+    }
+
+    void async_log_backend::install_crash_handler() {
+        crash_backend.store(this, std::memory_order_release);
+        std::call_once(crash_handlers_installed, [] {
+            previous_terminate = std::set_terminate(&async_log_backend::handle_terminate);
+            for (std::size_t i = 0; i < std::size(crash_signals); ++i) {
+                const auto previous = std::signal(crash_signals[i], &async_log_backend::handle_signal);
+                previous_signals[i] = previous == SIG_ERR ? SIG_DFL : previous;
+            }
+        });
+    }
+
+    void async_log_backend::flush_from_crash() noexcept {
+        try {
+            std::string line;
+            if (std::this_thread::get_id() == writer_.get_id()) {
+                // The writer crashed while emitting: skip that record and
+                // emit the rest from here
+                const auto head = head_.load(std::memory_order_relaxed);
+                if (draining_.test(std::memory_order_relaxed) && pending()) {
+                    slots_[head & mask_].sequence.store(head + mask_ + 1, std::memory_order_relaxed);
+                    head_.store(head + 1, std::memory_order_relaxed);
+                }
+                drain_records(line);
+                return;
+            }
+
+            // Give the writer a moment to finish its current batch
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+            while (draining_.test_and_set(std::memory_order_acquire)) {
+                if (std::chrono::steady_clock::now() > deadline) {
+                    return;
+                }
+                std::this_thread::yield();
+            }
+            drain_records(line);
+            report_drops(line);
+            draining_.clear(std::memory_order_release);
+        } catch (...) {
+        }
+    }
+
+    void async_log_backend::handle_terminate() {
+        if (auto* backend = crash_backend.exchange(nullptr)) {
+            backend->flush_from_crash();
+        }
+        if (previous_terminate) {
+            previous_terminate();
+        }
+        std::abort();
+    }
+
+    void async_log_backend::handle_signal(int sig) {
+        if (auto* backend = crash_backend.exchange(nullptr)) {
+            backend->flush_from_crash();
+        }
+        for (std::size_t i = 0; i < std::size(crash_signals); ++i) {
+            if (crash_signals[i] == sig) {
+                std::signal(sig, previous_signals[i]);
+            }
+        }
+        std::raise(sig);
+    }
+
+    std::function <void(int, const char*, const char*, int, const std::string&)>
+    create_failsafe_async_backend(bool show_timestamp, bool show_thread_id) {
+        static async_log_backend backend([&] {
+            async_log_backend::config cfg;
+            cfg.show_timestamp = show_timestamp;
+            cfg.show_thread_id = show_thread_id;
+            return cfg;
+        }());
+        static std::once_flag installed;
+        std::call_once(installed, [] { backend.install_crash_handler(); });
+        return backend.get_logger();
+    }
+} // namespace sdlpp
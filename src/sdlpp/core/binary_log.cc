@@ -0,0 +1,557 @@
+#include <sdlpp/core/binary_log.hh>
+#include <sdlpp/core/timer.hh>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+namespace sdlpp {
+    namespace {
+        constexpr char segment_magic[8] = {'S', 'D', 'L', 'P', 'P', 'B', 'L', '1'};
+
+        /**
+         * Record as stored in the ring and in saved segments; followed by
+         * `size` bytes of arguments. Site 0 marks ring padding.
+         */
+        struct record_header {
+            std::uint32_t site;
+            std::uint32_t size;
+            std::uint64_t ticks;
+        };
+
+        static_assert(sizeof(record_header) == 16);
+
+        constexpr std::size_t record_alignment = 8;
+        constexpr std::size_t min_buffer_bytes = 4096;
+
+        constexpr std::size_t aligned(std::size_t bytes) {
+            return (bytes + record_alignment - 1) & ~(record_alignment - 1);
+        }
+
+        /**
+         * Single-producer byte ring. Records never wrap: one that does not
+         * fit before the end is preceded by a padding marker and written at
+         * the start.
+         */
+        struct thread_buffer {
+            thread_buffer(std::size_t capacity, std::uint32_t thread_id)
+                : data(std::make_unique <std::byte[]>(capacity)), size(capacity), mask(capacity - 1),
+                  id(thread_id) {
+            }
+
+            std::unique_ptr <std::byte[]> data;
+            const std::uint64_t size;
+            const std::uint64_t mask;
+            const std::uint32_t id;
+
+            // Producer only
+            std::uint64_t cached_tail = 0;
+            std::uint64_t pending = 0;
+
+            alignas(64) std::atomic <std::uint64_t> head{0};
+            alignas(64) std::atomic <std::uint64_t> tail{0};
+            std::atomic <std::uint64_t> dropped{0};
+            std::atomic <bool> retired{false};  // Owning thread has exited
+        };
+
+        struct registry {
+            std::mutex mutex;
+            std::vector <binary_log_site> sites;  // Index id - 1
+            std::vector <std::unique_ptr <thread_buffer>> buffers;  // Released once retired and drained
+            std::uint32_t next_id = 1;            // Guarded by mutex
+            std::uint64_t released_dropped = 0;   // Guarded by mutex: drops of released buffers
+            std::vector <std::byte> scratch;
+            std::atomic <std::size_t> buffer_bytes{binary_log::default_buffer_bytes};
+            std::atomic <bool> enabled{true};
+        };
+
+        registry& global_registry() {
+            static registry r;
+            return r;
+        }
+
+        thread_local thread_buffer* current_buffer = nullptr;
+        thread_local bool thread_exited = false;
+
+        /**
+         * Retires the thread's ring when the thread exits; the next save()
+         * or clear() releases it once its records have been drained
+         */
+        struct buffer_owner {
+            thread_buffer* buffer = nullptr;
+
+            ~buffer_owner() {
+                if (buffer) {
+                    buffer->retired.store(true, std::memory_order_release);
+                }
+                current_buffer = nullptr;
+                thread_exited = true;
+            }
+        };
+
+        thread_local buffer_owner owner;
+
+        /**
+         * @return The calling thread's ring, or nullptr if it cannot be
+         *         allocated or the thread is exiting
+         */
+        thread_buffer* buffer_for_this_thread() noexcept {
+            if (!current_buffer && !thread_exited) {
+                auto& reg = global_registry();
+                const std::size_t capacity = std::bit_ceil(
+                    std::max(reg.buffer_bytes.load(std::memory_order_relaxed), min_buffer_bytes));
+                try {
+                    std::lock_guard lock(reg.mutex);
+                    reg.buffers.push_back(std::make_unique <thread_buffer>(capacity, reg.next_id++));
+                    current_buffer = reg.buffers.back().get();
+                    owner.buffer = current_buffer;
+                } catch (...) {
+                    return nullptr;
+                }
+            }
+            return current_buffer;
+        }
+
+        // Caller holds reg.mutex
+        void release_retired(registry& reg) {
+            std::erase_if(reg.buffers, [&reg](const std::unique_ptr <thread_buffer>& buffer) {
+                if (!buffer->retired.load(std::memory_order_acquire) ||
+                    buffer->tail.load(std::memory_order_relaxed) != buffer->head.load(std::memory_order_acquire)) {
+                    return false;
+                }
+                reg.released_dropped += buffer->dropped.load(std::memory_order_relaxed);
+                return true;
+            });
+        }
+
+        template<typename T>
+        void put(std::ostream& out, const T& value) {
+            out.write(reinterpret_cast <const char*>(&value), sizeof(T));
+        }
+
+        void put_string(std::ostream& out, std::string_view text) {
+            put(out, static_cast <std::uint32_t>(text.size()));
+            out.write(text.data(), static_cast <std::streamsize>(text.size()));
+        }
+
+        /**
+         * Copy the records between tail and head, without padding, to `out`
+         */
+        void drain(thread_buffer& buffer, std::vector <std::byte>& out) {
+            const auto head_index = buffer.head.load(std::memory_order_acquire);
+            auto position = buffer.tail.load(std::memory_order_relaxed);
+            while (position != head_index) {
+                const auto offset = position & buffer.mask;
+                record_header header;
+                std::memcpy(&header.site, buffer.data.get() + offset, sizeof(header.site));
+                if (header.site == 0) {
+                    position += buffer.size - offset;
+                    continue;
+                }
+                std::memcpy(&header, buffer.data.get() + offset, sizeof(header));
+                const auto* first = buffer.data.get() + offset;
+                out.insert(out.end(), first, first + sizeof(header) + header.size);
+                position += aligned(sizeof(header) + header.size);
+            }
+            buffer.tail.store(head_index, std::memory_order_release);
+        }
+
+        /**
+         * Bounds-checked reads from a segment
+         */
+        class input {
+            public:
+                explicit input(std::istream& in)
+                    : in_(in) {
+                }
+
+                template<typename T>
+                bool get(T& value) {
+                    return static_cast <bool>(in_.read(reinterpret_cast <char*>(&value), sizeof(T)));
+                }
+
+                bool get_string(std::string& text) {
+                    std::uint32_t length = 0;
+                    if (!get(length) || length > max_field_bytes) {
+                        return false;
+                    }
+                    text.resize(length);
+                    return length == 0 || static_cast <bool>(in_.read(text.data(), length));
+                }
+
+                bool get_bytes(std::vector <std::byte>& out, std::uint64_t count) {
+                    if (count > max_block_bytes) {
+                        return false;
+                    }
+                    const auto start = out.size();
+                    out.resize(start + count);
+                    return count == 0 ||
+                           static_cast <bool>(in_.read(reinterpret_cast <char*>(out.data() + start),
+                                                       static_cast <std::streamsize>(count)));
+                }
+
+            private:
+                static constexpr std::uint32_t max_field_bytes = 1u << 20;
+                static constexpr std::uint64_t max_block_bytes = std::uint64_t{1} << 30;
+
+                std::istream& in_;
+        };
+
+        template<typename T>
+        T load(const std::byte* at) {
+            T value;
+            std::memcpy(&value, at, sizeof(T));
+            return value;
+        }
+
+        template<typename T>
+        void append_number(std::string& out, T value) {
+            char digits[32];
+            const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+            out.append(digits, static_cast <std::size_t>(result.ptr - digits));
+        }
+
+        /**
+         * Append one encoded argument as text; returns the bytes consumed,
+         * or 0 if the payload is too short
+         */
+        std::size_t append_argument(std::string& out, binary_log_arg arg, const std::byte* at,
+                                    std::size_t available) {
+            const std::size_t size = detail::binary_log_arg_size(arg);
+            if (arg == binary_log_arg::string) {
+                if (available < sizeof(std::uint32_t)) {
+                    return 0;
+                }
+                const auto length = load <std::uint32_t>(at);
+                if (length > available - sizeof(std::uint32_t)) {
+                    return 0;
+                }
+                out.append(reinterpret_cast <const char*>(at + sizeof(std::uint32_t)), length);
+                return sizeof(std::uint32_t) + length;
+            }
+            if (available < size) {
+                return 0;
+            }
+            switch (arg) {
+                case binary_log_arg::boolean: out.append(load <std::uint8_t>(at) ? "true" : "false"); break;
+                case binary_log_arg::character: out.push_back(load <char>(at)); break;
+                case binary_log_arg::int8: append_number(out, load <std::int8_t>(at)); break;
+                case binary_log_arg::int16: append_number(out, load <std::int16_t>(at)); break;
+                case binary_log_arg::int32: append_number(out, load <std::int32_t>(at)); break;
+                case binary_log_arg::int64: append_number(out, load <std::int64_t>(at)); break;
+                case binary_log_arg::uint8: append_number(out, load <std::uint8_t>(at)); break;
+                case binary_log_arg::uint16: append_number(out, load <std::uint16_t>(at)); break;
+                case binary_log_arg::uint32: append_number(out, load <std::uint32_t>(at)); break;
+                case binary_log_arg::uint64: append_number(out, load <std::uint64_t>(at)); break;
+                case binary_log_arg::float32: append_number(out, load <float>(at)); break;
+                case binary_log_arg::float64: append_number(out, load <double>(at)); break;
+                case binary_log_arg::pointer: {
+                    char digits[32];
+                    const auto result = std::to_chars(digits, digits + sizeof(digits),
+                                                      load <std::uint64_t>(at), 16);
+                    out.append("0x");
+                    out.append(digits, static_cast <std::size_t>(result.ptr - digits));
+                    break;
+                }
+                case binary_log_arg::string: break;
+            }
+            return size;
+        }
+    } // anonymous namespace
+
+    std::uint32_t binary_log::register_site(const binary_log_site& site) noexcept {
+        auto& reg = global_registry();
+        try {
+            std::lock_guard lock(reg.mutex);
+            reg.sites.push_back(site);
+            const auto id = static_cast <std::uint32_t>(reg.sites.size());
+            reg.sites.back().id = id;
+            return id;
+        } catch (...) {
+            return 0;
+        }
+    }
+
+    std::byte* binary_log::begin_record(std::uint32_t site, std::size_t payload) noexcept {
+        thread_buffer* buffer = buffer_for_this_thread();
+        if (!buffer) {
+            return nullptr;
+        }
+
+        const std::uint64_t need = aligned(sizeof(record_header) + payload);
+        const auto head_index = buffer->head.load(std::memory_order_relaxed);
+        const auto offset = head_index & buffer->mask;
+        const std::uint64_t padding = need > buffer->size - offset ? buffer->size - offset : 0;
+        const auto end = head_index + padding + need;
+        if (end - buffer->cached_tail > buffer->size) {
+            buffer->cached_tail = buffer->tail.load(std::memory_order_acquire);
+            if (end - buffer->cached_tail > buffer->size) {
+                buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+        }
+
+        if (padding > 0) {
+            constexpr std::uint32_t padding_marker = 0;
+            std::memcpy(buffer->data.get() + offset, &padding_marker, sizeof(padding_marker));
+        }
+        const record_header header{
+            site, static_cast <std::uint32_t>(payload), timer::high_resolution_clock::now_ticks()
+        };
+        std::byte* out = buffer->data.get() + ((head_index + padding) & buffer->mask);
+        std::memcpy(out, &header, sizeof(header));
+        buffer->pending = end;
+        return out + sizeof(header);
+    }
+
+    void binary_log::commit_record() noexcept {
+        current_buffer->head.store(current_buffer->pending, std::memory_order_release);
+    }
+
+    void binary_log::set_enabled(bool enabled) noexcept {
+        global_registry().enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool binary_log::is_enabled() noexcept {
+        return global_registry().enabled.load(std::memory_order_relaxed);
+    }
+
+    void binary_log::set_buffer_size(std::size_t bytes) noexcept {
+        global_registry().buffer_bytes.store(bytes, std::memory_order_relaxed);
+    }
+
+    void binary_log::save(std::ostream& out) {
+        auto& reg = global_registry();
+        std::lock_guard lock(reg.mutex);
+
+        out.write(segment_magic, sizeof(segment_magic));
+        put(out, static_cast <std::uint64_t>(timer::performance_counter::get_frequency()));
+
+        put(out, static_cast <std::uint32_t>(reg.sites.size()));
+        for (const auto& site : reg.sites) {
+            put(out, site.id);
+            put(out, static_cast <std::int32_t>(site.category));
+            put(out, static_cast <std::int32_t>(site.priority));
+            put(out, static_cast <std::uint32_t>(site.location.line()));
+            put_string(out, site.location.file_name());
+            put_string(out, site.location.function_name());
+            put_string(out, site.format);
+            put(out, site.arg_count);
+            out.write(reinterpret_cast <const char*>(site.args), site.arg_count);
+        }
+
+        put(out, static_cast <std::uint32_t>(reg.buffers.size()));
+        for (const auto& buffer : reg.buffers) {
+            reg.scratch.clear();
+            drain(*buffer, reg.scratch);
+            put(out, buffer->id);
+            put(out, static_cast <std::uint64_t>(reg.scratch.size()));
+            out.write(reinterpret_cast <const char*>(reg.scratch.data()),
+                      static_cast <std::streamsize>(reg.scratch.size()));
+        }
+        release_retired(reg);
+    }
+
+    void binary_log::write_text(std::ostream& out) {
+        std::stringstream segment;
+        save(segment);
+        if (auto log = binary_log_reader::read(segment)) {
+            log->write_text(out);
+        }
+    }
+
+    void binary_log::clear() {
+        auto& reg = global_registry();
+        std::lock_guard lock(reg.mutex);
+        for (auto& buffer : reg.buffers) {
+            buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+        }
+        release_retired(reg);
+    }
+
+    std::uint64_t binary_log::dropped_records() {
+        auto& reg = global_registry();
+        std::lock_guard lock(reg.mutex);
+        std::uint64_t total = reg.released_dropped;
+        for (const auto& buffer : reg.buffers) {
+            total += buffer->dropped.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    expected <binary_log_reader, std::string> binary_log_reader::read(std::istream& in) {
+        binary_log_reader log;
+        input source(in);
+
+        while (in.peek() != std::char_traits <char>::eof()) {
+            char magic[sizeof(segment_magic)];
+            if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), segment_magic)) {
+                return make_unexpectedf("Not an sdlpp binary log segment");
+            }
+            std::uint64_t frequency = 0;
+            std::uint32_t site_count = 0;
+            if (!source.get(frequency) || !source.get(site_count)) {
+                return make_unexpectedf("Truncated binary log header");
+            }
+            const timer::tick_converter converter(frequency);
+
+            for (std::uint32_t i = 0; i < site_count; ++i) {
+                site s;
+                std::int32_t category = 0;
+                std::int32_t priority = 0;
+                std::uint32_t arg_count = 0;
+                if (!source.get(s.id) || !source.get(category) || !source.get(priority) ||
+                    !source.get(s.line) || !source.get_string(s.file) || !source.get_string(s.function) ||
+                    !source.get_string(s.format) || !source.get(arg_count) || arg_count > 256 || s.id == 0) {
+                    return make_unexpectedf("Truncated or invalid binary log site table");
+                }
+                std::vector <std::byte> tags;
+                if (!source.get_bytes(tags, arg_count)) {
+                    return make_unexpectedf("Truncated binary log site table");
+                }
+                for (const auto tag : tags) {
+                    if (static_cast <std::uint8_t>(tag) > static_cast <std::uint8_t>(binary_log_arg::string)) {
+                        return make_unexpectedf("Unknown argument type in binary log site", s.id);
+                    }
+                    s.args.push_back(static_cast <binary_log_arg>(tag));
+                }
+                s.category = category;
+                s.priority = static_cast <log_priority>(priority);
+                if (log.sites_.size() < s.id) {
+                    log.sites_.resize(s.id);
+                }
+                log.sites_[s.id - 1] = std::move(s);
+            }
+
+            std::uint32_t thread_count = 0;
+            if (!source.get(thread_count)) {
+                return make_unexpectedf("Truncated binary log segment");
+            }
+            for (std::uint32_t t = 0; t < thread_count; ++t) {
+                std::uint32_t thread = 0;
+                std::uint64_t bytes = 0;
+                const auto start = log.payload_.size();
+                if (!source.get(thread) || !source.get(bytes) || !source.get_bytes(log.payload_, bytes)) {
+                    return make_unexpectedf("Truncated binary log records");
+                }
+                auto position = start;
+                const auto end = log.payload_.size();
+                while (position < end) {
+                    if (end - position < sizeof(record_header)) {
+                        return make_unexpectedf("Truncated binary log record");
+                    }
+                    const auto header = load <record_header>(log.payload_.data() + position);
+                    position += sizeof(record_header);
+                    if (header.size > end - position) {
+                        return make_unexpectedf("Truncated binary log record");
+                    }
+                    log.records_.push_back({converter.to_nanoseconds(header.ticks), thread, header.site,
+                                            position, header.size});
+                    position += header.size;
+                }
+            }
+        }
+
+        std::stable_sort(log.records_.begin(), log.records_.end(), [](const record& a, const record& b) {
+            return a.timestamp_ns < b.timestamp_ns;
+        });
+        return log;
+    }
+
+    const binary_log_reader::site* binary_log_reader::find_site(std::uint32_t id) const noexcept {
+        if (id == 0 || id > sites_.size() || sites_[id - 1].id != id) {
+            return nullptr;
+        }
+        return &sites_[id - 1];
+    }
+
+    std::string binary_log_reader::format(const record& r) const {
+        std::string text;
+        append_message(text, r);
+        return text;
+    }
+
+    void binary_log_reader::append_message(std::string& text, const record& r) const {
+        const site* s = find_site(r.site);
+        if (!s) {
+            text.append("<unknown site ");
+            append_number(text, r.site);
+            text.push_back('>');
+            return;
+        }
+
+        const std::byte* at = payload_.data() + r.offset;
+        std::size_t available = r.size;
+        std::size_t next_arg = 0;
+
+        const auto append_next = [&]() {
+            if (next_arg >= s->args.size()) {
+                return false;
+            }
+            const auto used = append_argument(text, s->args[next_arg++], at, available);
+            if (used == 0) {
+                text.append("<truncated>");
+                next_arg = s->args.size();
+                return true;
+            }
+            at += used;
+            available -= used;
+            return true;
+        };
+
+        const std::string_view fmt = s->format;
+        for (std::size_t i = 0; i < fmt.size(); ++i) {
+            const char c = fmt[i];
+            if (c == '{' && i + 1 < fmt.size() && fmt[i + 1] == '{') {
+                text.push_back('{');
+                ++i;
+            } else if (c == '}' && i + 1 < fmt.size() && fmt[i + 1] == '}') {
+                text.push_back('}');
+                ++i;
+            } else if (c == '{' && i + 1 < fmt.size() && fmt[i + 1] == '}') {
+                if (!append_next()) {
+                    text.append("{}");
+                }
+                ++i;
+            } else {
+                text.push_back(c);
+            }
+        }
+        // Arguments without a placeholder are appended like build_message does
+        while (next_arg < s->args.size()) {
+            text.push_back(' ');
+            append_next();
+        }
+    }
+
+    void binary_log_reader::write_text(std::ostream& out) const {
+        std::string line;
+        for (const auto& r : records_) {
+            line.clear();
+            line.push_back('[');
+            append_number(line, r.timestamp_ns / 1'000'000'000);
+            char fraction[8];
+            const auto micros = static_cast <unsigned>(r.timestamp_ns % 1'000'000'000 / 1000);
+            std::snprintf(fraction, sizeof(fraction), ".%06u", micros);
+            line.append(fraction);
+            line.append("] [T");
+            append_number(line, r.thread);
+            line.append("] ");
+            if (const site* s = find_site(r.site)) {
+                line.push_back('[');
+                line.append(s->file);
+                line.push_back(':');
+                append_number(line, s->line);
+                line.append("] ");
+            }
+            append_message(line, r);
+            line.push_back('\n');
+            out.write(line.data(), static_cast <std::streamsize>(line.size()));
+        }
+    }
+} // namespace sdlpp
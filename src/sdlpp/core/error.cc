@@ -0,0 +1,144 @@
+#include <sdlpp/core/error.hh>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+
+namespace sdlpp {
+    namespace {
+        constexpr std::size_t ring_slots = 256;
+        constexpr std::size_t slot_words = 16;
+        constexpr std::size_t slot_bytes = slot_words * sizeof(std::uint64_t);
+        constexpr std::size_t max_text = slot_bytes - 1;
+
+        /**
+         * One captured text, guarded by a sequence lock: the sequence is
+         * 2 * ticket + 1 while the text is written and 2 * ticket + 2 once
+         * it is complete. Words are atomics so a torn read is merely
+         * detected, never undefined.
+         */
+        struct text_slot {
+            std::atomic <std::uint64_t> sequence{0};
+            std::array <std::atomic <std::uint64_t>, slot_words> words{};
+        };
+
+        std::atomic <std::uint32_t> next_ticket{1};
+        std::array <text_slot, ring_slots> text_ring{};
+
+        constexpr std::uint64_t complete_sequence(std::uint32_t ticket) noexcept {
+            return 2 * static_cast <std::uint64_t>(ticket) + 2;
+        }
+
+        const char* describe(errc code) noexcept {
+            switch (code) {
+                case errc::sdl_error:
+                    return "SDL error";
+                case errc::invalid_handle:
+                    return "Invalid handle";
+                case errc::invalid_argument:
+                    return "Invalid argument";
+                case errc::out_of_memory:
+                    return "Out of memory";
+                case errc::unsupported:
+                    return "Operation not supported";
+                case errc::not_found:
+                    return "Not found";
+                case errc::io_error:
+                    return "I/O error";
+                case errc::other:
+                    break;
+            }
+            return "Unknown error";
+        }
+    }
+
+    namespace detail {
+        std::uint32_t capture_error_text(std::string_view text) noexcept {
+            std::uint32_t ticket = next_ticket.fetch_add(1, std::memory_order_relaxed);
+            if (ticket == 0) {
+                ticket = next_ticket.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            auto& slot = text_ring[ticket % ring_slots];
+            std::uint64_t current = slot.sequence.load(std::memory_order_relaxed);
+            // Another thread is mid-write on this slot: leave it alone, the
+            // reader will report the text as unavailable
+            if ((current & 1) != 0 ||
+                !slot.sequence.compare_exchange_strong(current, complete_sequence(ticket) - 1,
+                                                       std::memory_order_relaxed)) {
+                return ticket;
+            }
+            std::atomic_thread_fence(std::memory_order_release);
+
+            std::array <char, slot_bytes> bytes{};
+            const std::size_t length = std::min(text.size(), max_text);
+            if (length > 0) {
+                std::memcpy(bytes.data(), text.data(), length);
+            }
+            const std::size_t used_words = length / sizeof(std::uint64_t) + 1;
+            for (std::size_t i = 0; i < used_words; ++i) {
+                std::uint64_t word;
+                std::memcpy(&word, bytes.data() + i * sizeof(word), sizeof(word));
+                slot.words[i].store(word, std::memory_order_relaxed);
+            }
+
+            slot.sequence.store(complete_sequence(ticket), std::memory_order_release);
+            return ticket;
+        }
+
+        bool read_error_text(std::uint32_t ticket, std::string& out) {
+            if (ticket == 0) {
+                return false;
+            }
+            const auto& slot = text_ring[ticket % ring_slots];
+            const std::uint64_t sequence = complete_sequence(ticket);
+            if (slot.sequence.load(std::memory_order_acquire) != sequence) {
+                return false;
+            }
+
+            std::array <char, slot_bytes> bytes;
+            for (std::size_t i = 0; i < slot_words; ++i) {
+                const std::uint64_t word = slot.words[i].load(std::memory_order_relaxed);
+                std::memcpy(bytes.data() + i * sizeof(word), &word, sizeof(word));
+                if (std::memchr(&word, 0, sizeof(word)) != nullptr) {
+                    break;
+                }
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+                return false;
+            }
+            bytes[max_text] = '\0';
+            out.assign(bytes.data(), std::strlen(bytes.data()));
+            return true;
+        }
+    }
+
+    std::string error::message() const {
+        std::string text;
+        const bool have_text = detail::read_error_text(text_, text);
+        if (have_text && (!text.empty() || code_ == errc::other)) {
+            if (!context_) {
+                return text;
+            }
+            std::string out{context_};
+            out += ": ";
+            out += text;
+            return out;
+        }
+
+        std::string out{context_ ? context_ : describe(code_)};
+        if (text_ != 0 && !have_text) {
+            out += " (error text no longer available)";
+        }
+        return out;
+    }
+
+    std::ostream& operator<<(std::ostream& os, const error& e) {
+        return os << e.message();
+    }
+}
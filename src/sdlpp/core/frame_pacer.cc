@@ -0,0 +1,139 @@
+#include <sdlpp/core/frame_pacer.hh>
+
+#include <algorithm>
+#include <numeric>
+#include <thread>
+
+namespace sdlpp {
+    namespace {
+        constexpr Uint64 initial_margin_ns = 2'000'000;  // Typical timer slack before calibration
+        constexpr Uint64 min_margin_ns = 100'000;
+        constexpr Uint64 max_margin_ns = 4'000'000;
+        constexpr double margin_decay = 0.98;           // Per-frame decay of the oversleep estimate
+        constexpr double margin_headroom = 1.25;
+
+        Uint64 period_from_fps(double target_fps) noexcept {
+            return target_fps > 0.0 ? static_cast <Uint64>(1'000'000'000.0 / target_fps) : 0;
+        }
+
+        Uint64 period_from_duration(std::chrono::nanoseconds period) noexcept {
+            return period.count() > 0 ? static_cast <Uint64>(period.count()) : 0;
+        }
+
+        std::chrono::nanoseconds to_duration(Uint64 ns) noexcept {
+            return std::chrono::nanoseconds(static_cast <std::int64_t>(ns));
+        }
+    } // anonymous namespace
+
+    frame_pacer::frame_pacer(double target_fps, std::size_t window)
+        : frame_pacer(to_duration(period_from_fps(target_fps)), window) {
+    }
+
+    frame_pacer::frame_pacer(std::chrono::nanoseconds period, std::size_t window)
+        : period_ns_(period_from_duration(period)),
+          margin_ns_(initial_margin_ns),
+          oversleep_estimate_ns_(static_cast <double>(initial_margin_ns) / margin_headroom),
+          samples_(std::max <std::size_t>(window, 1), 0) {
+    }
+
+    void frame_pacer::set_target_fps(double target_fps) noexcept {
+        period_ns_ = period_from_fps(target_fps);
+        started_ = false;
+    }
+
+    void frame_pacer::set_period(std::chrono::nanoseconds period) noexcept {
+        period_ns_ = period_from_duration(period);
+        started_ = false;
+    }
+
+    void frame_pacer::sleep_until(Uint64 deadline_ns) noexcept {
+        Uint64 now = SDL_GetTicksNS();
+
+        // Coarse stage: let the OS sleep, ending a margin before the deadline
+        if (deadline_ns > now + margin_ns_) {
+            const Uint64 wake_target = deadline_ns - margin_ns_;
+            SDL_DelayNS(wake_target - now);
+            now = SDL_GetTicksNS();
+
+            // Calibrate against how late the sleep returned
+            const double oversleep = now > wake_target ? static_cast <double>(now - wake_target) : 0.0;
+            oversleep_estimate_ns_ = std::max(oversleep, oversleep_estimate_ns_ * margin_decay);
+            margin_ns_ = std::clamp(static_cast <Uint64>(oversleep_estimate_ns_ * margin_headroom),
+                                    min_margin_ns, max_margin_ns);
+        }
+
+        // Fine stage: spin the remainder
+        while (now < deadline_ns) {
+            std::this_thread::yield();
+            now = SDL_GetTicksNS();
+        }
+    }
+
+    std::chrono::nanoseconds frame_pacer::wait() {
+        Uint64 now = SDL_GetTicksNS();
+
+        if (period_ns_ > 0) {
+            if (!started_) {
+                deadline_ns_ = now + period_ns_;
+                started_ = true;
+            } else if (now > deadline_ns_) {
+                // Late: start the next period from now rather than bursting
+                ++missed_;
+                deadline_ns_ = now;
+            }
+
+            sleep_until(deadline_ns_);
+            now = SDL_GetTicksNS();
+            deadline_ns_ += period_ns_;
+        }
+
+        const Uint64 frame_ns = last_return_ns_ != 0 && now > last_return_ns_ ? now - last_return_ns_ : 0;
+        if (last_return_ns_ != 0) {
+            record(frame_ns);
+        }
+        last_return_ns_ = now;
+        return to_duration(frame_ns);
+    }
+
+    void frame_pacer::record(Uint64 frame_ns) noexcept {
+        samples_[next_sample_] = frame_ns;
+        next_sample_ = (next_sample_ + 1) % samples_.size();
+        sample_count_ = std::min(sample_count_ + 1, samples_.size());
+        ++frames_;
+    }
+
+    frame_pacing_stats frame_pacer::statistics() const {
+        frame_pacing_stats stats;
+        stats.frames = frames_;
+        stats.missed_deadlines = missed_;
+        stats.samples = sample_count_;
+        if (sample_count_ == 0) {
+            return stats;
+        }
+
+        std::vector <Uint64> sorted(samples_.begin(), samples_.begin() + static_cast <std::ptrdiff_t>(sample_count_));
+        std::sort(sorted.begin(), sorted.end());
+
+        // Nearest-rank percentile
+        const auto rank = [&sorted](double p) {
+            const auto index = static_cast <std::size_t>(p * static_cast <double>(sorted.size() - 1) + 0.5);
+            return to_duration(sorted[std::min(index, sorted.size() - 1)]);
+        };
+
+        stats.p50 = rank(0.50);
+        stats.p95 = rank(0.95);
+        stats.p99 = rank(0.99);
+        stats.min = to_duration(sorted.front());
+        stats.max = to_duration(sorted.back());
+        const Uint64 total = std::accumulate(sorted.begin(), sorted.end(), Uint64{0});
+        stats.mean = to_duration(total / sorted.size());
+        return stats;
+    }
+
+    void frame_pacer::reset_statistics() noexcept {
+        next_sample_ = 0;
+        sample_count_ = 0;
+        frames_ = 0;
+        missed_ = 0;
+    }
+} // namespace sdlpp
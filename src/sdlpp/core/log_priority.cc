@@ -0,0 +1,43 @@
+#include <sdlpp/core/log.hh>
+
+#include <atomic>
+
+namespace sdlpp {
+    namespace {
+        constexpr int cached_log_categories = 64;
+
+        /**
+         * SDL_GetLogPriority() per category. 0 (SDL_LOG_PRIORITY_INVALID)
+         * means "not cached yet"; categories outside the cache are looked up
+         * in SDL every time.
+         */
+        std::atomic <int> log_priority_cache[cached_log_categories] = {};
+    } // anonymous namespace
+
+    namespace detail {
+        int effective_log_priority(int category) noexcept {
+            if (category < 0 || category >= cached_log_categories) {
+                return static_cast <int>(SDL_GetLogPriority(category));
+            }
+            auto& cached = log_priority_cache[category];
+            int priority = cached.load(std::memory_order_relaxed);
+            if (priority == SDL_LOG_PRIORITY_INVALID) {
+                priority = static_cast <int>(SDL_GetLogPriority(category));
+                cached.store(priority, std::memory_order_relaxed);
+            }
+            return priority;
+        }
+
+        void store_log_priority(int category, int priority) noexcept {
+            if (category >= 0 && category < cached_log_categories) {
+                log_priority_cache[category].store(priority, std::memory_order_relaxed);
+            }
+        }
+
+        void store_log_priorities(int priority) noexcept {
+            for (auto& cached : log_priority_cache) {
+                cached.store(priority, std::memory_order_relaxed);
+            }
+        }
+    } // namespace detail
+} // namespace sdlpp
@@ -0,0 +1,180 @@
+#include <sdlpp/core/phase_profiler.hh>
+#include <sdlpp/detail/json.hh>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace sdlpp {
+    namespace {
+        constexpr int report_name_width = 40;
+
+        double to_ms(std::chrono::nanoseconds ns) {
+            return std::chrono::duration <double, std::milli>(ns).count();
+        }
+
+        double to_us(std::chrono::nanoseconds ns) {
+            return std::chrono::duration <double, std::micro>(ns).count();
+        }
+    } // anonymous namespace
+
+    phase_profiler::phase_profiler(std::string name)
+        : name_(std::move(name)) {
+    }
+
+    phase_profiler::scope phase_profiler::begin(std::string_view name) {
+        const std::size_t parent = open_.empty() ? no_parent : open_.back();
+        spans_.push_back({std::string(name), parent, origin_.elapsed()});
+        open_.push_back(spans_.size() - 1);
+        return scope(this, index_base_ + spans_.size() - 1);
+    }
+
+    void phase_profiler::end_phase(std::size_t index, std::chrono::nanoseconds duration) noexcept {
+        if (index < index_base_ || index - index_base_ >= spans_.size()) {
+            return;  // Opened before clear()
+        }
+        const std::size_t local = index - index_base_;
+        spans_[local].duration = duration;
+
+        // Normally the innermost phase; tolerate out-of-order ends
+        const auto it = std::find(open_.rbegin(), open_.rend(), local);
+        if (it != open_.rend()) {
+            open_.erase(std::next(it).base());
+        }
+    }
+
+    std::vector <phase_stats> phase_profiler::phases() const {
+        struct node {
+            phase_stats stats;
+            std::chrono::nanoseconds child_total{0};
+            std::vector <std::size_t> children;
+        };
+
+        std::vector <node> nodes;
+        std::vector <std::size_t> roots;
+        std::vector <std::size_t> node_of(spans_.size(), no_parent);
+
+        // Parents always precede their children in spans_
+        for (std::size_t i = 0; i < spans_.size(); ++i) {
+            const auto& s = spans_[i];
+            if (s.duration.count() < 0) {
+                continue;
+            }
+            if (s.parent != no_parent && node_of[s.parent] == no_parent) {
+                continue;  // Parent still open
+            }
+
+            const std::size_t parent_node = s.parent == no_parent ? no_parent : node_of[s.parent];
+            const auto siblings = [&]() -> std::vector <std::size_t>& {
+                return parent_node == no_parent ? roots : nodes[parent_node].children;
+            };
+
+            std::size_t target = no_parent;
+            for (const std::size_t candidate : siblings()) {
+                if (nodes[candidate].stats.name == s.name) {
+                    target = candidate;
+                    break;
+                }
+            }
+            if (target == no_parent) {
+                target = nodes.size();
+                node n;
+                n.stats.name = s.name;
+                n.stats.depth = parent_node == no_parent ? 0 : nodes[parent_node].stats.depth + 1;
+                n.stats.first_start = s.start;
+                nodes.push_back(std::move(n));
+                siblings().push_back(target);  // Looked up again: push_back may have moved nodes
+            }
+
+            auto& stats = nodes[target].stats;
+            ++stats.count;
+            stats.total += s.duration;
+            if (parent_node != no_parent) {
+                nodes[parent_node].child_total += s.duration;
+            }
+            node_of[i] = target;
+        }
+
+        std::vector <phase_stats> tree;
+        tree.reserve(nodes.size());
+        std::vector <std::size_t> stack(roots.rbegin(), roots.rend());
+        while (!stack.empty()) {
+            const std::size_t current = stack.back();
+            stack.pop_back();
+
+            phase_stats stats = nodes[current].stats;
+            stats.self = std::max(stats.total - nodes[current].child_total, std::chrono::nanoseconds(0));
+            tree.push_back(std::move(stats));
+
+            const auto& children = nodes[current].children;
+            stack.insert(stack.end(), children.rbegin(), children.rend());
+        }
+        return tree;
+    }
+
+    std::chrono::nanoseconds phase_profiler::total() const {
+        std::chrono::nanoseconds sum{0};
+        for (const auto& s : spans_) {
+            if (s.parent == no_parent && s.duration.count() >= 0) {
+                sum += s.duration;
+            }
+        }
+        return sum;
+    }
+
+    std::string phase_profiler::report() const {
+        const auto all = total();
+        const double all_ms = to_ms(all);
+
+        std::ostringstream oss;
+        oss << std::fixed << std::left << std::setw(report_name_width + 2) << name_
+            << std::right << "total " << std::setw(9) << std::setprecision(3) << all_ms << " ms\n";
+
+        for (const auto& p : phases()) {
+            const auto indent = 2 * (p.depth + 1);
+            const auto width = static_cast <int>(indent) < report_name_width
+                                   ? report_name_width - static_cast <int>(indent) : 0;
+            const double ms = to_ms(p.total);
+
+            oss << std::string(indent, ' ') << std::left << std::setw(width) << p.name << std::right
+                << std::setw(10) << std::setprecision(3) << ms << " ms "
+                << std::setw(6) << std::setprecision(1) << (all_ms > 0.0 ? 100.0 * ms / all_ms : 0.0) << '%';
+            if (p.count > 1) {
+                oss << "  x" << p.count;
+            }
+            oss << '\n';
+        }
+        return oss.str();
+    }
+
+    std::string phase_profiler::chrome_trace() const {
+        std::ostringstream oss;
+        oss << std::fixed << std::setprecision(3);
+        oss << "{\"traceEvents\":[";
+
+        bool first = true;
+        for (const auto& s : spans_) {
+            if (s.duration.count() < 0) {
+                continue;
+            }
+            oss << (first ? "\n" : ",\n") << "{\"name\":";
+            detail::write_json_string(oss, s.name);
+            oss << ",\"cat\":";
+            detail::write_json_string(oss, name_);
+            oss << ",\"ph\":\"X\",\"ts\":" << to_us(s.start)
+                << ",\"dur\":" << to_us(s.duration)
+                << ",\"pid\":1,\"tid\":1}";
+            first = false;
+        }
+
+        oss << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return oss.str();
+    }
+
+    void phase_profiler::clear() {
+        index_base_ += spans_.size();
+        spans_.clear();
+        open_.clear();
+        origin_.reset();
+    }
+} // namespace sdlpp
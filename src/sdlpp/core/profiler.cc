@@ -0,0 +1,253 @@
+#include <sdlpp/core/profiler.hh>
+#include <sdlpp/detail/json.hh>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace sdlpp {
+    namespace {
+        enum class event_kind : std::uint8_t {
+            zone,
+            frame
+        };
+
+        struct profile_event {
+            const char* name;
+            std::uint64_t start_ns;
+            std::uint64_t end_ns;  // Frame number for frame marks
+            event_kind kind;
+        };
+
+        /**
+         * Single-producer ring: the owning thread appends, exporters drain
+         * under the registry mutex
+         */
+        struct thread_buffer {
+            explicit thread_buffer(std::size_t capacity, std::uint32_t thread_id)
+                : events(capacity), mask(capacity - 1), id(thread_id) {
+            }
+
+            void push(const profile_event& e) noexcept {
+                const auto head_index = head.load(std::memory_order_relaxed);
+                if (head_index - tail.load(std::memory_order_acquire) > mask) {
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                events[head_index & mask] = e;
+                head.store(head_index + 1, std::memory_order_release);
+            }
+
+            std::vector <profile_event> events;
+            const std::uint64_t mask;
+            const std::uint32_t id;
+            std::string name;  // Guarded by registry::mutex
+
+            alignas(64) std::atomic <std::uint64_t> head{0};
+            alignas(64) std::atomic <std::uint64_t> tail{0};
+            std::atomic <std::uint64_t> dropped{0};
+            std::atomic <bool> retired{false};  // Owning thread has exited
+        };
+
+        struct registry {
+            std::mutex mutex;
+            std::vector <std::unique_ptr <thread_buffer>> buffers;  // Released once retired and drained
+            std::uint32_t next_id = 1;            // Guarded by mutex
+            std::uint64_t released_dropped = 0;   // Guarded by mutex: drops of released buffers
+            std::atomic <std::size_t> capacity{profiler::default_buffer_capacity};
+            std::atomic <bool> enabled{true};
+            std::atomic <std::uint64_t> frames{0};
+        };
+
+        registry& global_registry() {
+            static registry r;
+            return r;
+        }
+
+        thread_local thread_buffer* current_buffer = nullptr;
+        thread_local bool thread_exited = false;
+
+        /**
+         * Retires the thread's buffer when the thread exits; the next export
+         * releases it once its events have been drained
+         */
+        struct buffer_owner {
+            thread_buffer* buffer = nullptr;
+
+            ~buffer_owner() {
+                if (buffer) {
+                    buffer->retired.store(true, std::memory_order_release);
+                }
+                current_buffer = nullptr;
+                thread_exited = true;
+            }
+        };
+
+        thread_local buffer_owner owner;
+
+        /**
+         * @return The calling thread's buffer, or nullptr while the thread is
+         *         exiting (its buffer may already be gone)
+         */
+        thread_buffer* buffer_for_this_thread() {
+            if (!current_buffer && !thread_exited) {
+                auto& reg = global_registry();
+                const std::size_t capacity = std::bit_ceil(
+                    std::max <std::size_t>(reg.capacity.load(std::memory_order_relaxed), 2));
+
+                std::lock_guard lock(reg.mutex);
+                reg.buffers.push_back(std::make_unique <thread_buffer>(capacity, reg.next_id++));
+                current_buffer = reg.buffers.back().get();
+                owner.buffer = current_buffer;
+            }
+            return current_buffer;
+        }
+
+        // Caller holds reg.mutex
+        void release_retired(registry& reg) {
+            std::erase_if(reg.buffers, [&reg](const std::unique_ptr <thread_buffer>& buffer) {
+                if (!buffer->retired.load(std::memory_order_acquire) ||
+                    buffer->tail.load(std::memory_order_relaxed) != buffer->head.load(std::memory_order_acquire)) {
+                    return false;
+                }
+                reg.released_dropped += buffer->dropped.load(std::memory_order_relaxed);
+                return true;
+            });
+        }
+
+        double to_us(std::uint64_t ns) {
+            return static_cast <double>(ns) / 1000.0;
+        }
+    } // anonymous namespace
+
+    void profiler::set_enabled(bool enabled) noexcept {
+        global_registry().enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool profiler::is_enabled() noexcept {
+        return global_registry().enabled.load(std::memory_order_relaxed);
+    }
+
+    void profiler::record_zone(const char* name, std::uint64_t start_ns, std::uint64_t end_ns) noexcept {
+        if (!is_enabled()) {
+            return;
+        }
+        try {
+            if (auto* buffer = buffer_for_this_thread()) {
+                buffer->push({name, start_ns, end_ns, event_kind::zone});
+            }
+        } catch (...) {
+            // Could not allocate this thread's buffer: skip the zone
+        }
+    }
+
+    void profiler::frame_mark() noexcept {
+        const auto frame = global_registry().frames.fetch_add(1, std::memory_order_relaxed);
+        if (!is_enabled()) {
+            return;
+        }
+        try {
+            const auto now_ns = now();
+            if (auto* buffer = buffer_for_this_thread()) {
+                buffer->push({nullptr, now_ns, frame, event_kind::frame});
+            }
+        } catch (...) {
+        }
+    }
+
+    std::uint64_t profiler::frame_count() noexcept {
+        return global_registry().frames.load(std::memory_order_relaxed);
+    }
+
+    void profiler::set_thread_name(std::string_view name) {
+        auto* buffer = buffer_for_this_thread();
+        if (!buffer) {
+            return;
+        }
+        std::lock_guard lock(global_registry().mutex);
+        buffer->name = std::string(name);
+    }
+
+    void profiler::set_buffer_capacity(std::size_t events) noexcept {
+        global_registry().capacity.store(events, std::memory_order_relaxed);
+    }
+
+    void profiler::write_chrome_trace(std::ostream& out) {
+        auto& reg = global_registry();
+        std::lock_guard lock(reg.mutex);
+
+        const auto flags = out.flags();
+        const auto precision = out.precision();
+        out << std::fixed << std::setprecision(3);
+        out << "{\"traceEvents\":[";
+
+        bool first = true;
+        const auto separator = [&out, &first] {
+            out << (first ? "\n" : ",\n");
+            first = false;
+        };
+
+        for (const auto& buffer : reg.buffers) {
+            if (!buffer->name.empty()) {
+                separator();
+                out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->id
+                    << ",\"args\":{\"name\":";
+                detail::write_json_string(out, buffer->name);
+                out << "}}";
+            }
+
+            const auto tail_index = buffer->tail.load(std::memory_order_relaxed);
+            const auto head_index = buffer->head.load(std::memory_order_acquire);
+            for (auto i = tail_index; i != head_index; ++i) {
+                const auto& e = buffer->events[i & buffer->mask];
+                separator();
+                if (e.kind == event_kind::frame) {
+                    out << "{\"name\":\"frame " << e.end_ns << "\",\"ph\":\"i\",\"s\":\"g\",\"ts\":"
+                        << to_us(e.start_ns) << ",\"pid\":1,\"tid\":" << buffer->id << '}';
+                } else {
+                    out << "{\"name\":";
+                    detail::write_json_string(out, e.name ? e.name : "");
+                    out << ",\"ph\":\"X\",\"ts\":" << to_us(e.start_ns)
+                        << ",\"dur\":" << to_us(e.end_ns >= e.start_ns ? e.end_ns - e.start_ns : 0)
+                        << ",\"pid\":1,\"tid\":" << buffer->id << '}';
+                }
+            }
+            buffer->tail.store(head_index, std::memory_order_release);
+        }
+        release_retired(reg);
+
+        out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        out.flags(flags);
+        out.precision(precision);
+    }
+
+    std::string profiler::chrome_trace() {
+        std::ostringstream oss;
+        write_chrome_trace(oss);
+        return oss.str();
+    }
+
+    void profiler::clear() {
+        auto& reg = global_registry();
+        std::lock_guard lock(reg.mutex);
+        for (auto& buffer : reg.buffers) {
+            buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+        }
+        release_retired(reg);
+    }
+
+    std::uint64_t profiler::dropped_events() {
+        auto& reg = global_registry();
+        std::lock_guard lock(reg.mutex);
+        std::uint64_t total = reg.released_dropped;
+        for (const auto& buffer : reg.buffers) {
+            total += buffer->dropped.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+} // namespace sdlpp
@@ -0,0 +1,345 @@
+#include <sdlpp/core/timer_wheel.hh>
+
+#include <bit>
+#include <utility>
+
+namespace sdlpp {
+    namespace {
+        constexpr unsigned slot_bits = 6;
+        constexpr std::uint64_t slot_mask = timer_wheel::slots_per_level - 1;
+        constexpr unsigned wheel_bits = slot_bits * timer_wheel::levels;
+
+        static_assert(timer_wheel::slots_per_level == (1u << slot_bits));
+
+        std::size_t slot_at(std::uint64_t tick, std::size_t level) noexcept {
+            return static_cast <std::size_t>((tick >> (slot_bits * level)) & slot_mask);
+        }
+    } // anonymous namespace
+
+    timer_wheel::timer_wheel(std::chrono::nanoseconds resolution)
+        : resolution_(resolution.count() > 0 ? resolution : std::chrono::nanoseconds(1)) {
+    }
+
+    std::uint64_t timer_wheel::ticks_for(std::chrono::nanoseconds delay) const noexcept {
+        if (delay.count() <= 0) {
+            return 1;
+        }
+        const auto ticks = static_cast <std::uint64_t>((delay + resolution_ - std::chrono::nanoseconds(1)) / resolution_);
+        return ticks > 0 ? ticks : 1;
+    }
+
+    timer_wheel::timer_id timer_wheel::schedule(std::chrono::nanoseconds delay, callback fn,
+                                                std::chrono::nanoseconds tolerance) {
+        std::uint64_t expiry = elapsed_ + ticks_for(delay);
+
+        // Coalesce: round up to a power-of-two boundary within the tolerance,
+        // so timers with nearby deadlines share one expiry tick
+        if (tolerance >= resolution_ * 2) {
+            const auto slack = std::bit_floor(static_cast <std::uint64_t>(tolerance / resolution_));
+            expiry = (expiry + slack - 1) & ~(slack - 1);
+        }
+
+        const std::uint32_t index = allocate();
+        auto& n = nodes_[index];
+        n.fn = std::move(fn);
+        n.expiry = expiry;
+        n.period = 0;
+        insert(index);
+        ++pending_;
+        return {index, n.generation};
+    }
+
+    timer_wheel::timer_id timer_wheel::schedule_every(std::chrono::nanoseconds period, callback fn,
+                                                      std::chrono::nanoseconds tolerance) {
+        const auto id = schedule(period, std::move(fn), tolerance);
+        nodes_[id.index].period = ticks_for(period);
+        return id;
+    }
+
+    bool timer_wheel::cancel(timer_id id) noexcept {
+        node* n = lookup(id);
+        if (!n) {
+            return false;
+        }
+
+        if (n->state == node_state::running) {
+            // Inside its own callback: a one-shot timer has already fired,
+            // a periodic one just must not be rescheduled
+            if (n->period == 0 || n->cancelled) {
+                return false;
+            }
+            n->cancelled = true;
+            --pending_;
+            return true;
+        }
+
+        unlink(id.index);
+        release(id.index);
+        --pending_;
+        return true;
+    }
+
+    bool timer_wheel::is_pending(timer_id id) const noexcept {
+        const node* n = lookup(id);
+        if (!n) {
+            return false;
+        }
+        if (n->state == node_state::running) {
+            return n->period != 0 && !n->cancelled;
+        }
+        return true;
+    }
+
+    std::size_t timer_wheel::advance(std::chrono::nanoseconds elapsed) {
+        if (elapsed.count() > 0) {
+            remainder_ += elapsed;
+        }
+        const auto ticks = static_cast <std::uint64_t>(remainder_ / resolution_);
+        remainder_ -= resolution_ * static_cast <std::int64_t>(ticks);
+        const std::uint64_t target = elapsed_ + ticks;
+
+        // Leftovers if a callback threw during the previous advance()
+        std::size_t fired = run_due();
+        while (auto deadline = next_deadline()) {
+            if (*deadline > target) {
+                break;
+            }
+            expire(*deadline);
+            fired += run_due();
+        }
+
+        elapsed_ = target;
+        return fired;
+    }
+
+    std::optional <std::chrono::nanoseconds> timer_wheel::time_until_next() const noexcept {
+        const auto deadline = next_deadline();
+        if (!deadline) {
+            return std::nullopt;
+        }
+        const auto until = resolution_ * static_cast <std::int64_t>(*deadline - elapsed_) - remainder_;
+        return until.count() > 0 ? until : std::chrono::nanoseconds(0);
+    }
+
+    void timer_wheel::clear() noexcept {
+        for (std::uint32_t i = 0; i < nodes_.size(); ++i) {
+            auto& n = nodes_[i];
+            if (n.state == node_state::running) {
+                n.cancelled = true;
+            } else if (n.state != node_state::free) {
+                release(i);
+            }
+        }
+        wheel_ = {};
+        occupied_ = {};
+        overflow_ = {};
+        due_ = {};
+        pending_ = 0;
+    }
+
+    std::uint32_t timer_wheel::allocate() {
+        if (free_ != nil) {
+            const std::uint32_t index = free_;
+            free_ = nodes_[index].next;
+            nodes_[index].next = nil;
+            return index;
+        }
+        nodes_.emplace_back();
+        return static_cast <std::uint32_t>(nodes_.size() - 1);
+    }
+
+    void timer_wheel::release(std::uint32_t index) noexcept {
+        auto& n = nodes_[index];
+        n.fn.reset();
+        n.state = node_state::free;
+        n.cancelled = false;
+        n.prev = nil;
+        n.next = free_;
+        if (++n.generation == 0) {
+            n.generation = 1;
+        }
+        free_ = index;
+    }
+
+    timer_wheel::node* timer_wheel::lookup(timer_id id) noexcept {
+        if (id.index >= nodes_.size()) {
+            return nullptr;
+        }
+        auto& n = nodes_[id.index];
+        return n.generation == id.generation && n.state != node_state::free ? &n : nullptr;
+    }
+
+    const timer_wheel::node* timer_wheel::lookup(timer_id id) const noexcept {
+        return const_cast <timer_wheel*>(this)->lookup(id);
+    }
+
+    void timer_wheel::insert(std::uint32_t index) {
+        auto& n = nodes_[index];
+        n.state = node_state::pending;
+
+        // The level is the highest 6-bit group in which expiry and now differ
+        const std::uint64_t differing = (elapsed_ ^ n.expiry) | slot_mask;
+        const auto level = static_cast <std::size_t>(63 - std::countl_zero(differing)) / slot_bits;
+
+        if (level >= levels) {
+            n.list = static_cast <std::uint8_t>(overflow_list);
+            push_back(overflow_, index);
+            return;
+        }
+
+        const std::size_t slot = slot_at(n.expiry, level);
+        n.list = static_cast <std::uint8_t>(level);
+        n.slot = static_cast <std::uint8_t>(slot);
+        push_back(wheel_[level][slot], index);
+        occupied_[level] |= std::uint64_t{1} << slot;
+    }
+
+    timer_wheel::list_head& timer_wheel::list_of(const node& n) noexcept {
+        if (n.state == node_state::due) {
+            return due_;
+        }
+        if (n.list == overflow_list) {
+            return overflow_;
+        }
+        return wheel_[n.list][n.slot];
+    }
+
+    void timer_wheel::push_back(list_head& list, std::uint32_t index) noexcept {
+        auto& n = nodes_[index];
+        n.prev = list.last;
+        n.next = nil;
+        if (list.last != nil) {
+            nodes_[list.last].next = index;
+        } else {
+            list.first = index;
+        }
+        list.last = index;
+    }
+
+    void timer_wheel::unlink(std::uint32_t index) noexcept {
+        auto& n = nodes_[index];
+        auto& list = list_of(n);
+
+        if (n.prev != nil) {
+            nodes_[n.prev].next = n.next;
+        } else {
+            list.first = n.next;
+        }
+        if (n.next != nil) {
+            nodes_[n.next].prev = n.prev;
+        } else {
+            list.last = n.prev;
+        }
+        n.prev = nil;
+        n.next = nil;
+
+        if (list.first == nil && n.state == node_state::pending && n.list != overflow_list) {
+            occupied_[n.list] &= ~(std::uint64_t{1} << n.slot);
+        }
+    }
+
+    std::optional <std::uint64_t> timer_wheel::next_deadline() const noexcept {
+        std::optional <std::uint64_t> best;
+
+        // Every timer on a level sits in a slot after the one holding now,
+        // so the first occupied slot above it gives the level's next deadline
+        for (std::size_t l = 0; l < levels; ++l) {
+            const std::size_t now_slot = slot_at(elapsed_, l);
+            const std::uint64_t later = now_slot == slot_mask ? 0 : occupied_[l] & (~std::uint64_t{0} << (now_slot + 1));
+            if (later == 0) {
+                continue;
+            }
+
+            const unsigned shift = slot_bits * static_cast <unsigned>(l);
+            const std::uint64_t level_start = elapsed_ & ~((std::uint64_t{1} << (shift + slot_bits)) - 1);
+            const auto slot = static_cast <std::uint64_t>(std::countr_zero(later));
+            const std::uint64_t deadline = level_start + (slot << shift);
+            if (!best || deadline < *best) {
+                best = deadline;
+            }
+        }
+
+        if (overflow_.first != nil) {
+            const std::uint64_t next_block = ((elapsed_ >> wheel_bits) + 1) << wheel_bits;
+            if (!best || next_block < *best) {
+                best = next_block;
+            }
+        }
+        return best;
+    }
+
+    void timer_wheel::expire(std::uint64_t deadline) {
+        elapsed_ = deadline;
+
+        // Redistribute from the top down: a timer moved out of a higher slot
+        // always lands in a lower level, in a slot after the current one
+        const auto redistribute = [this, deadline](list_head& list) {
+            std::uint32_t index = list.first;
+            list = {};
+            while (index != nil) {
+                const std::uint32_t next = nodes_[index].next;
+                if (nodes_[index].expiry <= deadline) {
+                    nodes_[index].state = node_state::due;
+                    push_back(due_, index);
+                } else {
+                    insert(index);
+                }
+                index = next;
+            }
+        };
+
+        // Several levels can share a deadline (a slot boundary on a higher
+        // level is also one on every lower level), so visit all of them
+        if ((deadline & ((std::uint64_t{1} << wheel_bits) - 1)) == 0) {
+            redistribute(overflow_);
+        }
+        for (std::size_t l = levels; l-- > 0;) {
+            const std::size_t slot = slot_at(deadline, l);
+            if (occupied_[l] & (std::uint64_t{1} << slot)) {
+                occupied_[l] &= ~(std::uint64_t{1} << slot);
+                redistribute(wheel_[l][slot]);
+            }
+        }
+    }
+
+    std::size_t timer_wheel::run_due() {
+        std::size_t fired = 0;
+        while (due_.first != nil) {
+            const std::uint32_t index = due_.first;
+            unlink(index);
+
+            // Take the callback out: it may schedule timers, which can
+            // reallocate nodes_
+            auto& n = nodes_[index];
+            n.state = node_state::running;
+            callback fn = std::move(n.fn);
+            if (n.period == 0) {
+                --pending_;
+            }
+
+            try {
+                fn();
+            } catch (...) {
+                if (nodes_[index].period != 0 && !nodes_[index].cancelled) {
+                    --pending_;
+                }
+                release(index);
+                throw;
+            }
+            ++fired;
+
+            auto& after = nodes_[index];
+            if (after.period == 0 || after.cancelled) {
+                release(index);
+                continue;
+            }
+
+            // Periodic: next run relative to this one's deadline, so the
+            // schedule does not drift
+            after.fn = std::move(fn);
+            after.expiry += after.period;
+            insert(index);
+        }
+        return fired;
+    }
+} // namespace sdlpp
@@ -0,0 +1,150 @@
+#include <sdlpp/events/event_coalescer.hh>
+
+#include <algorithm>
+#include <iterator>
+
+namespace sdlpp {
+    namespace {
+        // Same device (and same held buttons / axis), so b can be folded into a
+        bool same_stream(const SDL_Event& a, const SDL_Event& b) noexcept {
+            if (a.type != b.type) {
+                return false;
+            }
+            switch (a.type) {
+                case SDL_EVENT_MOUSE_MOTION:
+                    return a.motion.which == b.motion.which && a.motion.windowID == b.motion.windowID &&
+                           a.motion.state == b.motion.state;
+                case SDL_EVENT_PEN_MOTION:
+                    return a.pmotion.which == b.pmotion.which && a.pmotion.windowID == b.pmotion.windowID &&
+                           a.pmotion.pen_state == b.pmotion.pen_state;
+                case SDL_EVENT_PEN_AXIS:
+                    return a.paxis.which == b.paxis.which && a.paxis.windowID == b.paxis.windowID &&
+                           a.paxis.axis == b.paxis.axis;
+                case SDL_EVENT_FINGER_MOTION:
+                    return a.tfinger.touchID == b.tfinger.touchID && a.tfinger.fingerID == b.tfinger.fingerID &&
+                           a.tfinger.windowID == b.tfinger.windowID;
+                case SDL_EVENT_WINDOW_RESIZED:
+                case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
+                case SDL_EVENT_WINDOW_MOVED:
+                    return a.window.windowID == b.window.windowID;
+                default:
+                    return false;
+            }
+        }
+
+        void merge_into(SDL_Event& dst, const SDL_Event& src) noexcept {
+            switch (src.type) {
+                case SDL_EVENT_MOUSE_MOTION: {
+                    const float xrel = dst.motion.xrel + src.motion.xrel;
+                    const float yrel = dst.motion.yrel + src.motion.yrel;
+                    dst.motion = src.motion;
+                    dst.motion.xrel = xrel;
+                    dst.motion.yrel = yrel;
+                    break;
+                }
+                case SDL_EVENT_FINGER_MOTION: {
+                    const float dx = dst.tfinger.dx + src.tfinger.dx;
+                    const float dy = dst.tfinger.dy + src.tfinger.dy;
+                    dst.tfinger = src.tfinger;
+                    dst.tfinger.dx = dx;
+                    dst.tfinger.dy = dy;
+                    break;
+                }
+                default:
+                    // Absolute state only: the latest event wins
+                    dst = src;
+                    break;
+            }
+        }
+    } // anonymous namespace
+
+    event_coalescer::event_coalescer(coalesce_flags flags, bool keep_pen_history)
+        : flags_(flags), keep_pen_history_(keep_pen_history) {
+    }
+
+    bool event_coalescer::is_mergeable(const SDL_Event& e) const noexcept {
+        switch (e.type) {
+            case SDL_EVENT_MOUSE_MOTION:
+                return has_flag(flags_, coalesce_flags::mouse_motion);
+            case SDL_EVENT_PEN_MOTION:
+            case SDL_EVENT_PEN_AXIS:
+                return has_flag(flags_, coalesce_flags::pen_motion);
+            case SDL_EVENT_FINGER_MOTION:
+                return has_flag(flags_, coalesce_flags::touch_motion);
+            case SDL_EVENT_WINDOW_RESIZED:
+            case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
+            case SDL_EVENT_WINDOW_MOVED:
+                return has_flag(flags_, coalesce_flags::window_geometry);
+            default:
+                return false;
+        }
+    }
+
+    void event_coalescer::record_pen(const SDL_Event& e) {
+        SDL_PenID pen = 0;
+        SDL_WindowID window = 0;
+        if (e.type == SDL_EVENT_PEN_MOTION) {
+            pen = e.pmotion.which;
+            window = e.pmotion.windowID;
+        } else if (e.type == SDL_EVENT_PEN_AXIS && e.paxis.axis == SDL_PEN_AXIS_PRESSURE) {
+            pen = e.paxis.which;
+            window = e.paxis.windowID;
+        } else {
+            return;
+        }
+
+        auto it = std::find_if(pens_.begin(), pens_.end(),
+                               [pen](const pen_state& s) { return s.pen == pen; });
+        if (it == pens_.end()) {
+            pens_.push_back(pen_state{pen, 0.0f, 0.0f, 0.0f});
+            it = std::prev(pens_.end());
+        }
+
+        if (e.type == SDL_EVENT_PEN_MOTION) {
+            it->x = e.pmotion.x;
+            it->y = e.pmotion.y;
+        } else {
+            it->pressure = e.paxis.value;
+        }
+
+        pen_history_.push_back(pen_sample{
+            .timestamp = e.common.timestamp,
+            .pen = pen,
+            .windowID = window,
+            .x = it->x,
+            .y = it->y,
+            .pressure = it->pressure
+        });
+    }
+
+    std::size_t event_coalescer::apply(std::span <SDL_Event> events) {
+        std::size_t out = 0;
+
+        for (std::size_t i = 0; i < events.size(); ++i) {
+            const SDL_Event e = events[i];
+
+            if (keep_pen_history_) {
+                record_pen(e);
+            }
+
+            // Only into the event just before: merging across another event
+            // would deliver the later state ahead of it
+            if (out > 0 && is_mergeable(e) && same_stream(events[out - 1], e)) {
+                merge_into(events[out - 1], e);
+                ++merged_;
+            } else {
+                events[out++] = e;
+            }
+        }
+
+        return out;
+    }
+
+    std::size_t event_coalescer::poll(event_buffer& buffer, bool pump) {
+        if (buffer.poll(pump) == 0) {
+            return 0;
+        }
+        buffer.truncate(apply(buffer.raw()));
+        return buffer.size();
+    }
+} // namespace sdlpp
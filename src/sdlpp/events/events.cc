@@ -1,4 +1,5 @@
 #include <sdlpp/events/events.hh>
+#include <sdlpp/core/profiler.hh>
 #include <sdlpp/detail/type_utils.hh>
 
 namespace sdlpp {
@@ -11,7 +12,21 @@ namespace sdlpp {
         return std::nullopt;
     }
 
+    std::size_t event_queue::poll_batch(std::span <SDL_Event> events, bool pump) {
+        if (events.empty()) {
+            return 0;
+        }
+        SDLPP_PROFILE_ZONE("event_queue::poll_batch");
+        if (pump) {
+            SDL_PumpEvents();
+        }
+        const int got = SDL_PeepEvents(events.data(), detail::clamp_size_to_int(events.size()), SDL_GETEVENT,
+                                       SDL_EVENT_FIRST, SDL_EVENT_LAST);
+        return got > 0 ? static_cast <std::size_t>(got) : 0;
+    }
+
     expected <event, std::string> event_queue::wait() {
+        SDLPP_PROFILE_ZONE("event_queue::wait");
         SDL_Event e;
         if (SDL_WaitEvent(&e)) {
             return event(std::move(e));
@@ -20,6 +35,7 @@ namespace sdlpp {
     }
 
     std::optional<event> event_queue::wait_timeout(std::chrono::milliseconds timeout) {
+        SDLPP_PROFILE_ZONE("event_queue::wait_timeout");
         SDL_Event e;
         if (SDL_WaitEventTimeout(&e, static_cast <Sint32>(timeout.count()))) {
             return event(std::move(e));
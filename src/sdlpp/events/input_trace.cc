@@ -0,0 +1,426 @@
+#include <sdlpp/events/input_trace.hh>
+
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <optional>
+
+namespace sdlpp {
+    namespace {
+        constexpr std::array <char, 8> trace_magic = {'S', 'D', 'L', 'P', 'P', 'I', 'R', 'T'};
+        constexpr std::uint8_t trace_version = 1;
+        constexpr std::size_t flush_threshold = 64 * 1024;
+
+        // Bytes shared by every event (type, reserved, timestamp); not stored
+        constexpr std::size_t header_size = sizeof(SDL_CommonEvent);
+
+        void put_varint(std::vector <std::uint8_t>& out, std::uint64_t value) {
+            while (value >= 0x80) {
+                out.push_back(static_cast <std::uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast <std::uint8_t>(value));
+        }
+
+        bool get_varint(std::span <const std::uint8_t> data, std::size_t& pos, std::uint64_t& value) {
+            value = 0;
+            for (unsigned shift = 0; shift < 64; shift += 7) {
+                if (pos >= data.size()) {
+                    return false;
+                }
+                const std::uint8_t byte = data[pos++];
+                value |= static_cast <std::uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Size of the union member used by an event type
+        std::size_t event_struct_size(Uint32 type) noexcept {
+            switch (type) {
+                case SDL_EVENT_KEY_DOWN:
+                case SDL_EVENT_KEY_UP: return sizeof(SDL_KeyboardEvent);
+                case SDL_EVENT_TEXT_EDITING: return sizeof(SDL_TextEditingEvent);
+                case SDL_EVENT_TEXT_EDITING_CANDIDATES: return sizeof(SDL_TextEditingCandidatesEvent);
+                case SDL_EVENT_TEXT_INPUT: return sizeof(SDL_TextInputEvent);
+                case SDL_EVENT_KEYBOARD_ADDED:
+                case SDL_EVENT_KEYBOARD_REMOVED: return sizeof(SDL_KeyboardDeviceEvent);
+                case SDL_EVENT_MOUSE_MOTION: return sizeof(SDL_MouseMotionEvent);
+                case SDL_EVENT_MOUSE_BUTTON_DOWN:
+                case SDL_EVENT_MOUSE_BUTTON_UP: return sizeof(SDL_MouseButtonEvent);
+                case SDL_EVENT_MOUSE_WHEEL: return sizeof(SDL_MouseWheelEvent);
+                case SDL_EVENT_MOUSE_ADDED:
+                case SDL_EVENT_MOUSE_REMOVED: return sizeof(SDL_MouseDeviceEvent);
+                case SDL_EVENT_JOYSTICK_AXIS_MOTION: return sizeof(SDL_JoyAxisEvent);
+                case SDL_EVENT_JOYSTICK_BALL_MOTION: return sizeof(SDL_JoyBallEvent);
+                case SDL_EVENT_JOYSTICK_HAT_MOTION: return sizeof(SDL_JoyHatEvent);
+                case SDL_EVENT_JOYSTICK_BUTTON_DOWN:
+                case SDL_EVENT_JOYSTICK_BUTTON_UP: return sizeof(SDL_JoyButtonEvent);
+                case SDL_EVENT_JOYSTICK_BATTERY_UPDATED: return sizeof(SDL_JoyBatteryEvent);
+                case SDL_EVENT_JOYSTICK_ADDED:
+                case SDL_EVENT_JOYSTICK_REMOVED:
+                case SDL_EVENT_JOYSTICK_UPDATE_COMPLETE: return sizeof(SDL_JoyDeviceEvent);
+                case SDL_EVENT_GAMEPAD_AXIS_MOTION: return sizeof(SDL_GamepadAxisEvent);
+                case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+                case SDL_EVENT_GAMEPAD_BUTTON_UP: return sizeof(SDL_GamepadButtonEvent);
+                case SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN:
+                case SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION:
+                case SDL_EVENT_GAMEPAD_TOUCHPAD_UP: return sizeof(SDL_GamepadTouchpadEvent);
+                case SDL_EVENT_GAMEPAD_SENSOR_UPDATE: return sizeof(SDL_GamepadSensorEvent);
+                case SDL_EVENT_GAMEPAD_ADDED:
+                case SDL_EVENT_GAMEPAD_REMOVED:
+                case SDL_EVENT_GAMEPAD_REMAPPED:
+                case SDL_EVENT_GAMEPAD_UPDATE_COMPLETE:
+                case SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED: return sizeof(SDL_GamepadDeviceEvent);
+                case SDL_EVENT_FINGER_DOWN:
+                case SDL_EVENT_FINGER_UP:
+                case SDL_EVENT_FINGER_MOTION:
+                case SDL_EVENT_FINGER_CANCELED: return sizeof(SDL_TouchFingerEvent);
+                case SDL_EVENT_PEN_PROXIMITY_IN:
+                case SDL_EVENT_PEN_PROXIMITY_OUT: return sizeof(SDL_PenProximityEvent);
+                case SDL_EVENT_PEN_DOWN:
+                case SDL_EVENT_PEN_UP: return sizeof(SDL_PenTouchEvent);
+                case SDL_EVENT_PEN_BUTTON_DOWN:
+                case SDL_EVENT_PEN_BUTTON_UP: return sizeof(SDL_PenButtonEvent);
+                case SDL_EVENT_PEN_MOTION: return sizeof(SDL_PenMotionEvent);
+                case SDL_EVENT_PEN_AXIS: return sizeof(SDL_PenAxisEvent);
+                case SDL_EVENT_CLIPBOARD_UPDATE: return sizeof(SDL_ClipboardEvent);
+                case SDL_EVENT_DROP_FILE:
+                case SDL_EVENT_DROP_TEXT:
+                case SDL_EVENT_DROP_BEGIN:
+                case SDL_EVENT_DROP_COMPLETE:
+                case SDL_EVENT_DROP_POSITION: return sizeof(SDL_DropEvent);
+                case SDL_EVENT_AUDIO_DEVICE_ADDED:
+                case SDL_EVENT_AUDIO_DEVICE_REMOVED:
+                case SDL_EVENT_AUDIO_DEVICE_FORMAT_CHANGED: return sizeof(SDL_AudioDeviceEvent);
+                case SDL_EVENT_SENSOR_UPDATE: return sizeof(SDL_SensorEvent);
+                case SDL_EVENT_CAMERA_DEVICE_ADDED:
+                case SDL_EVENT_CAMERA_DEVICE_REMOVED:
+                case SDL_EVENT_CAMERA_DEVICE_APPROVED:
+                case SDL_EVENT_CAMERA_DEVICE_DENIED: return sizeof(SDL_CameraDeviceEvent);
+                case SDL_EVENT_RENDER_TARGETS_RESET:
+                case SDL_EVENT_RENDER_DEVICE_RESET:
+                case SDL_EVENT_RENDER_DEVICE_LOST: return sizeof(SDL_RenderEvent);
+                default:
+                    break;
+            }
+            if (type >= SDL_EVENT_DISPLAY_FIRST && type <= SDL_EVENT_DISPLAY_LAST) {
+                return sizeof(SDL_DisplayEvent);
+            }
+            if (type >= SDL_EVENT_WINDOW_FIRST && type <= SDL_EVENT_WINDOW_LAST) {
+                return sizeof(SDL_WindowEvent);
+            }
+            if (type >= SDL_EVENT_USER) {
+                return sizeof(SDL_UserEvent);
+            }
+            return sizeof(SDL_CommonEvent);
+        }
+
+        // Pointer fields carried as strings, in serialization order
+        std::size_t string_fields(SDL_Event& e, const char** fields[2]) noexcept {
+            switch (e.type) {
+                case SDL_EVENT_TEXT_INPUT:
+                    fields[0] = &e.text.text;
+                    return 1;
+                case SDL_EVENT_TEXT_EDITING:
+                    fields[0] = &e.edit.text;
+                    return 1;
+                case SDL_EVENT_DROP_FILE:
+                case SDL_EVENT_DROP_TEXT:
+                case SDL_EVENT_DROP_BEGIN:
+                case SDL_EVENT_DROP_COMPLETE:
+                case SDL_EVENT_DROP_POSITION:
+                    fields[0] = &e.drop.source;
+                    fields[1] = &e.drop.data;
+                    return 2;
+                default:
+                    return 0;
+            }
+        }
+
+        // Clear pointers that cannot survive a round trip through a file
+        void clear_pointers(SDL_Event& e) noexcept {
+            const char** fields[2] = {};
+            const std::size_t count = string_fields(e, fields);
+            for (std::size_t i = 0; i < count; ++i) {
+                *fields[i] = nullptr;
+            }
+            if (e.type == SDL_EVENT_TEXT_EDITING_CANDIDATES) {
+                e.edit_candidates.candidates = nullptr;
+                e.edit_candidates.num_candidates = 0;
+            } else if (e.type == SDL_EVENT_CLIPBOARD_UPDATE) {
+                e.clipboard.mime_types = nullptr;
+                e.clipboard.num_mime_types = 0;
+            } else if (e.type >= SDL_EVENT_USER) {
+                e.user.data1 = nullptr;
+                e.user.data2 = nullptr;
+            }
+        }
+    } // anonymous namespace
+
+    // ========================================================================
+    // input_recorder
+    // ========================================================================
+
+    struct input_recorder::state {
+        std::mutex mutex;
+        iostream stream;
+        std::vector <std::uint8_t> buffer;
+        std::optional <event_watcher> watcher;
+        std::optional <std::string> failure;
+        Uint64 last_timestamp = 0;
+        bool have_timestamp = false;
+        std::size_t events = 0;
+        std::size_t bytes = 0;
+
+        expected <void, std::string> flush_locked() {
+            if (!buffer.empty()) {
+                auto written = stream.write(buffer.data(), buffer.size());
+                if (!written) {
+                    failure = written.error();
+                } else if (*written < buffer.size()) {
+                    failure = "Short write to input trace";
+                }
+                buffer.clear();
+            }
+            if (failure) {
+                return make_unexpectedf(*failure);
+            }
+            return {};
+        }
+
+        static bool SDLCALL watch(void* userdata, SDL_Event* e) {
+            static_cast <state*>(userdata)->append(*e);
+            return true;
+        }
+
+        void append(const SDL_Event& original) {
+            SDL_Event e = original;
+
+            const char** fields[2] = {};
+            const std::size_t string_count = string_fields(e, fields);
+            const char* strings[2] = {};
+            for (std::size_t i = 0; i < string_count; ++i) {
+                strings[i] = *fields[i];
+            }
+            clear_pointers(e);
+
+            std::lock_guard lock(mutex);
+
+            const Uint64 timestamp = e.common.timestamp;
+            const Uint64 delta = have_timestamp && timestamp > last_timestamp ? timestamp - last_timestamp : 0;
+            if (!have_timestamp || timestamp > last_timestamp) {
+                last_timestamp = timestamp;
+                have_timestamp = true;
+            }
+
+            const auto* bytes_begin = reinterpret_cast <const std::uint8_t*>(&e);
+            std::size_t payload = event_struct_size(e.type);
+            while (payload > header_size && bytes_begin[payload - 1] == 0) {
+                --payload;
+            }
+            payload -= header_size;
+
+            const std::size_t before = buffer.size();
+            put_varint(buffer, delta);
+            put_varint(buffer, e.type);
+            put_varint(buffer, payload);
+            buffer.insert(buffer.end(), bytes_begin + header_size, bytes_begin + header_size + payload);
+            for (std::size_t i = 0; i < string_count; ++i) {
+                if (!strings[i]) {
+                    put_varint(buffer, 0);
+                    continue;
+                }
+                const std::size_t len = std::strlen(strings[i]);
+                put_varint(buffer, len + 1);
+                buffer.insert(buffer.end(), strings[i], strings[i] + len);
+            }
+
+            bytes += buffer.size() - before;
+            ++events;
+
+            if (buffer.size() >= flush_threshold) {
+                [[maybe_unused]] auto flushed = flush_locked();
+            }
+        }
+    };
+
+    expected <input_recorder, std::string> input_recorder::create(const std::filesystem::path& path) {
+        auto stream = open_file(path, file_mode::write_binary);
+        if (!stream) {
+            return make_unexpectedf("Failed to create input trace:", stream.error());
+        }
+        return input_recorder(std::move(*stream));
+    }
+
+    input_recorder::input_recorder(iostream stream)
+        : state_(std::make_unique <state>()) {
+        state_->stream = std::move(stream);
+        state_->buffer.reserve(flush_threshold + 256);
+        state_->buffer.insert(state_->buffer.end(), trace_magic.begin(), trace_magic.end());
+        state_->buffer.push_back(trace_version);
+        state_->bytes = state_->buffer.size();
+    }
+
+    input_recorder::~input_recorder() {
+        if (state_) {
+            [[maybe_unused]] auto stopped = stop();
+        }
+    }
+
+    input_recorder::input_recorder(input_recorder&&) noexcept = default;
+    input_recorder& input_recorder::operator=(input_recorder&&) noexcept = default;
+
+    void input_recorder::start() {
+        if (!state_->watcher) {
+            state_->watcher.emplace(&state::watch, state_.get());
+        }
+    }
+
+    expected <void, std::string> input_recorder::stop() {
+        state_->watcher.reset();
+        return flush();
+    }
+
+    bool input_recorder::is_recording() const noexcept {
+        return state_ && state_->watcher.has_value();
+    }
+
+    void input_recorder::record(const SDL_Event& e) {
+        state_->append(e);
+    }
+
+    expected <void, std::string> input_recorder::flush() {
+        std::lock_guard lock(state_->mutex);
+        if (auto flushed = state_->flush_locked(); !flushed) {
+            return flushed;
+        }
+        return state_->stream.flush();
+    }
+
+    std::size_t input_recorder::event_count() const noexcept {
+        std::lock_guard lock(state_->mutex);
+        return state_->events;
+    }
+
+    std::size_t input_recorder::byte_count() const noexcept {
+        std::lock_guard lock(state_->mutex);
+        return state_->bytes;
+    }
+
+    // ========================================================================
+    // input_replayer
+    // ========================================================================
+
+    expected <input_replayer, std::string> input_replayer::load(const std::filesystem::path& path) {
+        auto data = load_file(path.string());
+        if (!data) {
+            return make_unexpectedf("Failed to load input trace:", data.error());
+        }
+        return from_bytes(std::span <const std::uint8_t>(*data));
+    }
+
+    expected <input_replayer, std::string> input_replayer::from_bytes(std::span <const std::uint8_t> data) {
+        if (data.size() < trace_magic.size() + 1
+            || std::memcmp(data.data(), trace_magic.data(), trace_magic.size()) != 0) {
+            return make_unexpectedf("Not an input trace");
+        }
+        if (data[trace_magic.size()] != trace_version) {
+            return make_unexpectedf("Unsupported input trace version:", static_cast <unsigned>(data[trace_magic.size()]));
+        }
+
+        input_replayer replayer;
+        std::size_t pos = trace_magic.size() + 1;
+        Uint64 offset = 0;
+
+        while (pos < data.size()) {
+            std::uint64_t delta = 0, type = 0, payload = 0;
+            if (!get_varint(data, pos, delta) || !get_varint(data, pos, type) || !get_varint(data, pos, payload)) {
+                return make_unexpectedf("Input trace is truncated at byte", pos);
+            }
+            if (type > SDL_EVENT_LAST || payload > sizeof(SDL_Event) - header_size
+                || payload > data.size() - pos) {
+                return make_unexpectedf("Corrupt input trace record at byte", pos);
+            }
+
+            entry item{};
+            offset += delta;
+            item.offset_ns = offset;
+            item.event.type = static_cast <Uint32>(type);
+            std::memcpy(reinterpret_cast <std::uint8_t*>(&item.event) + header_size, data.data() + pos,
+                        static_cast <std::size_t>(payload));
+            pos += static_cast <std::size_t>(payload);
+
+            const char** fields[2] = {};
+            const std::size_t string_count = string_fields(item.event, fields);
+            for (std::size_t i = 0; i < string_count; ++i) {
+                std::uint64_t len = 0;
+                if (!get_varint(data, pos, len) || (len > 0 && len - 1 > data.size() - pos)) {
+                    return make_unexpectedf("Input trace is truncated at byte", pos);
+                }
+                if (len == 0) {
+                    *fields[i] = nullptr;
+                    continue;
+                }
+                const auto size = static_cast <std::size_t>(len - 1);
+                auto text = std::make_unique <char[]>(size + 1);
+                std::memcpy(text.get(), data.data() + pos, size);
+                text[size] = '\0';
+                pos += size;
+                *fields[i] = text.get();
+                replayer.strings_.push_back(std::move(text));
+            }
+
+            replayer.entries_.push_back(item);
+        }
+
+        return replayer;
+    }
+
+    void input_replayer::set_speed(double factor) noexcept {
+        speed_ = factor > 0.0 ? factor : 1.0;
+    }
+
+    void input_replayer::set_fast_forward(std::chrono::nanoseconds frame_step) noexcept {
+        frame_step_ns_ = frame_step.count() > 0 ? static_cast <Uint64>(frame_step.count()) : 0;
+    }
+
+    void input_replayer::start() noexcept {
+        next_ = 0;
+        virtual_ns_ = 0;
+        start_ns_ = SDL_GetTicksNS();
+    }
+
+    expected <std::size_t, std::string> input_replayer::update() {
+        Uint64 now = 0;
+        if (frame_step_ns_ > 0) {
+            now = virtual_ns_;
+            virtual_ns_ += frame_step_ns_;
+        } else {
+            const auto elapsed = static_cast <double>(SDL_GetTicksNS() - start_ns_);
+            now = static_cast <Uint64>(elapsed * speed_);
+        }
+
+        std::size_t pushed = 0;
+        while (next_ < entries_.size() && entries_[next_].offset_ns <= now) {
+            SDL_Event e = entries_[next_].event;
+            e.common.timestamp = 0;  // Let SDL stamp the injection time
+            auto pushed_event = event_queue::push(event(e));
+            if (!pushed_event) {
+                return make_unexpectedf("Failed to inject recorded event:", pushed_event.error());
+            }
+            ++next_;
+            ++pushed;
+        }
+        return pushed;
+    }
+
+    std::chrono::nanoseconds input_replayer::duration() const noexcept {
+        if (entries_.empty()) {
+            return std::chrono::nanoseconds::zero();
+        }
+        return std::chrono::nanoseconds(static_cast <std::int64_t>(entries_.back().offset_ns));
+    }
+} // namespace sdlpp
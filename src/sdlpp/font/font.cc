@@ -10,6 +10,7 @@
 #include <onyx_font/vector_font.hh>
 #include <onyx_font/ttf_font.hh>
 
+#include <cstring>
 #include <fstream>
 #include <cmath>
 #include <algorithm>
@@ -56,6 +57,26 @@ std::vector<std::uint8_t> read_file(const std::filesystem::path& path) {
     return data;
 }
 
+// Fast 64-bit content hash (word-at-a-time multiply/xorshift)
+std::uint64_t hash_bytes(std::span<const std::uint8_t> data, std::uint64_t seed) {
+    constexpr std::uint64_t prime = 0x9E3779B97F4A7C15ULL;
+    std::uint64_t h = seed ^ (static_cast<std::uint64_t>(data.size()) * prime);
+
+    std::size_t i = 0;
+    for (; i + 8 <= data.size(); i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, data.data() + i, sizeof(word));
+        h = (h ^ word) * prime;
+        h ^= h >> 29;
+    }
+    for (; i < data.size(); ++i) {
+        h = (h ^ data[i]) * prime;
+    }
+
+    h ^= h >> 32;
+    return h * prime;
+}
+
 } // anonymous namespace
 
 // ============================================================================
@@ -87,6 +108,7 @@ expected<font, std::string> font::load(const std::filesystem::path& path, std::s
 expected<font, std::string> font::load(std::span<const std::uint8_t> data, std::size_t index) {
     font f;
     f.m_impl = std::make_unique<impl>();
+    f.m_identity = hash_bytes(data, static_cast<std::uint64_t>(index));
 
     // Analyze the container
     f.m_container_info = onyx_font::font_factory::analyze(data);
@@ -154,6 +176,7 @@ expected<font, std::string> font::load_raw(
 
     font f;
     f.m_impl = std::make_unique<impl>();
+    f.m_identity = hash_bytes(data, static_cast<std::uint64_t>(options.char_height));
 
     try {
         auto bitmap = onyx_font::font_factory::load_raw(data, options);
@@ -5,13 +5,98 @@
 #include <sdlpp/font/font_cache.hh>
 #include <sdlpp/font/font.hh>
 #include <sdlpp/font/sdl_raster_target.hh>
+#include <sdlpp/core/log.hh>
+#include <sdlpp/core/profiler.hh>
 
 #include <onyx_font/text/utf8.hh>
 #include <cmath>
 #include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <vector>
 
 namespace sdlpp::font {
 
+namespace {
+
+// ============================================================================
+// Snapshot File Layout
+// ============================================================================
+
+constexpr char snapshot_magic[8] = {'S', 'D', 'L', 'P', 'P', 'F', 'C', 'S'};
+constexpr std::uint32_t snapshot_version = 2;
+constexpr std::size_t snapshot_page_alignment = 64;
+
+struct snapshot_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t header_size;
+    std::uint64_t font_key;         // Font identity
+    std::uint32_t page_width;
+    std::uint32_t page_height;
+    std::uint32_t page_count;
+    std::uint32_t glyph_count;
+    std::uint64_t glyph_offset;     // Byte offset of the glyph table
+    std::uint64_t page_offset;      // Byte offset of the first page (aligned)
+    std::uint8_t reserved[8];
+};
+static_assert(sizeof(snapshot_header) == 64);
+
+struct snapshot_glyph {
+    std::uint32_t codepoint;
+    std::int32_t page;
+    std::int32_t x;
+    std::int32_t y;
+    std::int32_t width;
+    std::int32_t height;
+    std::int32_t offset_x;
+    std::int32_t offset_y;
+    std::int32_t advance;
+    std::uint32_t size_q;           // Pixel size in 1/64 units
+    std::uint32_t style;
+};
+static_assert(sizeof(snapshot_glyph) == 44);
+
+// Sizes are quantized to 1/64 pixel, matching the glyph set key
+constexpr float size_scale = 64.0f;
+
+std::uint32_t quantize_size(float size) {
+    if (!(size > 0.0f)) return 0;
+    return static_cast<std::uint32_t>(std::lround(std::min(size, 65535.0f) * size_scale));
+}
+
+std::size_t align_up(std::size_t value, std::size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// Temporarily switches the font to another size and style
+class font_state_scope {
+public:
+    font_state_scope(font& fnt, float size, text_style style)
+        : m_font(fnt)
+        , m_size(fnt.size())
+        , m_style(fnt.style()) {
+        if (m_size != size) m_font.set_size(size);
+        if (m_style != style) m_font.set_style(style);
+    }
+
+    ~font_state_scope() {
+        if (m_font.size() != m_size) m_font.set_size(m_size);
+        if (m_font.style() != m_style) m_font.set_style(m_style);
+    }
+
+    font_state_scope(const font_state_scope&) = delete;
+    font_state_scope& operator=(const font_state_scope&) = delete;
+
+private:
+    font& m_font;
+    float m_size;
+    text_style m_style;
+};
+
+} // anonymous namespace
+
 // ============================================================================
 // Constructor / Destructor
 // ============================================================================
@@ -29,11 +114,42 @@ font_cache& font_cache::operator=(font_cache&&) noexcept = default;
 // Glyph Caching
 // ============================================================================
 
-bool font_cache::store_glyph(char32_t codepoint) {
-    if (m_glyphs.contains(codepoint)) {
+std::uint64_t font_cache::set_key(float size, text_style style) noexcept {
+    return (static_cast<std::uint64_t>(quantize_size(size)) << 32) | static_cast<std::uint32_t>(style);
+}
+
+float font_cache::set_size(float size) const {
+    // Bitmap fonts rasterize at their native size whatever size is set
+    if (!m_font->is_scalable() && m_font->native_size() > 0.0f) {
+        return m_font->native_size();
+    }
+    return size;
+}
+
+const font_cache::glyph_set* font_cache::find_set(float size, text_style style) const {
+    auto it = m_sets.find(set_key(set_size(size), style));
+    return it != m_sets.end() ? &it->second : nullptr;
+}
+
+font_cache::glyph_set& font_cache::get_set(float size, text_style style) {
+    size = set_size(size);
+    auto [it, inserted] = m_sets.try_emplace(set_key(size, style));
+    if (inserted) {
+        it->second.size = size;
+        it->second.style = style;
+        font_state_scope scope(*m_font, size, style);
+        it->second.line_height = static_cast<int>(std::ceil(m_font->line_height()));
+    }
+    return it->second;
+}
+
+bool font_cache::store_glyph(glyph_set& set, char32_t codepoint) {
+    if (set.glyphs.contains(codepoint)) {
         return true;  // Already cached
     }
 
+    font_state_scope scope(*m_font, set.size, set.style);
+
     auto* rast = m_font->rasterizer();
     if (!rast) return false;
 
@@ -59,36 +175,22 @@ bool font_cache::store_glyph(char32_t codepoint) {
         return false;
     }
 
-    // Create surface for glyph - use ABGR8888 which stores bytes as R,G,B,A on little-endian
-    auto surf_result = surface::create_rgb(width, height, pixel_format_enum::ABGR8888);
-    if (!surf_result) {
-        return false;
-    }
-
-    auto& surf = *surf_result;
-
-    // Clear to transparent
-    surf.fill_rect(rect<int>(0, 0, width, height), color{0, 0, 0, 0});
-
-    // Render glyph in white (will be color modulated when drawing)
-    surface_raster_target target(surf, {255, 255, 255, 255});
+    // Rasterize coverage only (color is applied when drawing)
+    std::vector<std::uint8_t> coverage(static_cast<std::size_t>(width) * static_cast<std::size_t>(height), 0);
+    coverage_raster_target target(coverage.data(), width, height);
 
     int baseline = static_cast<int>(std::ceil(font_metrics.ascent)) + 1;
 
     rast->rasterize_glyph(codepoint, target, 1, baseline);
 
-    // Create texture
-    auto tex_result = texture::create(*m_renderer, surf);
-    if (!tex_result) {
+    // Pack into the shared atlas
+    glyph_data data;
+    data.slot = m_atlas.allocate(width, height);
+    if (!data.slot.valid()) {
         return false;
     }
+    m_atlas.write(data.slot, coverage.data(), width);
 
-    // Enable blending on texture
-    tex_result->set_blend_mode(blend_mode::blend);
-
-    // Store in cache
-    glyph_data data;
-    data.tex = std::move(*tex_result);
     // Use bearing_x for proper horizontal positioning
     // bearing_x is the distance from pen position to left edge of glyph
     data.offset_x = static_cast<int>(std::floor(metrics.bearing_x));
@@ -97,19 +199,91 @@ bool font_cache::store_glyph(char32_t codepoint) {
     data.width = width;
     data.height = height;
 
-    m_glyphs[codepoint] = std::move(data);
+    set.glyphs[codepoint] = std::move(data);
     return true;
 }
 
+const glyph_data* font_cache::lookup(glyph_set& set, char32_t codepoint) {
+    auto it = set.glyphs.find(codepoint);
+    if (it != set.glyphs.end()) {
+        ++set.hits;
+        return &it->second;
+    }
+
+    // Cache on-demand
+    ++set.misses;
+    if (!store_glyph(set, codepoint)) {
+        // Missing glyphs are looked up again on every draw; keep this quiet
+        SDLPP_LOG_EVERY_MS(log_category::render, log_priority::debug, 1000,
+                           "font_cache: cannot cache glyph for codepoint", static_cast<std::uint32_t>(codepoint));
+        return nullptr;
+    }
+    it = set.glyphs.find(codepoint);
+    return it != set.glyphs.end() ? &it->second : nullptr;
+}
+
+bool font_cache::store_glyph(char32_t codepoint) {
+    return store_glyph(codepoint, m_font->size(), m_font->style());
+}
+
+bool font_cache::store_glyph(char32_t codepoint, float size, text_style style) {
+    return store_glyph(get_set(size, style), codepoint);
+}
+
 void font_cache::store_glyphs(char32_t begin, char32_t end) {
+    store_glyphs(begin, end, m_font->size(), m_font->style());
+}
+
+void font_cache::store_glyphs(char32_t begin, char32_t end, float size, text_style style) {
+    auto& set = get_set(size, style);
     for (char32_t cp = begin; cp < end; ++cp) {
-        store_glyph(cp);
+        store_glyph(set, cp);
     }
 }
 
+const glyph_data* font_cache::get_glyph(char32_t codepoint) {
+    return get_glyph(codepoint, m_font->size(), m_font->style());
+}
+
+const glyph_data* font_cache::get_glyph(char32_t codepoint, float size, text_style style) {
+    return lookup(get_set(size, style), codepoint);
+}
+
 const glyph_data* font_cache::find_glyph(char32_t codepoint) const {
-    auto it = m_glyphs.find(codepoint);
-    return it != m_glyphs.end() ? &it->second : nullptr;
+    return find_glyph(codepoint, m_font->size(), m_font->style());
+}
+
+const glyph_data* font_cache::find_glyph(char32_t codepoint, float size, text_style style) const {
+    const glyph_set* set = find_set(size, style);
+    if (!set) return nullptr;
+    auto it = set->glyphs.find(codepoint);
+    return it != set->glyphs.end() ? &it->second : nullptr;
+}
+
+texture* font_cache::page_texture(int page) {
+    if (page < 0 || page >= m_atlas.page_count()) {
+        return nullptr;
+    }
+
+    if (m_pages.size() < static_cast<std::size_t>(m_atlas.page_count())) {
+        m_pages.resize(static_cast<std::size_t>(m_atlas.page_count()));
+    }
+
+    auto& entry = m_pages[static_cast<std::size_t>(page)];
+    const std::uint64_t revision = m_atlas.page_revision(page);
+    if (entry.tex && entry.revision == revision) {
+        return &entry.tex;
+    }
+
+    if (entry.tex) {
+        if (!m_atlas.upload(entry.tex, page)) return nullptr;
+    } else {
+        auto tex = m_atlas.make_texture(*m_renderer, page);
+        if (!tex) return nullptr;
+        entry.tex = std::move(*tex);
+    }
+    entry.revision = revision;
+    return &entry.tex;
 }
 
 // ============================================================================
@@ -148,39 +322,74 @@ void font_cache::remove_string(string_id id) {
 // ============================================================================
 
 int font_cache::render_glyph(char32_t codepoint, int x, int y, const color& fg) {
-    // Try to find cached glyph
-    const glyph_data* glyph = find_glyph(codepoint);
+    return render_glyph(codepoint, x, y, fg, m_font->size(), m_font->style());
+}
 
-    // Cache on-demand if not found
+int font_cache::render_glyph(char32_t codepoint, int x, int y, const color& fg,
+                             float size, text_style style) {
+    const glyph_data* glyph = lookup(get_set(size, style), codepoint);
     if (!glyph) {
-        if (!store_glyph(codepoint)) {
-            return x;  // Failed, return same position
-        }
-        glyph = find_glyph(codepoint);
-        if (!glyph) return x;
+        return x;  // Failed, return same position
     }
 
+    texture* page = page_texture(glyph->slot.page);
+    if (!page) return x;
+
     // Set color modulation
-    const_cast<texture&>(glyph->tex).set_color_mod(fg);
-    const_cast<texture&>(glyph->tex).set_alpha_mod(fg.a);
+    page->set_color_mod(fg);
+    page->set_alpha_mod(fg.a);
 
     // Draw glyph
+    rect<int> src(glyph->slot.x, glyph->slot.y, glyph->slot.width, glyph->slot.height);
     rect<int> dst(x + glyph->offset_x, y + glyph->offset_y, glyph->width, glyph->height);
-    m_renderer->copy(glyph->tex, std::optional<rect<int>>{}, std::optional{dst});
+    m_renderer->copy(*page, std::optional{src}, std::optional{dst});
 
     return x + glyph->advance;
 }
 
 int font_cache::render_text(std::string_view text, int x, int y, const color& fg) {
+    return render_text(text, x, y, fg, m_font->size(), m_font->style());
+}
+
+int font_cache::render_text(std::string_view text, int x, int y, const color& fg, float size) {
+    return render_text(text, x, y, fg, size, m_font->style());
+}
+
+int font_cache::render_text(std::string_view text, int x, int y, const color& fg,
+                            float size, text_style style) {
+    SDLPP_PROFILE_ZONE("font_cache::render_text");
+    // Resolve the set once per string rather than once per glyph
+    auto& set = get_set(size, style);
     int pen_x = x;
 
     for (char32_t codepoint : onyx_font::utf8_view(text)) {
-        pen_x = render_glyph(codepoint, pen_x, y, fg);
+        const glyph_data* glyph = lookup(set, codepoint);
+        if (!glyph) continue;
+
+        texture* page = page_texture(glyph->slot.page);
+        if (!page) continue;
+
+        page->set_color_mod(fg);
+        page->set_alpha_mod(fg.a);
+
+        rect<int> src(glyph->slot.x, glyph->slot.y, glyph->slot.width, glyph->slot.height);
+        rect<int> dst(pen_x + glyph->offset_x, y + glyph->offset_y, glyph->width, glyph->height);
+        m_renderer->copy(*page, std::optional{src}, std::optional{dst});
+
+        pen_x += glyph->advance;
     }
 
     return pen_x - x;  // Return width
 }
 
+int font_cache::line_height() const {
+    return static_cast<int>(std::ceil(m_font->line_height()));
+}
+
+int font_cache::line_height(float size, text_style style) {
+    return get_set(size, style).line_height;
+}
+
 void font_cache::render_string(string_id id, int x, int y) {
     const texture* tex = find_string(id);
     if (!tex) return;
@@ -193,12 +402,220 @@ void font_cache::render_string(string_id id, int x, int y) {
     m_renderer->copy(*tex, std::optional<rect<int>>{}, std::optional{dst});
 }
 
+// ============================================================================
+// Snapshots
+// ============================================================================
+
+std::vector<std::uint8_t> font_cache::save_snapshot() const {
+    const std::size_t glyph_total = glyph_count();
+    const std::size_t glyph_bytes = glyph_total * sizeof(snapshot_glyph);
+    const std::size_t page_offset = align_up(sizeof(snapshot_header) + glyph_bytes, snapshot_page_alignment);
+    const std::size_t page_bytes = static_cast<std::size_t>(m_atlas.page_width())
+                                   * static_cast<std::size_t>(m_atlas.page_height());
+    const auto page_count = static_cast<std::size_t>(m_atlas.page_count());
+
+    std::vector<std::uint8_t> out(page_offset + page_bytes * page_count, 0);
+
+    snapshot_header header{};
+    std::memcpy(header.magic, snapshot_magic, sizeof(header.magic));
+    header.version = snapshot_version;
+    header.header_size = sizeof(snapshot_header);
+    header.font_key = m_font->identity();
+    header.page_width = static_cast<std::uint32_t>(m_atlas.page_width());
+    header.page_height = static_cast<std::uint32_t>(m_atlas.page_height());
+    header.page_count = static_cast<std::uint32_t>(page_count);
+    header.glyph_count = static_cast<std::uint32_t>(glyph_total);
+    header.glyph_offset = sizeof(snapshot_header);
+    header.page_offset = page_offset;
+    std::memcpy(out.data(), &header, sizeof(header));
+
+    // Sorted by (size, style, codepoint) so identical caches produce identical files
+    std::vector<snapshot_glyph> records;
+    records.reserve(glyph_total);
+    for (const auto& [key, set] : m_sets) {
+        for (const auto& [codepoint, glyph] : set.glyphs) {
+            records.push_back(snapshot_glyph{
+                static_cast<std::uint32_t>(codepoint),
+                glyph.slot.page, glyph.slot.x, glyph.slot.y,
+                glyph.slot.width, glyph.slot.height,
+                glyph.offset_x, glyph.offset_y, glyph.advance,
+                quantize_size(set.size), static_cast<std::uint32_t>(set.style)});
+        }
+    }
+    std::sort(records.begin(), records.end(), [](const snapshot_glyph& a, const snapshot_glyph& b) {
+        if (a.size_q != b.size_q) return a.size_q < b.size_q;
+        if (a.style != b.style) return a.style < b.style;
+        return a.codepoint < b.codepoint;
+    });
+    if (!records.empty()) {
+        std::memcpy(out.data() + header.glyph_offset, records.data(), glyph_bytes);
+    }
+
+    for (std::size_t page = 0; page < page_count; ++page) {
+        std::memcpy(out.data() + page_offset + page * page_bytes,
+                    m_atlas.page_pixels(static_cast<int>(page)), page_bytes);
+    }
+
+    return out;
+}
+
+expected<void, std::string> font_cache::save_snapshot(const std::filesystem::path& path) const {
+    const auto data = save_snapshot();
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return make_unexpectedf("Failed to open snapshot for writing:", path.string());
+    }
+
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    if (!file) {
+        return make_unexpectedf("Failed to write snapshot:", path.string());
+    }
+
+    return {};
+}
+
+expected<void, std::string> font_cache::load_snapshot(std::span<const std::uint8_t> data) {
+    if constexpr (std::endian::native != std::endian::little) {
+        return make_unexpectedf("Font cache snapshots require a little-endian host");
+    }
+
+    if (data.size() < sizeof(snapshot_header)) {
+        return make_unexpectedf("Snapshot is truncated");
+    }
+
+    snapshot_header header{};
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, snapshot_magic, sizeof(header.magic)) != 0) {
+        return make_unexpectedf("Not a font cache snapshot");
+    }
+    if (header.version != snapshot_version || header.header_size != sizeof(snapshot_header)) {
+        return make_unexpectedf("Unsupported snapshot version:", header.version);
+    }
+    if (header.font_key != m_font->identity()) {
+        return make_unexpectedf("Snapshot was built for a different font");
+    }
+    if (header.page_width == 0 || header.page_height == 0
+        || header.page_width > 16384 || header.page_height > 16384) {
+        return make_unexpectedf("Invalid snapshot page size:", header.page_width, "x", header.page_height);
+    }
+
+    const std::size_t page_bytes = static_cast<std::size_t>(header.page_width)
+                                   * static_cast<std::size_t>(header.page_height);
+    const std::size_t glyph_bytes = static_cast<std::size_t>(header.glyph_count) * sizeof(snapshot_glyph);
+    if (header.glyph_offset > data.size() || glyph_bytes > data.size() - header.glyph_offset
+        || header.page_offset > data.size()
+        || page_bytes * header.page_count > data.size() - header.page_offset) {
+        return make_unexpectedf("Snapshot is truncated");
+    }
+
+    // Build the new state aside so a bad file leaves the cache untouched
+    glyph_atlas atlas(static_cast<int>(header.page_width), static_cast<int>(header.page_height));
+    for (std::uint32_t page = 0; page < header.page_count; ++page) {
+        atlas.append_page(data.data() + header.page_offset + page * page_bytes);
+    }
+
+    std::unordered_map<std::uint64_t, glyph_set> sets;
+    for (std::uint32_t i = 0; i < header.glyph_count; ++i) {
+        snapshot_glyph record{};
+        std::memcpy(&record, data.data() + header.glyph_offset + i * sizeof(snapshot_glyph), sizeof(record));
+
+        const bool in_bounds = record.page >= 0
+            && static_cast<std::uint32_t>(record.page) < header.page_count
+            && record.x >= 0 && record.y >= 0 && record.width > 0 && record.height > 0
+            && static_cast<std::int64_t>(record.x) + record.width <= static_cast<std::int64_t>(header.page_width)
+            && static_cast<std::int64_t>(record.y) + record.height <= static_cast<std::int64_t>(header.page_height);
+        if (!in_bounds || record.size_q == 0) {
+            return make_unexpectedf("Snapshot glyph out of bounds:", record.codepoint);
+        }
+
+        glyph_data glyph;
+        glyph.slot = atlas_slot{record.page, record.x, record.y, record.width, record.height};
+        glyph.offset_x = record.offset_x;
+        glyph.offset_y = record.offset_y;
+        glyph.advance = record.advance;
+        glyph.width = record.width;
+        glyph.height = record.height;
+
+        const float size = static_cast<float>(record.size_q) / size_scale;
+        const auto style = static_cast<text_style>(record.style);
+        auto [it, inserted] = sets.try_emplace(set_key(size, style));
+        if (inserted) {
+            it->second.size = size;
+            it->second.style = style;
+            font_state_scope scope(*m_font, size, style);
+            it->second.line_height = static_cast<int>(std::ceil(m_font->line_height()));
+        }
+        it->second.glyphs[static_cast<char32_t>(record.codepoint)] = glyph;
+    }
+
+    m_atlas = std::move(atlas);
+    m_pages.clear();
+    m_sets = std::move(sets);
+
+    for (int page = 0; page < m_atlas.page_count(); ++page) {
+        if (!page_texture(page)) {
+            return make_unexpectedf("Failed to upload atlas page", page);
+        }
+    }
+
+    return {};
+}
+
+expected<void, std::string> font_cache::load_snapshot(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return make_unexpectedf("Failed to open snapshot:", path.string());
+    }
+
+    const auto size = file.tellg();
+    file.seekg(0);
+
+    std::vector<std::uint8_t> data(static_cast<std::size_t>(size));
+    if (!file.read(reinterpret_cast<char*>(data.data()), size)) {
+        return make_unexpectedf("Failed to read snapshot:", path.string());
+    }
+
+    return load_snapshot(std::span<const std::uint8_t>(data));
+}
+
 // ============================================================================
 // Cache Management
 // ============================================================================
 
+std::size_t font_cache::glyph_count() const noexcept {
+    std::size_t total = 0;
+    for (const auto& [key, set] : m_sets) {
+        total += set.glyphs.size();
+    }
+    return total;
+}
+
+std::vector<glyph_set_stats> font_cache::statistics() const {
+    std::vector<glyph_set_stats> out;
+    out.reserve(m_sets.size());
+    for (const auto& [key, set] : m_sets) {
+        out.push_back(glyph_set_stats{set.size, set.style, set.glyphs.size(), set.hits, set.misses});
+    }
+    std::sort(out.begin(), out.end(), [](const glyph_set_stats& a, const glyph_set_stats& b) {
+        return a.size != b.size ? a.size < b.size
+                                : static_cast<unsigned>(a.style) < static_cast<unsigned>(b.style);
+    });
+    return out;
+}
+
+void font_cache::reset_statistics() noexcept {
+    for (auto& [key, set] : m_sets) {
+        set.hits = 0;
+        set.misses = 0;
+    }
+}
+
 void font_cache::clear_glyphs() {
-    m_glyphs.clear();
+    m_sets.clear();
+    m_pages.clear();
+    m_atlas.clear();
 }
 
 void font_cache::clear_strings() {
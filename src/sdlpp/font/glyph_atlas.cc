@@ -0,0 +1,170 @@
+//
+// Glyph atlas for SDL++ - implementation
+//
+
+#include <sdlpp/font/glyph_atlas.hh>
+
+#include <algorithm>
+#include <cstring>
+
+namespace sdlpp::font {
+
+glyph_atlas::glyph_atlas(int page_width, int page_height, int padding)
+    : m_page_width(std::max(page_width, 1))
+    , m_page_height(std::max(page_height, 1))
+    , m_padding(std::max(padding, 0)) {}
+
+// ============================================================================
+// Packing
+// ============================================================================
+
+void glyph_atlas::add_page() {
+    page_data pg;
+    pg.pixels.assign(static_cast<std::size_t>(m_page_width) * static_cast<std::size_t>(m_page_height), 0);
+    pg.revision = ++m_revision;
+    m_pages.push_back(std::move(pg));
+}
+
+atlas_slot glyph_atlas::allocate(int width, int height) {
+    if (width <= 0 || height <= 0) {
+        return {};
+    }
+
+    if (width + 2 * m_padding > m_page_width || height + 2 * m_padding > m_page_height) {
+        return {};  // Never fits
+    }
+
+    if (m_pages.empty()) {
+        add_page();
+    }
+
+    page_data* pg = &m_pages.back();
+
+    // Close the shelf when the row is full
+    if (pg->cursor_x + m_padding + width + m_padding > m_page_width) {
+        pg->shelf_y += pg->shelf_height;
+        pg->shelf_height = 0;
+        pg->cursor_x = 0;
+    }
+
+    // Open a new page when the shelf would run off the bottom
+    if (pg->shelf_y + m_padding + height + m_padding > m_page_height) {
+        add_page();
+        pg = &m_pages.back();
+    }
+
+    atlas_slot slot;
+    slot.page = page_count() - 1;
+    slot.x = pg->cursor_x + m_padding;
+    slot.y = pg->shelf_y + m_padding;
+    slot.width = width;
+    slot.height = height;
+
+    pg->cursor_x += m_padding + width;
+    pg->shelf_height = std::max(pg->shelf_height, m_padding + height);
+
+    return slot;
+}
+
+void glyph_atlas::write(const atlas_slot& slot, const std::uint8_t* src, int src_pitch) {
+    if (!slot.valid() || slot.page >= page_count() || !src) {
+        return;
+    }
+
+    auto& pg = m_pages[static_cast<std::size_t>(slot.page)];
+    for (int row = 0; row < slot.height; ++row) {
+        std::memcpy(pg.pixels.data() + static_cast<std::size_t>(slot.y + row) * static_cast<std::size_t>(m_page_width)
+                        + static_cast<std::size_t>(slot.x),
+                    src + static_cast<std::size_t>(row) * static_cast<std::size_t>(src_pitch),
+                    static_cast<std::size_t>(slot.width));
+    }
+    pg.revision = ++m_revision;
+}
+
+int glyph_atlas::append_page(const std::uint8_t* pixels) {
+    add_page();
+    auto& pg = m_pages.back();
+    if (pixels) {
+        std::memcpy(pg.pixels.data(), pixels, pg.pixels.size());
+    }
+    // Mark as full so new slots go to a fresh page
+    pg.shelf_y = m_page_height;
+    return page_count() - 1;
+}
+
+void glyph_atlas::clear() {
+    m_pages.clear();
+}
+
+// ============================================================================
+// Page Access
+// ============================================================================
+
+const std::uint8_t* glyph_atlas::page_pixels(int page) const {
+    if (page < 0 || page >= page_count()) {
+        return nullptr;
+    }
+    return m_pages[static_cast<std::size_t>(page)].pixels.data();
+}
+
+std::uint64_t glyph_atlas::page_revision(int page) const {
+    if (page < 0 || page >= page_count()) {
+        return 0;
+    }
+    return m_pages[static_cast<std::size_t>(page)].revision;
+}
+
+// ============================================================================
+// Texture Upload
+// ============================================================================
+
+expected<texture, std::string> glyph_atlas::make_texture(
+    renderer& renderer, int page, const alpha_lut* lut) const {
+    if (page < 0 || page >= page_count()) {
+        return make_unexpectedf("Invalid atlas page", page);
+    }
+
+    // ABGR8888 stores bytes as R,G,B,A on little-endian, matching the upload buffer
+    auto tex = texture::create(renderer, pixel_format_enum::ABGR8888,
+                               texture_access::static_access,
+                               m_page_width, m_page_height);
+    if (!tex) {
+        return make_unexpectedf(tex.error());
+    }
+
+    tex->set_blend_mode(blend_mode::blend);
+    tex->set_scale_mode(scale_mode::linear);
+
+    auto uploaded = upload(*tex, page, lut);
+    if (!uploaded) {
+        return make_unexpectedf(uploaded.error());
+    }
+
+    return std::move(*tex);
+}
+
+expected<void, std::string> glyph_atlas::upload(
+    texture& tex, int page, const alpha_lut* lut) const {
+    const std::uint8_t* src = page_pixels(page);
+    if (!src) {
+        return make_unexpectedf("Invalid atlas page", page);
+    }
+
+    // Expand to white texels so color/alpha modulation tints the glyphs
+    const std::size_t count = static_cast<std::size_t>(m_page_width) * static_cast<std::size_t>(m_page_height);
+    m_upload.resize(count * 4);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint8_t* dst = m_upload.data() + i * 4;
+        dst[0] = 255;
+        dst[1] = 255;
+        dst[2] = 255;
+        dst[3] = lut ? (*lut)[src[i]] : src[i];
+    }
+
+    if (auto r = tex.update(std::optional<rect<int>>{}, m_upload.data(), m_page_width * 4); !r) {
+        return make_unexpectedf(r.error());
+    }
+    return {};
+}
+
+} // namespace sdlpp::font
@@ -0,0 +1,445 @@
+//
+// Signed distance field glyph cache for SDL++ - implementation
+//
+
+#include <sdlpp/font/sdf_font_cache.hh>
+#include <sdlpp/font/font.hh>
+#include <sdlpp/font/sdl_raster_target.hh>
+
+#include <onyx_font/text/utf8.hh>
+#include <algorithm>
+#include <cmath>
+
+namespace sdlpp::font {
+
+namespace {
+
+// Zoom bands are half an octave wide
+constexpr int min_band = -10;
+constexpr int max_band = 6;
+
+int band_for_scale(float scale) {
+    int band = static_cast<int>(std::lround(std::log2(scale) * 2.0f));
+    return std::clamp(band, min_band, max_band);
+}
+
+float scale_for_band(int band) {
+    return std::exp2(static_cast<float>(band) * 0.5f);
+}
+
+// Temporarily switch a scalable font to the reference size
+class size_scope {
+public:
+    size_scope(font& fnt, float size)
+        : m_font(fnt)
+        , m_saved(fnt.size())
+        , m_active(fnt.is_scalable() && fnt.size() != size) {
+        if (m_active) m_font.set_size(size);
+    }
+
+    ~size_scope() {
+        if (m_active) m_font.set_size(m_saved);
+    }
+
+    size_scope(const size_scope&) = delete;
+    size_scope& operator=(const size_scope&) = delete;
+
+private:
+    font& m_font;
+    float m_saved;
+    bool m_active;
+};
+
+constexpr float edt_inf = 1e20f;
+
+// 1D squared Euclidean distance transform (Felzenszwalb & Huttenlocher)
+void edt_1d(const float* f, float* d, int* v, float* z, int n) {
+    auto intersect = [f](int q, int p) {
+        return ((f[q] + static_cast<float>(q * q)) - (f[p] + static_cast<float>(p * p)))
+               / static_cast<float>(2 * q - 2 * p);
+    };
+
+    int k = 0;
+    v[0] = 0;
+    z[0] = -edt_inf;
+    z[1] = edt_inf;
+
+    for (int q = 1; q < n; ++q) {
+        float s = intersect(q, v[k]);
+        while (s <= z[k]) {
+            --k;
+            s = intersect(q, v[k]);
+        }
+        ++k;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = edt_inf;
+    }
+
+    k = 0;
+    for (int q = 0; q < n; ++q) {
+        while (z[k + 1] < static_cast<float>(q)) ++k;
+        const int p = v[k];
+        d[q] = static_cast<float>((q - p) * (q - p)) + f[p];
+    }
+}
+
+// 2D squared distance to the nearest feature cell (grid holds 0 for features, inf elsewhere)
+void edt_2d(std::vector<float>& grid, int width, int height) {
+    const int n = std::max(width, height);
+    std::vector<float> f(static_cast<std::size_t>(n));
+    std::vector<float> d(static_cast<std::size_t>(n));
+    std::vector<int> v(static_cast<std::size_t>(n));
+    std::vector<float> z(static_cast<std::size_t>(n) + 1);
+
+    for (int x = 0; x < width; ++x) {
+        for (int y = 0; y < height; ++y) f[static_cast<std::size_t>(y)] = grid[static_cast<std::size_t>(y * width + x)];
+        edt_1d(f.data(), d.data(), v.data(), z.data(), height);
+        for (int y = 0; y < height; ++y) grid[static_cast<std::size_t>(y * width + x)] = d[static_cast<std::size_t>(y)];
+    }
+
+    for (int y = 0; y < height; ++y) {
+        float* row = grid.data() + static_cast<std::size_t>(y * width);
+        std::copy(row, row + width, f.begin());
+        edt_1d(f.data(), d.data(), v.data(), z.data(), width);
+        std::copy(d.begin(), d.begin() + width, row);
+    }
+}
+
+// Encode signed distance (positive inside) so that 128 sits on the edge
+std::uint8_t encode_distance(float distance, int spread) {
+    const float v = 128.0f + distance * (127.0f / static_cast<float>(spread));
+    return static_cast<std::uint8_t>(std::clamp(v, 0.0f, 255.0f));
+}
+
+float decode_distance(float value, int spread) {
+    return (value - 128.0f) * (static_cast<float>(spread) / 127.0f);
+}
+
+// Coverage at `scale` for a signed distance in reference pixels (one screen pixel ramp)
+float threshold(float distance, float scale) {
+    return std::clamp(0.5f + distance * scale, 0.0f, 1.0f);
+}
+
+glyph_atlas::alpha_lut make_threshold_lut(float scale, int spread) {
+    glyph_atlas::alpha_lut lut{};
+    for (int i = 0; i < 256; ++i) {
+        const float a = threshold(decode_distance(static_cast<float>(i), spread), scale);
+        lut[static_cast<std::size_t>(i)] = static_cast<std::uint8_t>(std::lround(a * 255.0f));
+    }
+    return lut;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Constructor / Destructor
+// ============================================================================
+
+sdf_font_cache::sdf_font_cache(renderer& renderer, font& fnt, float reference_size, int spread)
+    : m_renderer(&renderer)
+    , m_font(&fnt)
+    , m_reference_size(reference_size > 0.0f ? reference_size : default_reference_size)
+    , m_spread(std::max(spread, 1)) {
+    if (!fnt.is_scalable() && fnt.native_size() > 0.0f) {
+        m_reference_size = fnt.native_size();
+    }
+
+    size_scope scope(fnt, m_reference_size);
+    if (auto* rast = fnt.rasterizer()) {
+        auto metrics = rast->get_metrics();
+        m_ascent = metrics.ascent;
+        m_line_height = metrics.line_height;
+    }
+}
+
+sdf_font_cache::~sdf_font_cache() = default;
+
+sdf_font_cache::sdf_font_cache(sdf_font_cache&&) noexcept = default;
+sdf_font_cache& sdf_font_cache::operator=(sdf_font_cache&&) noexcept = default;
+
+// ============================================================================
+// Glyph Caching
+// ============================================================================
+
+bool sdf_font_cache::store_glyph(char32_t codepoint) {
+    if (m_glyphs.contains(codepoint)) {
+        return true;  // Already cached
+    }
+
+    size_scope scope(*m_font, m_reference_size);
+
+    auto* rast = m_font->rasterizer();
+    if (!rast) return false;
+
+    auto metrics = rast->measure_glyph(codepoint);
+    if (metrics.advance_x <= 0) {
+        return false;  // Invalid glyph
+    }
+
+    sdf_glyph glyph;
+    glyph.advance = metrics.advance_x;
+
+    // Whitespace has no field, only an advance
+    if (metrics.width <= 0 || metrics.height <= 0) {
+        m_glyphs[codepoint] = glyph;
+        return true;
+    }
+
+    // Field box: glyph bounds plus the spread on every side
+    const int margin = m_spread + 1;
+    const int width = static_cast<int>(std::ceil(metrics.width)) + 2 * margin;
+    const int height = static_cast<int>(std::ceil(metrics.height)) + 2 * margin;
+    const int pen_x = margin - static_cast<int>(std::floor(metrics.bearing_x));
+    const int baseline = margin + static_cast<int>(std::ceil(metrics.bearing_y));
+
+    const auto count = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+    std::vector<std::uint8_t> coverage(count, 0);
+    coverage_raster_target target(coverage.data(), width, height);
+    rast->rasterize_glyph(codepoint, target, pen_x, baseline);
+
+    // Distances to the nearest inside and outside texel
+    std::vector<float> to_inside(count);
+    std::vector<float> to_outside(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const bool inside = coverage[i] >= 128;
+        to_inside[i] = inside ? 0.0f : edt_inf;
+        to_outside[i] = inside ? edt_inf : 0.0f;
+    }
+    edt_2d(to_inside, width, height);
+    edt_2d(to_outside, width, height);
+
+    std::vector<std::uint8_t> field(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        // Edge lies half a texel between an inside and an outside texel
+        const float distance = coverage[i] >= 128
+            ? std::sqrt(to_outside[i]) - 0.5f
+            : 0.5f - std::sqrt(to_inside[i]);
+        field[i] = encode_distance(distance, m_spread);
+    }
+
+    glyph.slot = m_atlas.allocate(width, height);
+    if (!glyph.slot.valid()) {
+        return false;
+    }
+    m_atlas.write(glyph.slot, field.data(), width);
+
+    glyph.left = static_cast<float>(-pen_x);
+    glyph.top = std::ceil(m_ascent) + 1.0f - static_cast<float>(baseline);
+
+    m_glyphs[codepoint] = glyph;
+    return true;
+}
+
+void sdf_font_cache::store_glyphs(char32_t begin, char32_t end) {
+    for (char32_t cp = begin; cp < end; ++cp) {
+        store_glyph(cp);
+    }
+}
+
+const sdf_glyph* sdf_font_cache::find_glyph(char32_t codepoint) const {
+    auto it = m_glyphs.find(codepoint);
+    return it != m_glyphs.end() ? &it->second : nullptr;
+}
+
+const sdf_glyph* sdf_font_cache::ensure_glyph(char32_t codepoint) {
+    if (const sdf_glyph* glyph = find_glyph(codepoint)) {
+        return glyph;
+    }
+    if (!store_glyph(codepoint)) {
+        return nullptr;
+    }
+    return find_glyph(codepoint);
+}
+
+// ============================================================================
+// Rendering
+// ============================================================================
+
+texture* sdf_font_cache::page_texture(int page, float scale) {
+    const int band = band_for_scale(scale);
+    auto& pages = m_bands[band];
+    if (pages.size() < static_cast<std::size_t>(m_atlas.page_count())) {
+        pages.resize(static_cast<std::size_t>(m_atlas.page_count()));
+    }
+
+    auto& entry = pages[static_cast<std::size_t>(page)];
+    const std::uint64_t revision = m_atlas.page_revision(page);
+    if (entry.tex && entry.revision == revision) {
+        return &entry.tex;
+    }
+
+    const auto lut = make_threshold_lut(scale_for_band(band), m_spread);
+    if (entry.tex) {
+        if (!m_atlas.upload(entry.tex, page, &lut)) return nullptr;
+    } else {
+        auto tex = m_atlas.make_texture(*m_renderer, page, &lut);
+        if (!tex) return nullptr;
+        entry.tex = std::move(*tex);
+    }
+    entry.revision = revision;
+    return &entry.tex;
+}
+
+void sdf_font_cache::flush_quads(texture* tex) {
+    if (tex && !m_vertices.empty()) {
+        m_renderer->render_geometry(tex->get(), m_vertices, m_indices);
+    }
+    m_vertices.clear();
+    m_indices.clear();
+}
+
+float sdf_font_cache::render_text(std::string_view text, float x, float y,
+                                  float size, const color& fg) {
+    const float scale = size / m_reference_size;
+    if (!(scale > 0.0f)) return 0.0f;
+
+    // Cache everything first so page textures are uploaded once per call
+    for (char32_t codepoint : onyx_font::utf8_view(text)) {
+        ensure_glyph(codepoint);
+    }
+
+    const float inv_w = 1.0f / static_cast<float>(m_atlas.page_width());
+    const float inv_h = 1.0f / static_cast<float>(m_atlas.page_height());
+
+    int current_page = -1;
+    float pen_x = x;
+    m_vertices.clear();
+    m_indices.clear();
+
+    for (char32_t codepoint : onyx_font::utf8_view(text)) {
+        const sdf_glyph* glyph = find_glyph(codepoint);
+        if (!glyph) continue;
+
+        if (glyph->slot.valid()) {
+            if (glyph->slot.page != current_page) {
+                flush_quads(current_page >= 0 ? page_texture(current_page, scale) : nullptr);
+                current_page = glyph->slot.page;
+            }
+
+            const float x0 = pen_x + glyph->left * scale;
+            const float y0 = y + glyph->top * scale;
+            const float x1 = x0 + static_cast<float>(glyph->slot.width) * scale;
+            const float y1 = y0 + static_cast<float>(glyph->slot.height) * scale;
+
+            const float u0 = static_cast<float>(glyph->slot.x) * inv_w;
+            const float v0 = static_cast<float>(glyph->slot.y) * inv_h;
+            const float u1 = static_cast<float>(glyph->slot.x + glyph->slot.width) * inv_w;
+            const float v1 = static_cast<float>(glyph->slot.y + glyph->slot.height) * inv_h;
+
+            const int base = static_cast<int>(m_vertices.size());
+            m_vertices.push_back(renderer::make_vertex(point<float>{x0, y0}, fg, point<float>{u0, v0}));
+            m_vertices.push_back(renderer::make_vertex(point<float>{x1, y0}, fg, point<float>{u1, v0}));
+            m_vertices.push_back(renderer::make_vertex(point<float>{x1, y1}, fg, point<float>{u1, v1}));
+            m_vertices.push_back(renderer::make_vertex(point<float>{x0, y1}, fg, point<float>{u0, v1}));
+            m_indices.insert(m_indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+
+        pen_x += glyph->advance * scale;
+    }
+
+    flush_quads(current_page >= 0 ? page_texture(current_page, scale) : nullptr);
+
+    return pen_x - x;
+}
+
+float sdf_font_cache::render_text(surface_renderer& target, std::string_view text,
+                                  int x, int y, float size, const color& fg) {
+    const float scale = size / m_reference_size;
+    if (!(scale > 0.0f)) return 0.0f;
+
+    auto saved_color = target.get_draw_color();
+    target.set_draw_color(fg);
+
+    float pen_x = static_cast<float>(x);
+
+    for (char32_t codepoint : onyx_font::utf8_view(text)) {
+        const sdf_glyph* glyph = ensure_glyph(codepoint);
+        if (!glyph) continue;
+
+        if (glyph->slot.valid()) {
+            const auto& slot = glyph->slot;
+            const std::uint8_t* page = m_atlas.page_pixels(slot.page);
+            const int pitch = m_atlas.pitch();
+
+            const float gx = pen_x + glyph->left * scale;
+            const float gy = static_cast<float>(y) + glyph->top * scale;
+            const int ix0 = static_cast<int>(std::floor(gx));
+            const int iy0 = static_cast<int>(std::floor(gy));
+            const int mw = static_cast<int>(std::ceil(gx + static_cast<float>(slot.width) * scale)) - ix0;
+            const int mh = static_cast<int>(std::ceil(gy + static_cast<float>(slot.height) * scale)) - iy0;
+
+            if (page && mw > 0 && mh > 0) {
+                m_mask.assign(static_cast<std::size_t>(mw) * static_cast<std::size_t>(mh), 0);
+
+                // Texel fetch clamped to the slot; outside reads as far outside
+                auto fetch = [&](int tx, int ty) -> float {
+                    if (tx < 0 || ty < 0 || tx >= slot.width || ty >= slot.height) return 0.0f;
+                    return static_cast<float>(page[(slot.y + ty) * pitch + slot.x + tx]);
+                };
+
+                for (int my = 0; my < mh; ++my) {
+                    const float v = (static_cast<float>(iy0 + my) + 0.5f - gy) / scale - 0.5f;
+                    const int ty = static_cast<int>(std::floor(v));
+                    const float fy = v - static_cast<float>(ty);
+                    for (int mx = 0; mx < mw; ++mx) {
+                        const float u = (static_cast<float>(ix0 + mx) + 0.5f - gx) / scale - 0.5f;
+                        const int tx = static_cast<int>(std::floor(u));
+                        const float fx = u - static_cast<float>(tx);
+
+                        const float top = fetch(tx, ty) + (fetch(tx + 1, ty) - fetch(tx, ty)) * fx;
+                        const float bottom = fetch(tx, ty + 1) + (fetch(tx + 1, ty + 1) - fetch(tx, ty + 1)) * fx;
+                        const float value = top + (bottom - top) * fy;
+
+                        const float a = threshold(decode_distance(value, m_spread), scale);
+                        m_mask[static_cast<std::size_t>(my * mw + mx)] =
+                            static_cast<std::uint8_t>(std::lround(a * 255.0f));
+                    }
+                }
+
+                target.blend_mask(ix0, iy0, m_mask, mw, mh);
+            }
+        }
+
+        pen_x += glyph->advance * scale;
+    }
+
+    if (saved_color) {
+        target.set_draw_color(*saved_color);
+    }
+
+    return pen_x - static_cast<float>(x);
+}
+
+float sdf_font_cache::measure(std::string_view text, float size) {
+    const float scale = size / m_reference_size;
+    float width = 0.0f;
+    for (char32_t codepoint : onyx_font::utf8_view(text)) {
+        if (const sdf_glyph* glyph = ensure_glyph(codepoint)) {
+            width += glyph->advance * scale;
+        }
+    }
+    return width;
+}
+
+// ============================================================================
+// Cache Management
+// ============================================================================
+
+void sdf_font_cache::clear() {
+    m_glyphs.clear();
+    m_bands.clear();
+    m_atlas.clear();
+}
+
+std::size_t sdf_font_cache::texture_count() const noexcept {
+    std::size_t count = 0;
+    for (const auto& [band, pages] : m_bands) {
+        for (const auto& entry : pages) {
+            if (entry.tex) ++count;
+        }
+    }
+    return count;
+}
+
+} // namespace sdlpp::font
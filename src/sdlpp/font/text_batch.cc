@@ -0,0 +1,159 @@
+//
+// Frame-level text batching for SDL++ - implementation
+//
+
+#include <sdlpp/font/text_batch.hh>
+
+#include <onyx_font/text/utf8.hh>
+#include <algorithm>
+
+namespace sdlpp::font {
+
+text_batch::text_batch(font_cache& cache)
+    : m_cache(&cache) {}
+
+text_batch::~text_batch() = default;
+
+text_batch::text_batch(text_batch&&) noexcept = default;
+text_batch& text_batch::operator=(text_batch&&) noexcept = default;
+
+// ============================================================================
+// Queueing
+// ============================================================================
+
+int text_batch::add(std::string_view text, int x, int y, const color& fg,
+                    const std::optional<rect<int>>& clip) {
+    return add(text, x, y, fg, m_cache->get_font().size(), clip);
+}
+
+int text_batch::add(std::string_view text, int x, int y, const color& fg, float size,
+                    const std::optional<rect<int>>& clip) {
+    const auto& atlas = m_cache->atlas();
+    const text_style style = m_cache->get_font().style();
+    int pen_x = x;
+
+    for (char32_t codepoint : onyx_font::utf8_view(text)) {
+        const glyph_data* glyph = m_cache->get_glyph(codepoint, size, style);
+        if (!glyph) continue;
+
+        quad q{};
+        q.x0 = static_cast<float>(pen_x + glyph->offset_x);
+        q.y0 = static_cast<float>(y + glyph->offset_y);
+        q.x1 = q.x0 + static_cast<float>(glyph->width);
+        q.y1 = q.y0 + static_cast<float>(glyph->height);
+
+        const float inv_w = 1.0f / static_cast<float>(atlas.page_width());
+        const float inv_h = 1.0f / static_cast<float>(atlas.page_height());
+        q.u0 = static_cast<float>(glyph->slot.x) * inv_w;
+        q.v0 = static_cast<float>(glyph->slot.y) * inv_h;
+        q.u1 = static_cast<float>(glyph->slot.x + glyph->slot.width) * inv_w;
+        q.v1 = static_cast<float>(glyph->slot.y + glyph->slot.height) * inv_h;
+        q.fg = fg;
+
+        pen_x += glyph->advance;
+
+        if (clip) {
+            const auto cx0 = static_cast<float>(clip->x);
+            const auto cy0 = static_cast<float>(clip->y);
+            const auto cx1 = static_cast<float>(clip->x + clip->w);
+            const auto cy1 = static_cast<float>(clip->y + clip->h);
+
+            if (q.x1 <= cx0 || q.x0 >= cx1 || q.y1 <= cy0 || q.y0 >= cy1) {
+                continue;  // Fully clipped
+            }
+
+            // Trim the quad and its texture coordinates proportionally
+            const float du = (q.u1 - q.u0) / (q.x1 - q.x0);
+            const float dv = (q.v1 - q.v0) / (q.y1 - q.y0);
+            if (q.x0 < cx0) { q.u0 += (cx0 - q.x0) * du; q.x0 = cx0; }
+            if (q.x1 > cx1) { q.u1 -= (q.x1 - cx1) * du; q.x1 = cx1; }
+            if (q.y0 < cy0) { q.v0 += (cy0 - q.y0) * dv; q.y0 = cy0; }
+            if (q.y1 > cy1) { q.v1 -= (q.y1 - cy1) * dv; q.y1 = cy1; }
+        }
+
+        const auto page = static_cast<std::size_t>(glyph->slot.page);
+        if (m_pages.size() <= page) {
+            m_pages.resize(page + 1);
+        }
+        m_pages[page].push_back(q);
+        ++m_quad_count;
+    }
+
+    ++m_entry_count;
+    return pen_x - x;
+}
+
+// ============================================================================
+// Submission
+// ============================================================================
+
+expected<void, std::string> text_batch::flush() {
+    m_last_draw_calls = 0;
+
+    if (m_quad_count == 0) {
+        clear();
+        return {};
+    }
+
+    // Shared index pattern; only ever grows
+    std::size_t max_quads = 0;
+    for (const auto& quads : m_pages) {
+        max_quads = std::max(max_quads, quads.size());
+    }
+    const std::size_t have_quads = m_indices.size() / 6;
+    if (have_quads < max_quads) {
+        m_indices.reserve(max_quads * 6);
+        for (std::size_t i = have_quads; i < max_quads; ++i) {
+            const int base = static_cast<int>(i * 4);
+            m_indices.insert(m_indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+    }
+
+    auto& rend = m_cache->get_renderer();
+    expected<void, std::string> status;
+
+    for (std::size_t page = 0; page < m_pages.size(); ++page) {
+        auto& quads = m_pages[page];
+        if (quads.empty()) continue;
+
+        texture* tex = m_cache->page_texture(static_cast<int>(page));
+        if (!tex) {
+            status = make_unexpectedf("Failed to prepare atlas page", page);
+            continue;
+        }
+
+        // Vertex colors carry the text color; undo any render_glyph() modulation
+        tex->set_color_mod(colors::white);
+        tex->set_alpha_mod(255);
+
+        m_vertices.clear();
+        for (const auto& q : quads) {
+            m_vertices.push_back(renderer::make_vertex(point<float>{q.x0, q.y0}, q.fg, point<float>{q.u0, q.v0}));
+            m_vertices.push_back(renderer::make_vertex(point<float>{q.x1, q.y0}, q.fg, point<float>{q.u1, q.v0}));
+            m_vertices.push_back(renderer::make_vertex(point<float>{q.x1, q.y1}, q.fg, point<float>{q.u1, q.v1}));
+            m_vertices.push_back(renderer::make_vertex(point<float>{q.x0, q.y1}, q.fg, point<float>{q.u0, q.v1}));
+        }
+
+        auto result = rend.render_geometry(
+            tex->get(),
+            std::span<const SDL_Vertex>(m_vertices),
+            std::span<const int>(m_indices.data(), quads.size() * 6));
+        if (!result) {
+            status = make_unexpectedf(result.error());
+        }
+        ++m_last_draw_calls;
+    }
+
+    clear();
+    return status;
+}
+
+void text_batch::clear() {
+    for (auto& quads : m_pages) {
+        quads.clear();
+    }
+    m_entry_count = 0;
+    m_quad_count = 0;
+}
+
+} // namespace sdlpp::font
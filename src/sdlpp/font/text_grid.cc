@@ -0,0 +1,378 @@
+//
+// Fixed-grid text renderer for SDL++ - implementation
+//
+
+#include <sdlpp/font/text_grid.hh>
+
+#include <onyx_font/text/utf8.hh>
+#include <algorithm>
+
+namespace sdlpp::font {
+
+// ============================================================================
+// Constructor / Destructor
+// ============================================================================
+
+text_grid::text_grid(font_cache& cache, int columns, int rows)
+    : m_cache(&cache)
+    , m_columns(std::max(columns, 0))
+    , m_rows(std::max(rows, 0)) {
+    if (cache.store_glyph(U'M')) {
+        m_cell_width = cache.find_glyph(U'M')->advance;
+    }
+    m_cell_height = cache.line_height();
+
+    m_cells.assign(static_cast<std::size_t>(m_columns) * static_cast<std::size_t>(m_rows), grid_cell{});
+    mark_all_dirty();
+}
+
+text_grid::~text_grid() = default;
+
+text_grid::text_grid(text_grid&&) noexcept = default;
+text_grid& text_grid::operator=(text_grid&&) noexcept = default;
+
+// ============================================================================
+// Geometry
+// ============================================================================
+
+void text_grid::resize(int columns, int rows) {
+    columns = std::max(columns, 0);
+    rows = std::max(rows, 0);
+    if (columns == m_columns && rows == m_rows) {
+        return;
+    }
+
+    std::vector<grid_cell> cells(static_cast<std::size_t>(columns) * static_cast<std::size_t>(rows), grid_cell{});
+    const int keep_columns = std::min(columns, m_columns);
+    const int keep_rows = std::min(rows, m_rows);
+    for (int row = 0; row < keep_rows; ++row) {
+        std::copy_n(m_cells.begin() + static_cast<std::ptrdiff_t>(index(0, row)), keep_columns,
+                    cells.begin() + static_cast<std::ptrdiff_t>(row) * columns);
+    }
+
+    m_cells = std::move(cells);
+    m_columns = columns;
+    m_rows = rows;
+    m_top = 0;
+    m_target = texture();  // Size changed; recreated on next update
+    mark_all_dirty();
+}
+
+// ============================================================================
+// Cell Access
+// ============================================================================
+
+void text_grid::assign(std::size_t idx, const grid_cell& cell) {
+    if (m_cells[idx] == cell) {
+        return;  // Unchanged cells stay clean
+    }
+    m_cells[idx] = cell;
+    if (!m_dirty[idx]) {
+        m_dirty[idx] = 1;
+        m_dirty_rows[idx / static_cast<std::size_t>(m_columns)] = 1;
+        ++m_dirty_count;
+    }
+}
+
+void text_grid::mark_all_dirty() {
+    m_dirty.assign(m_cells.size(), 1);
+    m_dirty_rows.assign(static_cast<std::size_t>(m_rows), 1);
+    m_dirty_count = m_cells.size();
+}
+
+grid_cell text_grid::get(int column, int row) const {
+    if (column < 0 || column >= m_columns || row < 0 || row >= m_rows) {
+        return {};
+    }
+    return m_cells[index(column, row)];
+}
+
+void text_grid::set(int column, int row, const grid_cell& cell) {
+    if (column < 0 || column >= m_columns || row < 0 || row >= m_rows) {
+        return;
+    }
+    assign(index(column, row), cell);
+}
+
+int text_grid::write(int column, int row, std::string_view text,
+                     const color& fg, const color& bg, cell_attr attrs) {
+    if (row < 0 || row >= m_rows) {
+        return 0;
+    }
+
+    int col = column;
+    int written = 0;
+    grid_cell cell{U' ', fg, bg, attrs};
+    for (char32_t codepoint : onyx_font::utf8_view(text)) {
+        if (col >= m_columns) break;
+        if (col >= 0) {
+            cell.codepoint = codepoint;
+            assign(index(col, row), cell);
+            ++written;
+        }
+        ++col;
+    }
+    return written;
+}
+
+void text_grid::write_row(int row, std::span<const grid_cell> cells, int column) {
+    if (row < 0 || row >= m_rows) {
+        return;
+    }
+
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        const int col = column + static_cast<int>(i);
+        if (col >= m_columns) break;
+        if (col >= 0) {
+            assign(index(col, row), cells[i]);
+        }
+    }
+}
+
+void text_grid::fill(int column, int row, int count, const grid_cell& cell) {
+    if (row < 0 || row >= m_rows) {
+        return;
+    }
+
+    const int begin = std::max(column, 0);
+    const int end = std::min(column + count, m_columns);
+    for (int col = begin; col < end; ++col) {
+        assign(index(col, row), cell);
+    }
+}
+
+void text_grid::clear(const color& bg) {
+    const grid_cell blank{U' ', colors::white, bg, cell_attr::none};
+    for (std::size_t i = 0; i < m_cells.size(); ++i) {
+        assign(i, blank);
+    }
+}
+
+void text_grid::scroll_up(int lines, const color& bg) {
+    if (lines <= 0 || m_columns == 0 || m_rows == 0) {
+        return;
+    }
+
+    lines = std::min(lines, m_rows);
+    m_top = (m_top + lines) % m_rows;
+
+    // The old top rows become the bottom rows; assign() compares against
+    // what their storage rows still hold, which is also what the target shows
+    const grid_cell blank{U' ', colors::white, bg, cell_attr::none};
+    for (int row = m_rows - lines; row < m_rows; ++row) {
+        for (int col = 0; col < m_columns; ++col) {
+            assign(index(col, row), blank);
+        }
+    }
+}
+
+// ============================================================================
+// Rendering
+// ============================================================================
+
+void text_grid::invalidate() {
+    mark_all_dirty();
+}
+
+expected<void, std::string> text_grid::ensure_target() {
+    if (m_target) {
+        return {};
+    }
+
+    const int width = std::max(m_columns * m_cell_width, 1);
+    const int height = std::max(m_rows * m_cell_height, 1);
+
+    auto tex = texture::create(m_cache->get_renderer(), pixel_format_enum::ARGB8888,
+                               texture_access::target, width, height);
+    if (!tex) {
+        return make_unexpectedf(tex.error());
+    }
+
+    tex->set_blend_mode(blend_mode::blend);
+    m_target = std::move(*tex);
+    mark_all_dirty();
+    return {};
+}
+
+void text_grid::add_rect(std::vector<SDL_Vertex>& vertices,
+                         float x0, float y0, float x1, float y1, const color& c) {
+    vertices.push_back(renderer::make_vertex(point<float>{x0, y0}, c));
+    vertices.push_back(renderer::make_vertex(point<float>{x1, y0}, c));
+    vertices.push_back(renderer::make_vertex(point<float>{x1, y1}, c));
+    vertices.push_back(renderer::make_vertex(point<float>{x0, y1}, c));
+}
+
+expected<void, std::string> text_grid::update() {
+    m_last_redrawn = 0;
+
+    if (auto status = ensure_target(); !status) {
+        return status;
+    }
+
+    if (m_dirty_count == 0) {
+        return {};
+    }
+
+    const auto& atlas = m_cache->atlas();
+    const float cw = static_cast<float>(m_cell_width);
+    const float ch = static_cast<float>(m_cell_height);
+
+    m_fill_vertices.clear();
+    for (auto& vertices : m_glyph_vertices) {
+        vertices.clear();
+    }
+
+    m_line_vertices.clear();
+
+    for (int row = 0; row < m_rows; ++row) {
+        if (!m_dirty_rows[static_cast<std::size_t>(row)]) continue;
+        m_dirty_rows[static_cast<std::size_t>(row)] = 0;
+
+        for (int col = 0; col < m_columns; ++col) {
+            const std::size_t idx = storage_index(col, row);
+            if (!m_dirty[idx]) continue;
+            m_dirty[idx] = 0;
+            ++m_last_redrawn;
+
+            const grid_cell& cell = m_cells[idx];
+            const bool inverse = (cell.attrs & cell_attr::inverse) != cell_attr::none;
+            const color fg = inverse ? cell.bg : cell.fg;
+            const color bg = inverse ? cell.fg : cell.bg;
+
+            const float cx0 = static_cast<float>(col) * cw;
+            const float cy0 = static_cast<float>(row) * ch;
+            const float cx1 = cx0 + cw;
+            const float cy1 = cy0 + ch;
+
+            add_rect(m_fill_vertices, cx0, cy0, cx1, cy1, bg);
+
+            if ((cell.attrs & cell_attr::underline) != cell_attr::none) {
+                add_rect(m_line_vertices, cx0, cy1 - 2.0f, cx1, cy1 - 1.0f, fg);
+            }
+
+            if (cell.codepoint == U' ') continue;
+
+            const glyph_data* glyph = m_cache->get_glyph(cell.codepoint);
+            if (!glyph) continue;
+
+            const auto page = static_cast<std::size_t>(glyph->slot.page);
+            if (m_glyph_vertices.size() <= page) {
+                m_glyph_vertices.resize(page + 1);
+            }
+
+            const int passes = (cell.attrs & cell_attr::bold) != cell_attr::none ? 2 : 1;
+            for (int pass = 0; pass < passes; ++pass) {
+                // Glyph box clipped to the cell, texture coordinates trimmed to match
+                const float gx0 = cx0 + static_cast<float>(glyph->offset_x + pass);
+                const float gy0 = cy0 + static_cast<float>(glyph->offset_y);
+                const float gx1 = gx0 + static_cast<float>(glyph->width);
+                const float gy1 = gy0 + static_cast<float>(glyph->height);
+
+                const float x0 = std::max(gx0, cx0);
+                const float y0 = std::max(gy0, cy0);
+                const float x1 = std::min(gx1, cx1);
+                const float y1 = std::min(gy1, cy1);
+                if (x1 <= x0 || y1 <= y0) continue;
+
+                const float inv_w = 1.0f / static_cast<float>(atlas.page_width());
+                const float inv_h = 1.0f / static_cast<float>(atlas.page_height());
+                const float u0 = (static_cast<float>(glyph->slot.x) + (x0 - gx0)) * inv_w;
+                const float v0 = (static_cast<float>(glyph->slot.y) + (y0 - gy0)) * inv_h;
+                const float u1 = (static_cast<float>(glyph->slot.x) + (x1 - gx0)) * inv_w;
+                const float v1 = (static_cast<float>(glyph->slot.y) + (y1 - gy0)) * inv_h;
+
+                auto& vertices = m_glyph_vertices[page];
+                vertices.push_back(renderer::make_vertex(point<float>{x0, y0}, fg, point<float>{u0, v0}));
+                vertices.push_back(renderer::make_vertex(point<float>{x1, y0}, fg, point<float>{u1, v0}));
+                vertices.push_back(renderer::make_vertex(point<float>{x1, y1}, fg, point<float>{u1, v1}));
+                vertices.push_back(renderer::make_vertex(point<float>{x0, y1}, fg, point<float>{u0, v1}));
+            }
+        }
+    }
+    m_dirty_count = 0;
+
+    // Shared index pattern sized for the largest pass
+    std::size_t max_vertices = std::max(m_fill_vertices.size(), m_line_vertices.size());
+    for (const auto& vertices : m_glyph_vertices) {
+        max_vertices = std::max(max_vertices, vertices.size());
+    }
+    for (std::size_t quad = m_indices.size() / 6; quad < max_vertices / 4; ++quad) {
+        const int base = static_cast<int>(quad * 4);
+        m_indices.insert(m_indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+    }
+
+    auto& rend = m_cache->get_renderer();
+    auto draw = [&](SDL_Texture* tex, const std::vector<SDL_Vertex>& vertices) {
+        return rend.render_geometry(
+            tex,
+            std::span<const SDL_Vertex>(vertices),
+            std::span<const int>(m_indices.data(), vertices.size() / 4 * 6));
+    };
+
+    // Raw target switch: renderer::get_target() would adopt the current target
+    SDL_Texture* previous = SDL_GetRenderTarget(rend.get());
+    if (!SDL_SetRenderTarget(rend.get(), m_target.get())) {
+        return make_unexpectedf(get_error());
+    }
+
+    auto previous_blend = rend.get_draw_blend_mode();
+    expected<void, std::string> status;
+
+    // Backgrounds replace whatever the cell held before
+    rend.set_draw_blend_mode(blend_mode::none);
+    if (auto r = draw(nullptr, m_fill_vertices); !r) status = make_unexpectedf(r.error());
+
+    rend.set_draw_blend_mode(blend_mode::blend);
+    for (std::size_t page = 0; page < m_glyph_vertices.size(); ++page) {
+        if (m_glyph_vertices[page].empty()) continue;
+        texture* tex = m_cache->page_texture(static_cast<int>(page));
+        if (!tex) {
+            status = make_unexpectedf("Failed to prepare atlas page", page);
+            continue;
+        }
+        tex->set_color_mod(colors::white);
+        tex->set_alpha_mod(255);
+        if (auto r = draw(tex->get(), m_glyph_vertices[page]); !r) status = make_unexpectedf(r.error());
+    }
+
+    // Underlines go on top of the glyphs
+    if (auto r = draw(nullptr, m_line_vertices); !r) status = make_unexpectedf(r.error());
+
+    if (previous_blend) {
+        rend.set_draw_blend_mode(*previous_blend);
+    }
+    SDL_SetRenderTarget(rend.get(), previous);
+
+    return status;
+}
+
+expected<void, std::string> text_grid::render(int x, int y) {
+    if (auto status = update(); !status) {
+        return status;
+    }
+
+    auto size = m_target.get_size();
+    if (!size) {
+        return make_unexpectedf(size.error());
+    }
+
+    // Storage rows from m_top down form the top of the grid, the rest follow
+    auto& rend = m_cache->get_renderer();
+    const int split = m_top * m_cell_height;
+    const int upper = size->height - split;
+    rect<int> src(0, split, size->width, upper);
+    rect<int> dst(x, y, size->width, upper);
+    if (auto r = rend.copy(m_target, std::optional{src}, std::optional{dst}); !r) {
+        return make_unexpectedf(r.error());
+    }
+    if (split > 0) {
+        src = rect<int>(0, 0, size->width, split);
+        dst = rect<int>(x, y + upper, size->width, split);
+        if (auto r = rend.copy(m_target, std::optional{src}, std::optional{dst}); !r) {
+            return make_unexpectedf(r.error());
+        }
+    }
+    return {};
+}
+
+} // namespace sdlpp::font
@@ -3,6 +3,7 @@
 //
 
 #include <sdlpp/image/image.hh>
+#include <sdlpp/core/profiler.hh>
 #include <fstream>
 #include <limits>
 #include <cmath>
@@ -31,6 +32,7 @@ std::vector<std::uint8_t> read_file(const std::filesystem::path& path) {
 } // anonymous namespace
 
 expected<surface, std::string> load(const std::filesystem::path& path) {
+    SDLPP_PROFILE_ZONE("image::load");
     auto data = read_file(path);
     if (data.empty()) {
         return make_unexpectedf("Failed to read file:", path.string());
@@ -40,6 +42,7 @@ expected<surface, std::string> load(const std::filesystem::path& path) {
 }
 
 expected<surface, std::string> load(std::span<const std::uint8_t> data) {
+    SDLPP_PROFILE_ZONE("image::decode");
     sdlpp::surface result;
     sdl_surface_adapter adapter(result);
 
@@ -78,6 +81,7 @@ expected<texture, std::string> load_texture(
 expected<surface, std::string> decode(
     std::span<const std::uint8_t> data,
     const std::string& codec_name) {
+    SDLPP_PROFILE_ZONE("image::decode");
 
     sdlpp::surface result;
     sdl_surface_adapter adapter(result);
@@ -0,0 +1,197 @@
+#include <sdlpp/input/input_snapshot.hh>
+
+namespace sdlpp {
+    input_tracker::input_tracker() noexcept = default;
+
+    template<std::size_t Bits>
+    void input_tracker::publish_edges(input_snapshot::button_edges <Bits>& out,
+                                      const packed_bitset <Bits>& previous_down,
+                                      live_buttons <Bits>& live) noexcept {
+        const auto prev = previous_down.words();
+        const auto cur = live.down.words();
+        const auto went_down = live.went_down.words();
+        const auto went_up = live.went_up.words();
+        auto down = out.down.words();
+        auto pressed = out.pressed.words();
+        auto released = out.released.words();
+        auto held = out.held.words();
+
+        // Fixed trip count over plain words; vectorizes without intrinsics.
+        // The event masks catch presses and releases that cancelled out
+        // within the frame and would not show in the state difference.
+        for (std::size_t i = 0; i < packed_bitset <Bits>::word_count; ++i) {
+            const auto changed = prev[i] ^ cur[i];
+            down[i] = cur[i];
+            pressed[i] = (changed & cur[i]) | went_down[i];
+            released[i] = (changed & prev[i]) | went_up[i];
+            held[i] = prev[i] & cur[i];
+        }
+
+        live.went_down.reset();
+        live.went_up.reset();
+    }
+
+    void input_tracker::stamp(Uint64 timestamp) noexcept {
+        if (first_event_ns_ == 0) {
+            first_event_ns_ = timestamp;
+        }
+        last_event_ns_ = timestamp;
+    }
+
+    std::size_t input_tracker::acquire_gamepad_slot(SDL_JoystickID id) noexcept {
+        std::size_t free_slot = input_snapshot::max_gamepads;
+        for (std::size_t i = 0; i < input_snapshot::max_gamepads; ++i) {
+            if (gamepad_ids_[i] == id) {
+                return i;
+            }
+            const bool pending_removal = (removed_gamepads_ >> i) & 1u;
+            if (gamepad_ids_[i] == 0 && !pending_removal && free_slot == input_snapshot::max_gamepads) {
+                free_slot = i;
+            }
+        }
+        if (free_slot < input_snapshot::max_gamepads) {
+            gamepad_ids_[free_slot] = id;
+        }
+        return free_slot;
+    }
+
+    void input_tracker::process(const SDL_Event& e) noexcept {
+        switch (e.type) {
+            case SDL_EVENT_KEY_DOWN:
+            case SDL_EVENT_KEY_UP:
+                mods_ = static_cast <keymod>(e.key.mod);
+                if (e.key.repeat) {
+                    break;
+                }
+                if (e.key.down) {
+                    keys_.press(e.key.scancode);
+                } else {
+                    keys_.release(e.key.scancode);
+                }
+                stamp(e.key.timestamp);
+                break;
+
+            case SDL_EVENT_MOUSE_BUTTON_DOWN:
+            case SDL_EVENT_MOUSE_BUTTON_UP:
+                if (e.button.down) {
+                    mouse_.press(e.button.button);
+                } else {
+                    mouse_.release(e.button.button);
+                }
+                mouse_x_ = e.button.x;
+                mouse_y_ = e.button.y;
+                stamp(e.button.timestamp);
+                break;
+
+            case SDL_EVENT_MOUSE_MOTION:
+                mouse_x_ = e.motion.x;
+                mouse_y_ = e.motion.y;
+                stamp(e.motion.timestamp);
+                break;
+
+            case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+            case SDL_EVENT_GAMEPAD_BUTTON_UP: {
+                const std::size_t slot = acquire_gamepad_slot(e.gbutton.which);
+                if (slot >= input_snapshot::max_gamepads || e.gbutton.button >= input_snapshot::gamepad_stride) {
+                    break;
+                }
+                const std::size_t index = slot * input_snapshot::gamepad_stride + e.gbutton.button;
+                if (e.gbutton.down) {
+                    gamepad_.press(index);
+                } else {
+                    gamepad_.release(index);
+                }
+                stamp(e.gbutton.timestamp);
+                break;
+            }
+
+            case SDL_EVENT_GAMEPAD_REMOVED: {
+                std::size_t slot = 0;
+                while (slot < input_snapshot::max_gamepads && gamepad_ids_[slot] != e.gdevice.which) {
+                    ++slot;
+                }
+                if (slot >= input_snapshot::max_gamepads) {
+                    break;
+                }
+                // Release its buttons; the slot keeps its id until the
+                // releases have been published
+                for (std::size_t b = 0; b < input_snapshot::gamepad_stride; ++b) {
+                    const std::size_t index = slot * input_snapshot::gamepad_stride + b;
+                    if (gamepad_.down.test(index)) {
+                        gamepad_.release(index);
+                    }
+                }
+                removed_gamepads_ |= 1u << slot;
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    const input_snapshot& input_tracker::next_frame() noexcept {
+        const input_snapshot& prev = snapshots_[current_];
+        input_snapshot& next = snapshots_[current_ ^ 1u];
+
+        publish_edges(next.keys_, prev.keys_.down, keys_);
+        publish_edges(next.mouse_, prev.mouse_.down, mouse_);
+        publish_edges(next.gamepad_, prev.gamepad_.down, gamepad_);
+
+        next.gamepad_ids_ = gamepad_ids_;
+        next.mods_ = mods_;
+        next.mouse_x_ = mouse_x_;
+        next.mouse_y_ = mouse_y_;
+        next.frame_ = ++frame_;
+        next.first_event_ns_ = first_event_ns_;
+        next.last_event_ns_ = last_event_ns_;
+        next.capture_ns_ = SDL_GetTicksNS();
+
+        for (std::size_t i = 0; i < input_snapshot::max_gamepads; ++i) {
+            if ((removed_gamepads_ >> i) & 1u) {
+                gamepad_ids_[i] = 0;
+            }
+        }
+        removed_gamepads_ = 0;
+        first_event_ns_ = 0;
+        last_event_ns_ = 0;
+
+        current_ ^= 1u;
+        return next;
+    }
+
+    void input_tracker::sync_keyboard() noexcept {
+        int numkeys = 0;
+        const bool* state = SDL_GetKeyboardState(&numkeys);
+        if (!state) {
+            return;
+        }
+        for (std::size_t i = 0; i < SDL_SCANCODE_COUNT; ++i) {
+            const bool down = i < static_cast <std::size_t>(numkeys) && state[i];
+            if (down != keys_.down.test(i)) {
+                if (down) {
+                    keys_.press(i);
+                } else {
+                    keys_.release(i);
+                }
+            }
+        }
+        mods_ = static_cast <keymod>(SDL_GetModState());
+    }
+
+    void input_tracker::release_all() noexcept {
+        for (std::size_t index : keys_.down) {
+            keys_.went_up.set(index);
+        }
+        for (std::size_t index : mouse_.down) {
+            mouse_.went_up.set(index);
+        }
+        for (std::size_t index : gamepad_.down) {
+            gamepad_.went_up.set(index);
+        }
+        keys_.down.reset();
+        mouse_.down.reset();
+        gamepad_.down.reset();
+        mods_ = keymod::none;
+    }
+} // namespace sdlpp
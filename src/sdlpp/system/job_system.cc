@@ -0,0 +1,317 @@
+#include <sdlpp/system/job_system.hh>
+#include <sdlpp/system/cpu.hh>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace sdlpp {
+    namespace {
+        using steady = std::chrono::steady_clock;
+
+        constexpr std::size_t deque_capacity = 4096;  // Power of two
+        constexpr int spin_rounds = 64;               // Failed searches before sleeping
+
+        /**
+         * Chase-Lev work-stealing deque with a fixed ring. The owner pushes and
+         * pops at the bottom; thieves take from the top. When full, push()
+         * fails and the caller runs the job inline.
+         */
+        class work_deque {
+            public:
+                work_deque()
+                    : buffer_(std::make_unique <std::atomic <detail::job*>[]>(deque_capacity)) {
+                }
+
+                bool push(detail::job* j) noexcept {
+                    const auto b = bottom_.load(std::memory_order_relaxed);
+                    const auto t = top_.load(std::memory_order_acquire);
+                    if (b - t >= static_cast <std::int64_t>(deque_capacity)) {
+                        return false;
+                    }
+                    slot(b).store(j, std::memory_order_relaxed);
+                    bottom_.store(b + 1, std::memory_order_release);
+                    return true;
+                }
+
+                detail::job* pop() noexcept {
+                    const auto b = bottom_.load(std::memory_order_relaxed) - 1;
+                    bottom_.store(b, std::memory_order_seq_cst);
+                    auto t = top_.load(std::memory_order_seq_cst);
+
+                    if (t > b) {
+                        bottom_.store(b + 1, std::memory_order_relaxed);
+                        return nullptr;
+                    }
+
+                    detail::job* j = slot(b).load(std::memory_order_relaxed);
+                    if (t == b) {
+                        // Last element: race against thieves for it
+                        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                          std::memory_order_relaxed)) {
+                            j = nullptr;
+                        }
+                        bottom_.store(b + 1, std::memory_order_relaxed);
+                    }
+                    return j;
+                }
+
+                detail::job* steal() noexcept {
+                    auto t = top_.load(std::memory_order_seq_cst);
+                    const auto b = bottom_.load(std::memory_order_seq_cst);
+                    if (t >= b) {
+                        return nullptr;
+                    }
+                    detail::job* j = slot(t).load(std::memory_order_relaxed);
+                    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                      std::memory_order_relaxed)) {
+                        return nullptr;
+                    }
+                    return j;
+                }
+
+            private:
+                std::atomic <detail::job*>& slot(std::int64_t index) noexcept {
+                    return buffer_[static_cast <std::size_t>(index) & (deque_capacity - 1)];
+                }
+
+                alignas(64) std::atomic <std::int64_t> top_{0};
+                alignas(64) std::atomic <std::int64_t> bottom_{0};
+                std::unique_ptr <std::atomic <detail::job*>[]> buffer_;
+        };
+
+        std::chrono::nanoseconds elapsed_since(steady::time_point start) {
+            return std::chrono::duration_cast <std::chrono::nanoseconds>(steady::now() - start);
+        }
+    } // anonymous namespace
+
+    struct job_system::worker {
+        work_deque deque;
+        std::thread thread;
+        std::uint32_t rng;
+
+        // Statistics (written by the owner, read by anyone)
+        std::atomic <std::uint64_t> executed{0};
+        std::atomic <std::uint64_t> stolen{0};
+        std::atomic <std::int64_t> busy_ns{0};
+        std::atomic <std::int64_t> idle_ns{0};
+
+        explicit worker(std::uint32_t seed)
+            : rng(seed) {
+        }
+    };
+
+    struct job_system::shared_state {
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::deque <detail::job*> injected;   // Jobs from threads outside the pool
+        std::atomic <std::int64_t> queued{0};  // Jobs pushed but not yet taken
+        std::atomic <int> sleeping{0};
+        bool stop = false;
+    };
+
+    namespace {
+        // Identifies the pool and worker the current thread belongs to
+        struct worker_identity {
+            const void* pool = nullptr;
+            std::size_t index = 0;
+        };
+
+        thread_local worker_identity current_worker;
+    } // anonymous namespace
+
+    job_system::job_system(std::size_t worker_count)
+        : shared_(std::make_unique <shared_state>()) {
+        if (worker_count == 0) {
+            const std::size_t cores = cpu_info::get_cpu_count();
+            worker_count = cores > 1 ? cores - 1 : 1;
+        }
+
+        workers_.reserve(worker_count);
+        for (std::size_t i = 0; i < worker_count; ++i) {
+            workers_.push_back(std::make_unique <worker>(static_cast <std::uint32_t>(i * 2654435761u + 1u)));
+        }
+
+        // Start threads only once every deque exists, since they steal from each other
+        for (std::size_t i = 0; i < worker_count; ++i) {
+            workers_[i]->thread = std::thread([this, i] {
+                current_worker = {this, i};
+                auto& self = *workers_[i];
+                auto& shared = *shared_;
+                int misses = 0;
+
+                for (;;) {
+                    if (detail::job* j = find_job(i)) {
+                        execute(j, &self);
+                        misses = 0;
+                        continue;
+                    }
+                    if (++misses < spin_rounds) {
+                        cpu_pause::pause();
+                        continue;
+                    }
+                    misses = 0;
+
+                    const auto sleep_start = steady::now();
+                    std::unique_lock lock(shared.mutex);
+                    shared.sleeping.fetch_add(1, std::memory_order_seq_cst);
+                    shared.wake.wait(lock, [&shared] {
+                        return shared.stop || shared.queued.load(std::memory_order_seq_cst) > 0;
+                    });
+                    shared.sleeping.fetch_sub(1, std::memory_order_relaxed);
+                    const bool stopping = shared.stop && shared.queued.load(std::memory_order_seq_cst) == 0;
+                    lock.unlock();
+                    self.idle_ns.fetch_add(elapsed_since(sleep_start).count(), std::memory_order_relaxed);
+
+                    if (stopping) {
+                        return;
+                    }
+                }
+            });
+        }
+    }
+
+    job_system::~job_system() {
+        {
+            std::lock_guard lock(shared_->mutex);
+            shared_->stop = true;
+        }
+        shared_->wake.notify_all();
+        for (auto& w : workers_) {
+            if (w->thread.joinable()) {
+                w->thread.join();
+            }
+        }
+    }
+
+    void job_system::enqueue(detail::job* j) {
+        if (j->counter()) {
+            j->counter()->value_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        const bool on_worker = current_worker.pool == this;
+        if (on_worker) {
+            if (!workers_[current_worker.index]->deque.push(j)) {
+                // Deque full: no room to defer, run it now
+                execute(j, workers_[current_worker.index].get());
+                return;
+            }
+        } else {
+            std::lock_guard lock(shared_->mutex);
+            shared_->injected.push_back(j);
+        }
+
+        shared_->queued.fetch_add(1, std::memory_order_seq_cst);
+        if (shared_->sleeping.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard lock(shared_->mutex);
+            shared_->wake.notify_one();
+        }
+    }
+
+    detail::job* job_system::find_job(std::size_t self) {
+        const bool is_worker = self < workers_.size();
+
+        if (is_worker) {
+            if (detail::job* j = workers_[self]->deque.pop()) {
+                shared_->queued.fetch_sub(1, std::memory_order_relaxed);
+                return j;
+            }
+        }
+
+        if (shared_->queued.load(std::memory_order_relaxed) <= 0) {
+            return nullptr;
+        }
+
+        {
+            std::lock_guard lock(shared_->mutex);
+            if (!shared_->injected.empty()) {
+                detail::job* j = shared_->injected.front();
+                shared_->injected.pop_front();
+                shared_->queued.fetch_sub(1, std::memory_order_relaxed);
+                return j;
+            }
+        }
+
+        // Steal, starting from a random victim to spread contention
+        const std::size_t count = workers_.size();
+        std::size_t start = 0;
+        if (is_worker) {
+            auto& rng = workers_[self]->rng;
+            rng ^= rng << 13;
+            rng ^= rng >> 17;
+            rng ^= rng << 5;
+            start = rng % count;
+        }
+        for (std::size_t k = 0; k < count; ++k) {
+            const std::size_t victim = (start + k) % count;
+            if (victim == self) {
+                continue;
+            }
+            if (detail::job* j = workers_[victim]->deque.steal()) {
+                shared_->queued.fetch_sub(1, std::memory_order_relaxed);
+                if (is_worker) {
+                    workers_[self]->stolen.fetch_add(1, std::memory_order_relaxed);
+                }
+                return j;
+            }
+        }
+        return nullptr;
+    }
+
+    void job_system::execute(detail::job* j, worker* self) noexcept {
+        const auto start = self ? steady::now() : steady::time_point{};
+
+        j->run();
+
+        if (self) {
+            self->busy_ns.fetch_add(elapsed_since(start).count(), std::memory_order_relaxed);
+            self->executed.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        job_counter* counter = j->counter();
+        if (j->owned()) {
+            delete j;
+        }
+        if (counter) {
+            counter->value_.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+    void job_system::wait(job_counter& counter) {
+        const bool on_worker = current_worker.pool == this;
+        const std::size_t self = on_worker ? current_worker.index : workers_.size();
+        worker* stats = on_worker ? workers_[self].get() : nullptr;
+
+        while (!counter.done()) {
+            if (detail::job* j = find_job(self)) {
+                execute(j, stats);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    std::vector <job_worker_stats> job_system::statistics() const {
+        std::vector <job_worker_stats> result;
+        result.reserve(workers_.size());
+        for (const auto& w : workers_) {
+            job_worker_stats s;
+            s.jobs_executed = w->executed.load(std::memory_order_relaxed);
+            s.jobs_stolen = w->stolen.load(std::memory_order_relaxed);
+            s.busy = std::chrono::nanoseconds(w->busy_ns.load(std::memory_order_relaxed));
+            s.idle = std::chrono::nanoseconds(w->idle_ns.load(std::memory_order_relaxed));
+            result.push_back(s);
+        }
+        return result;
+    }
+
+    void job_system::reset_statistics() noexcept {
+        for (auto& w : workers_) {
+            w->executed.store(0, std::memory_order_relaxed);
+            w->stolen.store(0, std::memory_order_relaxed);
+            w->busy_ns.store(0, std::memory_order_relaxed);
+            w->idle_ns.store(0, std::memory_order_relaxed);
+        }
+    }
+} // namespace sdlpp
@@ -66,9 +66,9 @@ static void process_aa_pixel_batch(SDL_Renderer* renderer,
     }
 }
 
-expected<void, std::string> renderer::draw_line_aa(float x1, float y1, float x2, float y2) {
+expected<void, error> renderer::draw_line_aa(float x1, float y1, float x2, float y2) {
     if (!ptr) {
-        return make_unexpectedf("Invalid renderer");
+        return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
     }
     
     // Get current draw color
@@ -90,13 +90,13 @@ expected<void, std::string> renderer::draw_line_aa(float x1, float y1, float x2,
     return {};
 }
 
-expected<void, std::string> renderer::draw_line_thick(float x1, float y1, float x2, float y2, float width) {
+expected<void, error> renderer::draw_line_thick(float x1, float y1, float x2, float y2, float width) {
     if (!ptr) {
-        return make_unexpectedf("Invalid renderer");
+        return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
     }
     
     if (width <= 0) {
-        return make_unexpectedf("Line width must be positive");
+        return make_error(errc::invalid_argument, error_subsystem::render, "Line width must be positive");
     }
     
     // Use euler's thick line iterator with manual batching
@@ -116,13 +116,13 @@ expected<void, std::string> renderer::draw_line_thick(float x1, float y1, float
     return {};
 }
 
-expected<void, std::string> renderer::draw_circle(int x, int y, int radius) {
+expected<void, error> renderer::draw_circle(int x, int y, int radius) {
     if (!ptr) {
-        return make_unexpectedf("Invalid renderer");
+        return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
     }
     
     if (radius < 0) {
-        return make_unexpectedf("Circle radius must be non-negative");
+        return make_error(errc::invalid_argument, error_subsystem::render, "Circle radius must be non-negative");
     }
     
     if (radius == 0) {
@@ -144,13 +144,13 @@ expected<void, std::string> renderer::draw_circle(int x, int y, int radius) {
     return {};
 }
 
-expected<void, std::string> renderer::fill_circle(int x, int y, int radius) {
+expected<void, error> renderer::fill_circle(int x, int y, int radius) {
     if (!ptr) {
-        return make_unexpectedf("Invalid renderer");
+        return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
     }
     
     if (radius < 0) {
-        return make_unexpectedf("Circle radius must be non-negative");
+        return make_error(errc::invalid_argument, error_subsystem::render, "Circle radius must be non-negative");
     }
     
     if (radius == 0) {
@@ -171,20 +171,20 @@ expected<void, std::string> renderer::fill_circle(int x, int y, int radius) {
                            static_cast<float>(span.y), 
                            static_cast<float>(span.x_end), 
                            static_cast<float>(span.y))) {
-            return make_unexpectedf(get_error());
+            return make_sdl_error(error_subsystem::render);
         }
     }
     
     return {};
 }
 
-expected<void, std::string> renderer::draw_ellipse(int x, int y, int rx, int ry) {
+expected<void, error> renderer::draw_ellipse(int x, int y, int rx, int ry) {
     if (!ptr) {
-        return make_unexpectedf("Invalid renderer");
+        return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
     }
     
     if (rx < 0 || ry < 0) {
-        return make_unexpectedf("Ellipse radii must be non-negative");
+        return make_error(errc::invalid_argument, error_subsystem::render, "Ellipse radii must be non-negative");
     }
     
     if (rx == 0 && ry == 0) {
@@ -215,13 +215,13 @@ expected<void, std::string> renderer::draw_ellipse(int x, int y, int rx, int ry)
     return {};
 }
 
-expected<void, std::string> renderer::fill_ellipse(int x, int y, int rx, int ry) {
+expected<void, error> renderer::fill_ellipse(int x, int y, int rx, int ry) {
     if (!ptr) {
-        return make_unexpectedf("Invalid renderer");
+        return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
     }
     
     if (rx < 0 || ry < 0) {
-        return make_unexpectedf("Ellipse radii must be non-negative");
+        return make_error(errc::invalid_argument, error_subsystem::render, "Ellipse radii must be non-negative");
     }
     
     if (rx == 0 && ry == 0) {
@@ -250,20 +250,20 @@ expected<void, std::string> renderer::fill_ellipse(int x, int y, int rx, int ry)
                            static_cast<float>(y_int), 
                            static_cast<float>(x_end), 
                            static_cast<float>(y_int))) {
-            return make_unexpectedf(get_error());
+            return make_sdl_error(error_subsystem::render);
         }
     }
     
     return {};
 }
 
-expected<void, std::string> renderer::draw_ellipse_arc(int x, int y, int rx, int ry, float start_angle, float end_angle) {
+expected<void, error> renderer::draw_ellipse_arc(int x, int y, int rx, int ry, float start_angle, float end_angle) {
     if (!ptr) {
-        return make_unexpectedf("Invalid renderer");
+        return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
     }
     
     if (rx < 0 || ry < 0) {
-        return make_unexpectedf("Ellipse radii must be non-negative");
+        return make_error(errc::invalid_argument, error_subsystem::render, "Ellipse radii must be non-negative");
     }
     
     if (rx == 0 && ry == 0) {
@@ -297,9 +297,9 @@ expected<void, std::string> renderer::draw_ellipse_arc(int x, int y, int rx, int
     return {};
 }
 
-expected<void, std::string> renderer::draw_bezier_quad(float x0, float y0, float x1, float y1, float x2, float y2) {
+expected<void, error> renderer::draw_bezier_quad(float x0, float y0, float x1, float y1, float x2, float y2) {
     if (!ptr) {
-        return make_unexpectedf("Invalid renderer");
+        return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
     }
     
     // Use euler's quadratic bezier iterator with batch writer
@@ -328,10 +328,10 @@ expected<void, std::string> renderer::draw_bezier_quad(float x0, float y0, float
     return {};
 }
 
-expected<void, std::string> renderer::draw_bezier_cubic(float x0, float y0, float x1, float y1, 
+expected<void, error> renderer::draw_bezier_cubic(float x0, float y0, float x1, float y1, 
                                                        float x2, float y2, float x3, float y3) {
     if (!ptr) {
-        return make_unexpectedf("Invalid renderer");
+        return make_error(errc::invalid_handle, error_subsystem::render, "Invalid renderer");
     }
     
     // Use euler's cubic bezier iterator with batch writer
@@ -445,6 +445,65 @@ void surface_renderer::apply_blend_mode(int x, int y, uint32_t src_pixel) {
     put_pixel(x, y, result_pixel);
 }
 
+expected<void, std::string> surface_renderer::blend_mask(
+    int x, int y,
+    std::span<const uint8_t> mask,
+    int width, int height,
+    int pitch) {
+    if (!surface_) {
+        return make_unexpectedf("Invalid surface");
+    }
+
+    if (width <= 0 || height <= 0) {
+        return {};
+    }
+
+    if (pitch == 0) {
+        pitch = width;
+    }
+
+    const auto required = static_cast<size_t>(pitch) * static_cast<size_t>(height - 1)
+                          + static_cast<size_t>(width);
+    if (pitch < width || mask.size() < required) {
+        return make_unexpectedf("Mask buffer too small");
+    }
+
+    // Clip to the surface first, then to the user clip rectangle
+    rect<int> area{x, y, width, height};
+    const int x0 = std::max(area.x, 0);
+    const int y0 = std::max(area.y, 0);
+    const int x1 = std::min(area.x + area.w, surface_->w);
+    const int y1 = std::min(area.y + area.h, surface_->h);
+    if (x1 <= x0 || y1 <= y0) {
+        return {};
+    }
+    area = rect<int>{x0, y0, x1 - x0, y1 - y0};
+
+    if (!clip_rect_to_clip(area)) {
+        return {};
+    }
+
+    surface_lock lock(surface_);
+
+    const bool opaque = draw_color_.a == 255;
+    for (int py = area.y; py < area.y + area.h; ++py) {
+        const uint8_t* row = mask.data() + static_cast<size_t>(py - y) * static_cast<size_t>(pitch);
+        for (int px = area.x; px < area.x + area.w; ++px) {
+            const uint8_t coverage = row[px - x];
+            if (coverage == 0) {
+                continue;
+            }
+            if (coverage == 255 && opaque) {
+                put_pixel(px, py, mapped_color_);
+            } else {
+                blend_pixel(px, py, mapped_color_, static_cast<float>(coverage) / 255.0f);
+            }
+        }
+    }
+
+    return {};
+}
+
 void surface_renderer::blend_pixel(int x, int y, uint32_t pixel, float alpha) {
     if (!surface_ || x < 0 || y < 0 || x >= surface_->w || y >= surface_->h) {
         return;
@@ -0,0 +1,217 @@
+/**
+ * @file test_async_log_backend.cc
+ * @brief Unit tests for the asynchronous logger backend
+ */
+
+#include <doctest/doctest.h>
+#include <sdlpp/core/async_log_backend.hh>
+#include <sdlpp/core/log.hh>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_SUITE("async_log_backend") {
+    // Captures SDL log output; can hold the writer thread inside the output
+    // callback to fill the queue deterministically
+    class log_capture {
+    public:
+        log_capture() {
+            sdlpp::log_config::set_output_function(
+                [this](int category, sdlpp::log_priority priority, const std::string& message) {
+                    std::unique_lock lock(mutex_);
+                    entries_.push_back({category, priority, message});
+                    ++emitting_;
+                    cv_.notify_all();
+                    cv_.wait(lock, [this] { return !held_; });
+                }
+            );
+        }
+
+        ~log_capture() {
+            release();
+            sdlpp::log_config::set_output_function(nullptr);
+        }
+
+        struct log_entry {
+            int category;
+            sdlpp::log_priority priority;
+            std::string message;
+        };
+
+        std::vector<log_entry> get_entries() const {
+            std::lock_guard lock(mutex_);
+            return entries_;
+        }
+
+        // Block the writer in its next emit and wait until it gets there
+        void hold_next(sdlpp::async_log_backend& backend) {
+            std::unique_lock lock(mutex_);
+            held_ = true;
+            const int before = emitting_;
+            lock.unlock();
+            backend.log(sdlpp::log_priority::info, "", nullptr, 0, "holder");
+            lock.lock();
+            cv_.wait(lock, [this, before] { return emitting_ > before; });
+        }
+
+        void release() {
+            std::lock_guard lock(mutex_);
+            held_ = false;
+            cv_.notify_all();
+        }
+
+    private:
+        mutable std::mutex mutex_;
+        std::condition_variable cv_;
+        std::vector<log_entry> entries_;
+        int emitting_ = 0;
+        bool held_ = false;
+    };
+
+    TEST_CASE("messages are emitted in order with their metadata") {
+        log_capture capture;
+        sdlpp::async_log_backend backend({
+            .show_timestamp = false,
+            .show_thread_id = false,
+            .show_file_line = true
+        });
+        backend.map_category("render", sdlpp::log_category::render);
+
+        backend.log(sdlpp::log_priority::warn, "render", "/src/renderer.cc", 42, "first");
+        auto logger = backend.get_logger();
+        logger(4, "other", nullptr, 0, "second");
+        backend.flush();
+
+        const auto entries = capture.get_entries();
+        REQUIRE(entries.size() == 2);
+        CHECK(entries[0].message == "[render] [/src/renderer.cc:42] first");
+        CHECK(entries[0].category == sdlpp::to_sdl_category(sdlpp::log_category::render));
+        CHECK(entries[0].priority == sdlpp::log_priority::warn);
+        CHECK(entries[1].message == "[other] second");
+        CHECK(entries[1].category == sdlpp::to_sdl_category(sdlpp::log_category::application));
+        CHECK(entries[1].priority == sdlpp::log_priority::error);
+    }
+
+    TEST_CASE("timestamps and thread ids are formatted by the writer") {
+        log_capture capture;
+        sdlpp::async_log_backend backend;
+        backend.log(sdlpp::log_priority::info, "", nullptr, 0, "stamped");
+        backend.flush();
+
+        const auto entries = capture.get_entries();
+        REQUIRE(entries.size() == 1);
+        CHECK(entries[0].message.front() == '[');
+        CHECK(std::count(entries[0].message.begin(), entries[0].message.end(), '[') == 2);
+        CHECK(entries[0].message.find("] stamped") != std::string::npos);
+    }
+
+    TEST_CASE("long messages are truncated") {
+        log_capture capture;
+        sdlpp::async_log_backend backend({.show_timestamp = false, .show_thread_id = false});
+        backend.log(sdlpp::log_priority::info, "", nullptr, 0,
+                    std::string(sdlpp::async_log_backend::record_text_capacity + 100, 'x'));
+        backend.flush();
+
+        const auto entries = capture.get_entries();
+        REQUIRE(entries.size() == 1);
+        CHECK(entries[0].message.size() == sdlpp::async_log_backend::record_text_capacity + 3);
+        CHECK(entries[0].message.ends_with("..."));
+    }
+
+    TEST_CASE("drop and count policies discard messages when full") {
+        for (const auto policy : {sdlpp::async_log_backend::overflow_policy::drop,
+                                  sdlpp::async_log_backend::overflow_policy::count}) {
+            log_capture capture;
+            sdlpp::async_log_backend backend({
+                .show_timestamp = false,
+                .show_thread_id = false,
+                .capacity = 4,
+                .overflow = policy
+            });
+            capture.hold_next(backend);
+
+            int accepted = 0;
+            for (int i = 0; i < 10; ++i) {
+                accepted += backend.log(sdlpp::log_priority::info, "", nullptr, 0, "m") ? 1 : 0;
+            }
+            // The held record keeps its slot until it has been emitted
+            CHECK(accepted == 3);
+            CHECK(backend.dropped() == 7);
+
+            capture.release();
+            backend.flush();
+
+            const auto entries = capture.get_entries();
+            const bool reported = std::any_of(entries.begin(), entries.end(), [](const auto& e) {
+                return e.message == "7 log message(s) dropped: queue full";
+            });
+            CHECK(reported == (policy == sdlpp::async_log_backend::overflow_policy::count));
+        }
+    }
+
+    TEST_CASE("block policy waits for room") {
+        log_capture capture;
+        sdlpp::async_log_backend backend({
+            .show_timestamp = false,
+            .show_thread_id = false,
+            .capacity = 2,
+            .overflow = sdlpp::async_log_backend::overflow_policy::block
+        });
+        capture.hold_next(backend);
+
+        std::thread producer([&backend] {
+            for (int i = 0; i < 20; ++i) {
+                backend.log(sdlpp::log_priority::info, "", nullptr, 0, std::to_string(i));
+            }
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        capture.release();
+        producer.join();
+        backend.flush();
+
+        const auto entries = capture.get_entries();
+        REQUIRE(entries.size() == 21);
+        CHECK(backend.dropped() == 0);
+        for (int i = 0; i < 20; ++i) {
+            CHECK(entries[static_cast<std::size_t>(i) + 1].message == std::to_string(i));
+        }
+    }
+
+    TEST_CASE("concurrent producers keep per-thread order") {
+        log_capture capture;
+        sdlpp::async_log_backend backend({
+            .show_timestamp = false,
+            .show_thread_id = false,
+            .capacity = 64,
+            .overflow = sdlpp::async_log_backend::overflow_policy::block
+        });
+
+        constexpr int threads = 4;
+        constexpr int per_thread = 500;
+        std::vector<std::thread> producers;
+        for (int t = 0; t < threads; ++t) {
+            producers.emplace_back([&backend, t] {
+                const std::string category = "t" + std::to_string(t);
+                for (int i = 0; i < per_thread; ++i) {
+                    backend.log(sdlpp::log_priority::info, category, nullptr, 0, std::to_string(i));
+                }
+            });
+        }
+        for (auto& p : producers) {
+            p.join();
+        }
+        backend.flush();
+
+        const auto entries = capture.get_entries();
+        REQUIRE(entries.size() == threads * per_thread);
+        std::vector<int> next(threads, 0);
+        for (const auto& e : entries) {
+            const int t = e.message[2] - '0';
+            CHECK(e.message.substr(5) == std::to_string(next[static_cast<std::size_t>(t)]++));
+        }
+    }
+}
@@ -0,0 +1,195 @@
+/**
+ * @file test_binary_log.cc
+ * @brief Unit tests for deferred-format binary logging
+ */
+
+#include <doctest/doctest.h>
+#include <sdlpp/core/binary_log.hh>
+#include <sdlpp/core/log.hh>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    enum class blog_test_state : std::uint8_t {
+        idle = 3
+    };
+
+    std::vector <std::string> decode_messages() {
+        std::stringstream stream;
+        sdlpp::binary_log::save(stream);
+        auto log = sdlpp::binary_log_reader::read(stream);
+        REQUIRE(log.has_value());
+        std::vector <std::string> messages;
+        for (const auto& r : log->records()) {
+            messages.push_back(log->format(r));
+        }
+        return messages;
+    }
+}
+
+TEST_SUITE("binary_log") {
+    TEST_CASE("arguments are recorded raw and formatted on decode") {
+        sdlpp::log_config::set_all_priorities(sdlpp::log_priority::info);
+        sdlpp::binary_log::clear();
+
+        const std::string name = "player";
+        const int* address = nullptr;
+        SDLPP_BLOG(sdlpp::log_category::input, sdlpp::log_priority::info,
+                   "{} moved to ({}, {}) state={} {{literal}}", name, -12, 3.5f, blog_test_state::idle);
+        SDLPP_BLOG(sdlpp::log_category::input, sdlpp::log_priority::warn,
+                   "flags {} {} {} {}", true, 'x', std::uint64_t{18446744073709551615ull}, address);
+        SDLPP_BLOG(sdlpp::log_category::input, sdlpp::log_priority::info, "no arguments");
+        SDLPP_BLOG(sdlpp::log_category::input, sdlpp::log_priority::info, "extra", 1, "two");
+
+        const auto messages = decode_messages();
+        REQUIRE(messages.size() == 4);
+        CHECK(messages[0] == "player moved to (-12, 3.5) state=3 {literal}");
+        CHECK(messages[1] == "flags true x 18446744073709551615 0x0");
+        CHECK(messages[2] == "no arguments");
+        CHECK(messages[3] == "extra 1 two");
+    }
+
+    TEST_CASE("sites carry their source location and category") {
+        sdlpp::log_config::set_all_priorities(sdlpp::log_priority::info);
+        sdlpp::binary_log::clear();
+
+        const auto line = __LINE__ + 1;
+        SDLPP_BLOG(sdlpp::log_category::render, sdlpp::log_priority::error, "draw {}", 7);
+
+        std::stringstream stream;
+        sdlpp::binary_log::save(stream);
+        auto log = sdlpp::binary_log_reader::read(stream);
+        REQUIRE(log.has_value());
+        REQUIRE(log->records().size() == 1);
+
+        const auto* site = log->find_site(log->records()[0].site);
+        REQUIRE(site != nullptr);
+        CHECK(site->line == static_cast <std::uint32_t>(line));
+        CHECK(site->file.find("test_binary_log") != std::string::npos);
+        CHECK(site->format == "draw {}");
+        CHECK(site->category == sdlpp::to_sdl_category(sdlpp::log_category::render));
+        CHECK(site->priority == sdlpp::log_priority::error);
+        REQUIRE(site->args.size() == 1);
+        CHECK(site->args[0] == sdlpp::binary_log_arg::int32);
+
+        std::ostringstream text;
+        log->write_text(text);
+        CHECK(text.str().find("test_binary_log.cc:" + std::to_string(line) + "] draw 7\n") != std::string::npos);
+    }
+
+    TEST_CASE("disabled priorities record nothing") {
+        sdlpp::log_config::set_all_priorities(sdlpp::log_priority::warn);
+        sdlpp::binary_log::clear();
+
+        SDLPP_BLOG(sdlpp::log_category::input, sdlpp::log_priority::debug, "hidden {}", 1);
+        SDLPP_BLOG(sdlpp::log_category::input, sdlpp::log_priority::warn, "shown {}", 2);
+        sdlpp::binary_log::set_enabled(false);
+        SDLPP_BLOG(sdlpp::log_category::input, sdlpp::log_priority::error, "paused {}", 3);
+        sdlpp::binary_log::set_enabled(true);
+
+        const auto messages = decode_messages();
+        REQUIRE(messages.size() == 1);
+        CHECK(messages[0] == "shown 2");
+        sdlpp::log_config::set_all_priorities(sdlpp::log_priority::info);
+    }
+
+    TEST_CASE("segments saved back to back decode together") {
+        sdlpp::log_config::set_all_priorities(sdlpp::log_priority::info);
+        sdlpp::binary_log::clear();
+
+        std::stringstream stream;
+        for (int i = 0; i < 3; ++i) {
+            SDLPP_BLOG(sdlpp::log_category::application, sdlpp::log_priority::info, "segment {}", i);
+            sdlpp::binary_log::save(stream);
+        }
+
+        auto log = sdlpp::binary_log_reader::read(stream);
+        REQUIRE(log.has_value());
+        REQUIRE(log->records().size() == 3);
+        for (std::size_t i = 0; i < 3; ++i) {
+            CHECK(log->format(log->records()[i]) == "segment " + std::to_string(i));
+        }
+    }
+
+    TEST_CASE("malformed input is rejected") {
+        std::stringstream garbage("not a log");
+        CHECK_FALSE(sdlpp::binary_log_reader::read(garbage).has_value());
+
+        sdlpp::binary_log::clear();
+        SDLPP_BLOG(sdlpp::log_category::application, sdlpp::log_priority::info, "cut {}", 1);
+        std::stringstream stream;
+        sdlpp::binary_log::save(stream);
+        std::string bytes = stream.str();
+        bytes.resize(bytes.size() - 2);
+        std::stringstream truncated(bytes);
+        CHECK_FALSE(sdlpp::binary_log_reader::read(truncated).has_value());
+    }
+
+    TEST_CASE("threads wrap their rings and drop when full") {
+        sdlpp::log_config::set_all_priorities(sdlpp::log_priority::info);
+        sdlpp::binary_log::clear();
+        const auto dropped_before = sdlpp::binary_log::dropped_records();
+        sdlpp::binary_log::set_buffer_size(4096);
+
+        std::stringstream stream;
+        std::thread worker([&stream] {
+            // 24-byte records: the ring wraps (with padding) while draining
+            for (int round = 0; round < 3; ++round) {
+                for (int i = 0; i < 100; ++i) {
+                    SDLPP_BLOG(sdlpp::log_category::application, sdlpp::log_priority::info,
+                               "r{} i{}", round, i);
+                }
+                sdlpp::binary_log::save(stream);
+            }
+            // 32-byte records without draining: about 4096 / 32 fit
+            for (std::int64_t i = 0; i < 200; ++i) {
+                SDLPP_BLOG(sdlpp::log_category::application, sdlpp::log_priority::info,
+                           "burst {} {}", i, i);
+            }
+        });
+        worker.join();
+        sdlpp::binary_log::save(stream);
+        sdlpp::binary_log::set_buffer_size(sdlpp::binary_log::default_buffer_bytes);
+
+        auto log = sdlpp::binary_log_reader::read(stream);
+        REQUIRE(log.has_value());
+        REQUIRE(log->records().size() > 300);
+        const auto kept = log->records().size() - 300;
+        CHECK(kept >= 127);
+        CHECK(kept <= 128);
+        CHECK(log->format(log->records()[299]) == "r2 i99");
+        CHECK(log->format(log->records()[300]) == "burst 0 0");
+        CHECK(log->format(log->records().back()) == "burst " + std::to_string(kept - 1) + " " +
+                                                      std::to_string(kept - 1));
+        CHECK(sdlpp::binary_log::dropped_records() == dropped_before + (200 - kept));
+    }
+
+    TEST_CASE("rings of exited threads are released after their records are saved") {
+        sdlpp::log_config::set_all_priorities(sdlpp::log_priority::info);
+        sdlpp::binary_log::clear();
+
+        std::stringstream stream;
+        for (int i = 0; i < 3; ++i) {
+            std::thread worker([i] {
+                SDLPP_BLOG(sdlpp::log_category::application, sdlpp::log_priority::info, "worker {}", i);
+            });
+            worker.join();
+            // Drains the exited thread's ring, then frees it
+            sdlpp::binary_log::save(stream);
+        }
+
+        auto log = sdlpp::binary_log_reader::read(stream);
+        REQUIRE(log.has_value());
+        REQUIRE(log->records().size() == 3);
+        for (std::size_t i = 0; i < 3; ++i) {
+            CHECK(log->format(log->records()[i]) == "worker " + std::to_string(i));
+        }
+        // Thread numbers are not reused once a ring is freed
+        CHECK(log->records()[0].thread != log->records()[1].thread);
+        CHECK(log->records()[1].thread != log->records()[2].thread);
+        CHECK(log->records()[0].thread != log->records()[2].thread);
+    }
+}
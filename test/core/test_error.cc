@@ -3,7 +3,10 @@
 
 #include <doctest/doctest.h>
 
+#include <sstream>
+#include <string>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 TEST_SUITE("error") {
@@ -246,4 +249,98 @@ TEST_SUITE("error") {
         
         sdlpp::clear_error();
     }
-}
\ No newline at end of file
+    
+    TEST_CASE("compact error type") {
+        static_assert(std::is_trivially_copyable_v<sdlpp::error>);
+        static_assert(sizeof(sdlpp::error) <= 16);
+        static_assert(!std::is_convertible_v<std::string, sdlpp::error>);
+        static_assert(std::is_constructible_v<sdlpp::error, std::string>);
+
+        SUBCASE("context only") {
+            auto r = sdlpp::expected<int, sdlpp::error>(
+                sdlpp::make_error(sdlpp::errc::invalid_handle, sdlpp::error_subsystem::render, "Invalid texture"));
+            REQUIRE_FALSE(r.has_value());
+            CHECK(r.error().code() == sdlpp::errc::invalid_handle);
+            CHECK(r.error().subsystem() == sdlpp::error_subsystem::render);
+            CHECK(r.error() == "Invalid texture");
+            CHECK(r.error().message() == "Invalid texture");
+        }
+
+        SUBCASE("captures SDL text at the failure") {
+            (void)sdlpp::set_error("Texture lost");
+            const auto e = sdlpp::error::from_sdl(sdlpp::error_subsystem::render);
+            (void)sdlpp::set_error("Something later");
+            CHECK(e.code() == sdlpp::errc::sdl_error);
+            CHECK(e.message() == "Texture lost");
+
+            (void)sdlpp::set_error("device removed");
+            const auto with_context = sdlpp::error::from_sdl(sdlpp::error_subsystem::audio, "Cannot open device");
+            CHECK(with_context.message() == "Cannot open device: device removed");
+        }
+
+        SUBCASE("no text and no context describes the code") {
+            const sdlpp::error e{sdlpp::errc::out_of_memory, sdlpp::error_subsystem::core};
+            CHECK(e.message() == "Out of memory");
+        }
+
+        SUBCASE("interoperates with string errors") {
+            const sdlpp::error from_string{std::string("Index out of bounds")};
+            CHECK(from_string.code() == sdlpp::errc::other);
+            CHECK(from_string == "Index out of bounds");
+
+            sdlpp::expected<int, std::string> legacy = sdlpp::expected<int, sdlpp::error>(
+                sdlpp::make_error(sdlpp::errc::invalid_argument, sdlpp::error_subsystem::render, "Bad rect"));
+            REQUIRE_FALSE(legacy.has_value());
+            CHECK(legacy.error() == "Bad rect");
+
+            std::ostringstream out;
+            out << from_string;
+            CHECK(out.str() == "Index out of bounds");
+
+            sdlpp::expected<int, std::string> formatted = sdlpp::make_unexpectedf("Draw failed:", from_string);
+            CHECK(formatted.error() == "Draw failed: Index out of bounds");
+        }
+
+        SUBCASE("long text is truncated") {
+            const std::string text(300, 'x');
+            const sdlpp::error e{text};
+            CHECK(e.message() == std::string(127, 'x'));
+        }
+
+        sdlpp::clear_error();
+    }
+
+    TEST_CASE("overwritten error text is reported, not misread") {
+        const sdlpp::error old_error{std::string("first failure")};
+        for (int i = 0; i < 300; ++i) {
+            const sdlpp::error newer{std::string("newer failure ") + std::to_string(i)};
+            (void)newer;
+        }
+        CHECK(old_error.message() == "Unknown error (error text no longer available)");
+
+        const sdlpp::error recent{std::string("recent failure")};
+        CHECK(recent.message() == "recent failure");
+    }
+
+    TEST_CASE("errors captured concurrently keep their text") {
+        std::vector<std::thread> threads;
+        std::vector<int> mismatches(4, 0);
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([t, &mismatches]() {
+                for (int i = 0; i < 50; ++i) {
+                    const std::string text = "thread " + std::to_string(t) + " failure " + std::to_string(i);
+                    const sdlpp::error e{text};
+                    if (e.message() != text) {
+                        ++mismatches[static_cast<std::size_t>(t)];
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (int count : mismatches) {
+            CHECK(count == 0);
+        }
+    }
+}
@@ -0,0 +1,81 @@
+#include <doctest/doctest.h>
+#include <sdlpp/core/frame_pacer.hh>
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+TEST_SUITE("frame_pacer") {
+    TEST_CASE("paces to the target period") {
+        sdlpp::frame_pacer pacer(100.0);
+        CHECK(pacer.period() == 10ms);
+
+        for (int i = 0; i < 21; ++i) {
+            pacer.wait();
+        }
+
+        auto stats = pacer.statistics();
+        CHECK(stats.frames == 20);
+        CHECK(stats.samples == 20);
+        // Generous bounds: CI machines are noisy, but drift-free pacing
+        // keeps the median on the period
+        CHECK(stats.p50 >= 9ms);
+        CHECK(stats.p50 <= 12ms);
+        CHECK(stats.min <= stats.p50);
+        CHECK(stats.p50 <= stats.p95);
+        CHECK(stats.p95 <= stats.p99);
+        CHECK(stats.p99 <= stats.max);
+    }
+
+    TEST_CASE("late frames count as missed and do not burst") {
+        sdlpp::frame_pacer pacer(200.0);
+        pacer.wait();
+        std::this_thread::sleep_for(30ms);
+        pacer.wait();
+        CHECK(pacer.missed_deadlines() == 1);
+
+        // The schedule restarted from the late frame, so the next wait is
+        // a full period rather than an immediate return
+        const auto frame = pacer.wait();
+        CHECK(frame >= 4ms);
+    }
+
+    TEST_CASE("reset does not sample the paused interval") {
+        sdlpp::frame_pacer pacer(200.0);
+        pacer.wait();
+        pacer.wait();
+        std::this_thread::sleep_for(50ms);
+
+        pacer.reset();
+        CHECK(pacer.wait() == 0ns);
+        auto stats = pacer.statistics();
+        CHECK(stats.samples == 1);
+        CHECK(stats.max < 50ms);
+        CHECK(pacer.missed_deadlines() == 0);
+    }
+
+    TEST_CASE("zero rate disables waiting") {
+        sdlpp::frame_pacer pacer(0.0);
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < 100; ++i) {
+            pacer.wait();
+        }
+        CHECK(std::chrono::steady_clock::now() - start < 50ms);
+        CHECK(pacer.missed_deadlines() == 0);
+    }
+
+    TEST_CASE("statistics reset") {
+        sdlpp::frame_pacer pacer(1000.0, 4);
+        for (int i = 0; i < 10; ++i) {
+            pacer.wait();
+        }
+        CHECK(pacer.statistics().samples == 4);
+        CHECK(pacer.statistics().frames == 9);
+
+        pacer.reset_statistics();
+        auto stats = pacer.statistics();
+        CHECK(stats.samples == 0);
+        CHECK(stats.frames == 0);
+        CHECK(stats.p50 == 0ns);
+    }
+}
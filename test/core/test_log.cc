@@ -52,6 +52,16 @@ struct log_capture {
     }
 };
 
+// Counts how often it is formatted into a log message
+struct format_counter {
+    int* count;
+};
+
+std::ostream& operator<<(std::ostream& os, const format_counter& counter) {
+    ++*counter.count;
+    return os << "counted";
+}
+
 TEST_SUITE("log") {
     
     TEST_CASE("basic logging") {
@@ -128,6 +138,110 @@ TEST_SUITE("log") {
         log_config::reset_priorities();
     }
     
+    TEST_CASE("disabled priorities skip formatting") {
+        log_capture capture;
+        int formatted = 0;
+
+        log_config::set_priority(log_category::application, log_priority::info);
+        CHECK_FALSE(logger::is_enabled(log_category::application, log_priority::debug));
+        SDLPP_LOG_DEBUG(log_category::application, format_counter{&formatted});
+        CHECK(formatted == 0);
+        CHECK(capture.entries.empty());
+
+        log_config::set_priority(log_category::application, log_priority::debug);
+        CHECK(logger::is_enabled(log_category::application, log_priority::debug));
+        SDLPP_LOG_DEBUG(log_category::application, format_counter{&formatted});
+        CHECK(formatted == 1);
+        REQUIRE(capture.entries.size() == 1);
+        CHECK(capture.has_message_containing("counted"));
+
+        log_config::reset_priorities();
+    }
+
+    TEST_CASE("cached priorities follow log_config") {
+        log_config::set_all_priorities(log_priority::warn);
+        CHECK_FALSE(logger::is_enabled(log_category::video, log_priority::info));
+        CHECK(logger::is_enabled(log_category::video, log_priority::warn));
+
+        log_config::set_priority(log_category::video, log_priority::trace);
+        CHECK(logger::is_enabled(log_category::video, log_priority::trace));
+        CHECK_FALSE(logger::is_enabled(log_category::audio, log_priority::info));
+
+        log_config::reset_priorities();
+        CHECK(logger::is_enabled(log_category::video, log_priority::critical));
+        CHECK(logger::is_enabled(log_category::video, log_priority::trace) ==
+              (log_config::get_priority(log_category::video) <= log_priority::trace));
+    }
+
+    TEST_CASE("rate-limited sites") {
+        log_capture capture;
+        log_config::set_priority(log_category::application, log_priority::info);
+
+        // Every n
+        capture.clear();
+        int formatted = 0;
+        for (int i = 0; i < 10; ++i) {
+            SDLPP_LOG_EVERY_N(log_category::application, log_priority::info, 4,
+                              "tick", i, format_counter{&formatted});
+        }
+        REQUIRE(capture.entries.size() == 3);
+        CHECK(formatted == 3);
+        CHECK(capture.entries[0].message.ends_with("tick 0 counted"));
+        CHECK(capture.entries[1].message.ends_with("tick 4 counted (suppressed 3 similar messages)"));
+        CHECK(capture.entries[2].message.ends_with("tick 8 counted (suppressed 3 similar messages)"));
+
+        // First n
+        capture.clear();
+        for (int i = 0; i < 5; ++i) {
+            SDLPP_LOG_FIRST_N(log_category::application, log_priority::info, 2, "start", i);
+        }
+        REQUIRE(capture.entries.size() == 2);
+        CHECK(capture.entries[1].message.ends_with("start 1"));
+
+        // Every ms
+        capture.clear();
+        for (int i = 0; i < 100; ++i) {
+            SDLPP_LOG_EVERY_MS(log_category::application, log_priority::info, 60000, "failed", i);
+        }
+        REQUIRE(capture.entries.size() == 1);
+        CHECK(capture.entries[0].message.ends_with("failed 0"));
+
+        // Disabled priorities are not counted
+        capture.clear();
+        for (int i = 0; i < 3; ++i) {
+            log_config::set_priority(log_category::application, i == 1 ? log_priority::debug : log_priority::info);
+            SDLPP_LOG_EVERY_N(log_category::application, log_priority::debug, 2, "call", i);
+        }
+        REQUIRE(capture.entries.size() == 1);
+        CHECK(capture.entries[0].message.ends_with("call 1"));
+
+        log_config::reset_priorities();
+    }
+
+    TEST_CASE("duplicate messages are summarized") {
+        log_capture capture;
+        log_config::set_priority(log_category::application, log_priority::info);
+
+        for (const char* text : {"same", "same", "same", "same", "same", "other", "other", "last"}) {
+            SDLPP_LOG_DEDUP(log_category::application, log_priority::warn, "message:", text);
+        }
+
+        REQUIRE(capture.entries.size() == 5);
+        CHECK(capture.entries[0].message.ends_with("message: same"));
+        CHECK(capture.entries[1].message.ends_with("previous message repeated (suppressed 4 duplicates)"));
+        CHECK(capture.entries[2].message.ends_with("message: other"));
+        CHECK(capture.entries[3].message.ends_with("previous message repeated (suppressed 1 duplicate)"));
+        CHECK(capture.entries[4].message.ends_with("message: last"));
+        CHECK(capture.entries[1].priority == log_priority::warn);
+
+        CHECK(detail::suppressed_note(4312, "duplicate") == " (suppressed 4,312 duplicates)");
+        CHECK(detail::suppressed_note(999, "duplicate") == " (suppressed 999 duplicates)");
+        CHECK(detail::suppressed_note(1234567, "duplicate") == " (suppressed 1,234,567 duplicates)");
+        CHECK(detail::suppressed_note(1, "duplicate") == " (suppressed 1 duplicate)");
+
+        log_config::reset_priorities();
+    }
+
     TEST_CASE("categories") {
         log_capture capture;
         log_config::set_all_priorities(log_priority::trace);
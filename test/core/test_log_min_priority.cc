@@ -0,0 +1,47 @@
+//
+// Log macros with a raised compile-time minimum. Built as its own test
+// executable with SDLPP_LOG_MIN_PRIORITY=SDL_LOG_PRIORITY_WARN.
+//
+
+#include <doctest/doctest.h>
+#include <sdlpp/core/log.hh>
+#include <string>
+#include <vector>
+
+using namespace sdlpp;
+
+namespace {
+    int evaluated = 0;
+
+    int evaluate() {
+        return ++evaluated;
+    }
+}
+
+TEST_SUITE("log min priority") {
+    TEST_CASE("sites below the compile-time minimum are removed") {
+        static_assert(log_min_priority == log_priority::warn);
+
+        std::vector <std::string> messages;
+        log_config::set_output_function([&messages](int, log_priority, const std::string& message) {
+            messages.push_back(message);
+        });
+        // Enabled at runtime, so only compile-time removal keeps them quiet
+        log_config::set_priority(log_category::application, log_priority::trace);
+
+        evaluated = 0;
+        for (int i = 0; i < 3; ++i) {
+            SDLPP_LOG_DEBUG(log_category::application, "plain", evaluate());
+            SDLPP_LOG_EVERY_N(log_category::application, log_priority::info, 2, "every n", evaluate());
+            SDLPP_LOG_EVERY_MS(log_category::application, log_priority::debug, 1000, "every ms", evaluate());
+            SDLPP_LOG_FIRST_N(log_category::application, log_priority::verbose, 1, "first n", evaluate());
+            SDLPP_LOG_DEDUP(log_category::application, log_priority::trace, "dedup", evaluate());
+        }
+
+        CHECK(evaluated == 0);
+        CHECK(messages.empty());
+
+        log_config::set_output_function(nullptr);
+        log_config::reset_priorities();
+    }
+}
@@ -0,0 +1,109 @@
+#include <doctest/doctest.h>
+#include <sdlpp/core/phase_profiler.hh>
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+TEST_SUITE("phase_profiler") {
+    TEST_CASE("nested phases form a tree") {
+        sdlpp::phase_profiler profiler("boot");
+        {
+            auto outer = profiler.begin("window");
+            {
+                auto inner = profiler.begin("renderer");
+                std::this_thread::sleep_for(2ms);
+            }
+            std::this_thread::sleep_for(1ms);
+        }
+        {
+            auto other = profiler.begin("assets");
+        }
+
+        const auto tree = profiler.phases();
+        REQUIRE(tree.size() == 3);
+        CHECK(tree[0].name == "window");
+        CHECK(tree[0].depth == 0);
+        CHECK(tree[1].name == "renderer");
+        CHECK(tree[1].depth == 1);
+        CHECK(tree[2].name == "assets");
+        CHECK(tree[2].depth == 0);
+
+        CHECK(tree[1].total >= 2ms);
+        CHECK(tree[0].total >= tree[1].total);
+        CHECK(tree[0].self == tree[0].total - tree[1].total);
+        CHECK(profiler.total() == tree[0].total + tree[2].total);
+    }
+
+    TEST_CASE("repeated phases are merged per parent") {
+        sdlpp::phase_profiler profiler;
+        {
+            auto fonts = profiler.begin("fonts");
+            for (int i = 0; i < 3; ++i) {
+                auto font = profiler.begin("load");
+            }
+        }
+        {
+            auto load = profiler.begin("load");
+        }
+
+        const auto tree = profiler.phases();
+        REQUIRE(tree.size() == 3);
+        CHECK(tree[1].name == "load");
+        CHECK(tree[1].count == 3);
+        CHECK(tree[2].name == "load");
+        CHECK(tree[2].depth == 0);
+        CHECK(tree[2].count == 1);
+    }
+
+    TEST_CASE("open phases are left out") {
+        sdlpp::phase_profiler profiler;
+        auto open = profiler.begin("running");
+        {
+            auto child = profiler.begin("child");
+        }
+        CHECK(profiler.phases().empty());
+        CHECK(profiler.total() == 0ns);
+
+        open.end();
+        CHECK(profiler.phases().size() == 2);
+    }
+
+    TEST_CASE("measure returns the callable's result") {
+        sdlpp::phase_profiler profiler;
+        const int value = profiler.measure("compute", [] { return 42; });
+        CHECK(value == 42);
+        REQUIRE(profiler.phases().size() == 1);
+        CHECK(profiler.phases()[0].name == "compute");
+    }
+
+    TEST_CASE("report and chrome trace") {
+        sdlpp::phase_profiler profiler("startup");
+        {
+            auto phase = profiler.begin("on_\"ready\"");
+        }
+
+        const auto report = profiler.report();
+        CHECK(report.find("startup") != std::string::npos);
+        CHECK(report.find("on_\"ready\"") != std::string::npos);
+
+        const auto trace = profiler.chrome_trace();
+        CHECK(trace.find("\"traceEvents\"") != std::string::npos);
+        CHECK(trace.find("\"name\":\"on_\\\"ready\\\"\"") != std::string::npos);
+        CHECK(trace.find("\"ph\":\"X\"") != std::string::npos);
+    }
+
+    TEST_CASE("clear discards phases opened before it") {
+        sdlpp::phase_profiler profiler;
+        auto stale = profiler.begin("stale");
+        profiler.clear();
+        {
+            auto fresh = profiler.begin("fresh");
+        }
+        stale.end();
+
+        const auto tree = profiler.phases();
+        REQUIRE(tree.size() == 1);
+        CHECK(tree[0].name == "fresh");
+    }
+}
@@ -0,0 +1,97 @@
+#include <doctest/doctest.h>
+#include <sdlpp/core/profiler.hh>
+#include <string>
+#include <thread>
+
+TEST_SUITE("profiler") {
+    TEST_CASE("zones are exported as complete events") {
+        sdlpp::profiler::clear();
+        {
+            const sdlpp::profile_zone outer("outer");
+            const sdlpp::profile_zone inner("inner \"quoted\"");
+        }
+
+        const auto trace = sdlpp::profiler::chrome_trace();
+        CHECK(trace.find("\"traceEvents\"") != std::string::npos);
+        CHECK(trace.find("\"name\":\"outer\",\"ph\":\"X\"") != std::string::npos);
+        CHECK(trace.find("\"name\":\"inner \\\"quoted\\\"\"") != std::string::npos);
+    }
+
+    TEST_CASE("export drains recorded events") {
+        sdlpp::profiler::clear();
+        sdlpp::profiler::record_zone("once", 1000, 3000);
+
+        const auto first = sdlpp::profiler::chrome_trace();
+        CHECK(first.find("\"name\":\"once\",\"ph\":\"X\",\"ts\":1.000,\"dur\":2.000") != std::string::npos);
+        CHECK(sdlpp::profiler::chrome_trace().find("\"once\"") == std::string::npos);
+    }
+
+    TEST_CASE("frame marks are counted and exported") {
+        sdlpp::profiler::clear();
+        const auto before = sdlpp::profiler::frame_count();
+        sdlpp::profiler::frame_mark();
+        sdlpp::profiler::frame_mark();
+        CHECK(sdlpp::profiler::frame_count() == before + 2);
+
+        const auto trace = sdlpp::profiler::chrome_trace();
+        CHECK(trace.find("\"name\":\"frame " + std::to_string(before + 1) + "\",\"ph\":\"i\"") != std::string::npos);
+    }
+
+    TEST_CASE("disabled profiler records nothing") {
+        sdlpp::profiler::clear();
+        sdlpp::profiler::set_enabled(false);
+        sdlpp::profiler::record_zone("hidden", 0, 1);
+        sdlpp::profiler::set_enabled(true);
+        CHECK(sdlpp::profiler::chrome_trace().find("\"hidden\"") == std::string::npos);
+    }
+
+    TEST_CASE("threads record into separate named buffers") {
+        sdlpp::profiler::clear();
+        std::thread worker([] {
+            sdlpp::profiler::set_thread_name("worker");
+            for (int i = 0; i < 100; ++i) {
+                const sdlpp::profile_zone zone("job");
+            }
+        });
+        worker.join();
+
+        const auto trace = sdlpp::profiler::chrome_trace();
+        CHECK(trace.find("\"args\":{\"name\":\"worker\"}") != std::string::npos);
+        CHECK(trace.find("\"name\":\"job\"") != std::string::npos);
+    }
+
+    TEST_CASE("buffers of exited threads are released once drained") {
+        sdlpp::profiler::clear();
+        for (int i = 0; i < 4; ++i) {
+            std::thread worker([] {
+                sdlpp::profiler::set_thread_name("short-lived");
+                sdlpp::profiler::record_zone("task", 0, 1);
+            });
+            worker.join();
+        }
+
+        // The first export still holds the exited threads' events...
+        const auto first = sdlpp::profiler::chrome_trace();
+        CHECK(first.find("\"args\":{\"name\":\"short-lived\"}") != std::string::npos);
+        CHECK(first.find("\"name\":\"task\"") != std::string::npos);
+
+        // ...after which their buffers, and thread names, are gone
+        CHECK(sdlpp::profiler::chrome_trace().find("short-lived") == std::string::npos);
+    }
+
+    TEST_CASE("full buffers drop and count events") {
+        sdlpp::profiler::clear();
+        const auto dropped_before = sdlpp::profiler::dropped_events();
+        sdlpp::profiler::set_buffer_capacity(4);
+        std::thread worker([] {
+            for (int i = 0; i < 10; ++i) {
+                sdlpp::profiler::record_zone("burst", 0, 1);
+            }
+        });
+        worker.join();
+        sdlpp::profiler::set_buffer_capacity(sdlpp::profiler::default_buffer_capacity);
+
+        CHECK(sdlpp::profiler::dropped_events() == dropped_before + 6);
+        sdlpp::profiler::clear();
+    }
+}
@@ -110,6 +110,66 @@ TEST_CASE("Performance counter") {
     }
 }
 
+TEST_CASE("Tick converter") {
+    using sdlpp::timer;
+
+    // Reference: whole seconds and sub-second remainder, exact while
+    // frequency * 10^9 fits in 64 bits
+    const auto reference = [](Uint64 ticks, Uint64 frequency) {
+        return (ticks / frequency) * 1'000'000'000 + (ticks % frequency) * 1'000'000'000 / frequency;
+    };
+
+    SUBCASE("Exact for common counter frequencies") {
+        const Uint64 frequencies[] = {
+            1'000'000'000,  // clock_gettime
+            10'000'000,     // QueryPerformanceCounter
+            24'000'000,     // Apple silicon
+            3'579'545,      // ACPI PM timer
+            2'903'997'000,  // Invariant TSC
+            1'000'000'007   // Prime: no common factor with 10^9
+        };
+        const Uint64 ticks[] = {
+            0, 1, 2, 999, 1'000'000, 123'456'789'012,
+            Uint64{1} << 40, (Uint64{1} << 52) + 12'345, Uint64{1} << 62
+        };
+
+        for (const Uint64 frequency : frequencies) {
+            const timer::tick_converter converter(frequency);
+            CHECK(converter.frequency() == frequency);
+            for (const Uint64 t : ticks) {
+                const Uint64 expected = reference(t, frequency);
+                if (expected / 1'000'000'000 != t / frequency) {
+                    continue;  // Result would not fit in 64 bits
+                }
+                CHECK(converter.to_nanoseconds(t) == expected);
+            }
+        }
+    }
+
+    SUBCASE("Large counts do not overflow") {
+        // (ticks * 10^9) wraps after ~18 s of a 1 GHz counter
+        const timer::tick_converter converter(1'000'000'000);
+        const Uint64 one_year = Uint64{365} * 24 * 3600 * 1'000'000'000;
+        CHECK(converter.to_nanoseconds(one_year) == one_year);
+
+        const timer::tick_converter tsc(3'000'000'000);
+        CHECK(tsc.to_nanoseconds(Uint64{3'000'000'000} * 86'400) == Uint64{86'400} * 1'000'000'000);
+    }
+
+    SUBCASE("Usable at compile time") {
+        constexpr timer::tick_converter converter(24'000'000);
+        static_assert(converter.to_nanoseconds(24'000'000) == 1'000'000'000);
+        static_assert(converter.to_nanoseconds(3) == 125);
+    }
+
+    SUBCASE("Raw ticks convert to clock time points") {
+        const Uint64 ticks = timer::high_resolution_clock::now_ticks();
+        const auto from_ticks = timer::high_resolution_clock::from_ticks(ticks);
+        const auto now = timer::high_resolution_clock::now();
+        CHECK(from_ticks <= now);
+    }
+}
+
 TEST_CASE("Delay functions") {
     using namespace sdlpp;
     using namespace std::chrono;
@@ -0,0 +1,228 @@
+#include <doctest/doctest.h>
+#include <sdlpp/core/timer_wheel.hh>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST_SUITE("timer_wheel") {
+    TEST_CASE("fires once the delay has elapsed") {
+        sdlpp::timer_wheel wheel(1ms);
+        int fired = 0;
+        wheel.schedule(10ms, [&] { ++fired; });
+        CHECK(wheel.size() == 1);
+
+        CHECK(wheel.advance(9ms) == 0);
+        CHECK(fired == 0);
+        CHECK(wheel.advance(1ms) == 1);
+        CHECK(fired == 1);
+        CHECK(wheel.empty());
+
+        wheel.advance(100ms);
+        CHECK(fired == 1);
+    }
+
+    TEST_CASE("partial ticks accumulate") {
+        sdlpp::timer_wheel wheel(1ms);
+        int fired = 0;
+        wheel.schedule(2ms, [&] { ++fired; });
+        for (int i = 0; i < 3; ++i) {
+            wheel.advance(600us);
+        }
+        CHECK(fired == 0);
+        wheel.advance(600us);
+        CHECK(fired == 1);
+    }
+
+    TEST_CASE("cancel and stale ids") {
+        sdlpp::timer_wheel wheel;
+        int fired = 0;
+        auto id = wheel.schedule(5ms, [&] { ++fired; });
+        CHECK(wheel.is_pending(id));
+        CHECK(wheel.cancel(id));
+        CHECK_FALSE(wheel.is_pending(id));
+        CHECK_FALSE(wheel.cancel(id));
+
+        // The node is reused, but the old id must not reach the new timer
+        auto reused = wheel.schedule(5ms, [&] { ++fired; });
+        CHECK(reused.index == id.index);
+        CHECK_FALSE(wheel.cancel(id));
+        CHECK(wheel.is_pending(reused));
+
+        wheel.advance(5ms);
+        CHECK(fired == 1);
+    }
+
+    TEST_CASE("periodic timers keep their phase") {
+        sdlpp::timer_wheel wheel(1ms);
+        std::vector <std::int64_t> times;
+        sdlpp::timer_wheel::timer_id id;
+        id = wheel.schedule_every(10ms, [&] {
+            times.push_back(std::chrono::duration_cast <std::chrono::milliseconds>(wheel.now()).count());
+            if (times.size() == 3) {
+                wheel.cancel(id);
+            }
+        });
+
+        for (int i = 0; i < 100; ++i) {
+            wheel.advance(1ms);
+        }
+        CHECK(times == std::vector <std::int64_t>{10, 20, 30});
+        CHECK(wheel.empty());
+    }
+
+    TEST_CASE("a long advance runs every period it covers") {
+        sdlpp::timer_wheel wheel(1ms);
+        std::vector <std::int64_t> times;
+        wheel.schedule_every(10ms, [&] {
+            times.push_back(std::chrono::duration_cast <std::chrono::milliseconds>(wheel.now()).count());
+        });
+        wheel.advance(55ms);
+        CHECK(times == std::vector <std::int64_t>{10, 20, 30, 40, 50});
+        wheel.advance(5ms);
+        CHECK(times.size() == 6);
+    }
+
+    TEST_CASE("distant timers cascade down the levels") {
+        sdlpp::timer_wheel wheel(1ms);
+        std::vector <std::int64_t> fired_at;
+        const std::int64_t delays[] = {63, 64, 65, 4095, 4096, 4097, 300'000, 20'000'000};
+        for (auto d : delays) {
+            wheel.schedule(std::chrono::milliseconds(d), [&] {
+                fired_at.push_back(std::chrono::duration_cast <std::chrono::milliseconds>(wheel.now()).count());
+            });
+        }
+
+        wheel.advance(std::chrono::milliseconds(25'000'000));
+        CHECK(fired_at == std::vector <std::int64_t>(std::begin(delays), std::end(delays)));
+    }
+
+    TEST_CASE("timers beyond the top level") {
+        sdlpp::timer_wheel wheel(1ns);
+        const auto far = std::chrono::nanoseconds(std::int64_t{1} << 37) + 12345ns;
+        std::int64_t fired_at = -1;
+        wheel.schedule(far, [&] { fired_at = wheel.now().count(); });
+
+        wheel.advance(far - 1ns);
+        CHECK(fired_at == -1);
+        wheel.advance(1ns);
+        CHECK(fired_at == far.count());
+    }
+
+    TEST_CASE("tolerance coalesces nearby deadlines") {
+        sdlpp::timer_wheel wheel(1ms);
+        std::vector <std::int64_t> fired_at;
+        for (int d = 97; d <= 103; ++d) {
+            wheel.schedule(std::chrono::milliseconds(d), [&] {
+                fired_at.push_back(std::chrono::duration_cast <std::chrono::milliseconds>(wheel.now()).count());
+            }, 16ms);
+        }
+
+        wheel.advance(200ms);
+        REQUIRE(fired_at.size() == 7);
+        for (auto t : fired_at) {
+            CHECK(t % 16 == 0);
+            CHECK(t >= 97);
+            CHECK(t <= 103 + 16);
+        }
+    }
+
+    TEST_CASE("callbacks may schedule and cancel") {
+        sdlpp::timer_wheel wheel(1ms);
+        std::vector <int> order;
+        sdlpp::timer_wheel::timer_id victim;
+        wheel.schedule(5ms, [&] {
+            order.push_back(1);
+            wheel.cancel(victim);
+            // Enough new timers to force the node pool to grow mid-callback
+            for (int i = 0; i < 100; ++i) {
+                wheel.schedule(1ms, [&order] { order.push_back(2); });
+            }
+        });
+        victim = wheel.schedule(5ms, [&] { order.push_back(3); });
+
+        wheel.advance(5ms);
+        CHECK(order == std::vector <int>{1});
+        wheel.advance(1ms);
+        CHECK(order.size() == 101);
+    }
+
+    TEST_CASE("time_until_next") {
+        sdlpp::timer_wheel wheel(1ms);
+        CHECK_FALSE(wheel.time_until_next().has_value());
+        wheel.schedule(30ms, [] {});
+        auto until = wheel.time_until_next();
+        REQUIRE(until.has_value());
+        CHECK(*until == 30ms);
+    }
+
+    TEST_CASE("accepts move-only and large callables") {
+        sdlpp::timer_wheel wheel(1ms);
+        int sum = 0;
+
+        auto boxed = std::make_unique <int>(5);
+        wheel.schedule(1ms, [&sum, value = std::move(boxed)] { sum += *value; });
+
+        // Too large for the node's inline storage: kept on the heap
+        std::array <int, 32> big{};
+        big.fill(1);
+        wheel.schedule_every(2ms, [&sum, big] { sum += big[0] + big[31]; });
+
+        std::function <void()> wrapped = [&sum] { sum += 100; };
+        wheel.schedule(3ms, wrapped);
+
+        // Growing the pool relocates pending callbacks
+        for (int i = 0; i < 1000; ++i) {
+            wheel.schedule(1h, [] {});
+        }
+
+        CHECK(wheel.advance(4ms) == 4);
+        CHECK(sum == 5 + 2 + 2 + 100);
+        wheel.clear();
+    }
+
+    TEST_CASE("matches a brute-force reference") {
+        sdlpp::timer_wheel wheel(1ms);
+        std::mt19937 rng(1234);
+        std::uniform_int_distribution <int> delay(1, 200'000);
+
+        struct expected_timer {
+            std::int64_t due;
+            std::int64_t fired = -1;
+            sdlpp::timer_wheel::timer_id id;
+            bool cancelled = false;
+        };
+        std::vector <expected_timer> timers(5000);
+        for (auto& t : timers) {
+            t.due = delay(rng);
+            t.id = wheel.schedule(std::chrono::milliseconds(t.due), [&t, &wheel] {
+                t.fired = std::chrono::duration_cast <std::chrono::milliseconds>(wheel.now()).count();
+            });
+        }
+        for (std::size_t i = 0; i < timers.size(); i += 7) {
+            timers[i].cancelled = wheel.cancel(timers[i].id);
+        }
+
+        std::uniform_int_distribution <int> step(1, 3000);
+        std::int64_t now = 0;
+        while (now <= 200'000) {
+            const int s = step(rng);
+            wheel.advance(std::chrono::milliseconds(s));
+            now += s;
+        }
+
+        for (const auto& t : timers) {
+            if (t.cancelled) {
+                CHECK(t.fired == -1);
+            } else {
+                CHECK(t.fired == t.due);
+            }
+        }
+        CHECK(wheel.empty());
+    }
+}
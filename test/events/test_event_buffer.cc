@@ -0,0 +1,100 @@
+#include <doctest/doctest.h>
+#include <sdlpp/events/event_buffer.hh>
+#include <sdlpp/core/core.hh>
+#include <array>
+#include <cstring>
+
+namespace {
+    void push_user_event(Sint32 code) {
+        SDL_Event raw;
+        std::memset(&raw, 0, sizeof(raw));
+        raw.type = SDL_EVENT_USER;
+        raw.user.type = SDL_EVENT_USER;
+        raw.user.code = code;
+        [[maybe_unused]] auto result = sdlpp::event_queue::push(sdlpp::event(raw));
+    }
+}
+
+TEST_SUITE("event_buffer") {
+    TEST_CASE("is_event_of matches event::is") {
+        CHECK(sdlpp::is_event_of<sdlpp::pen_motion_event>(sdlpp::event_type::pen_motion));
+        CHECK(sdlpp::is_event_of<sdlpp::mouse_button_event>(sdlpp::event_type::mouse_button_up));
+        CHECK_FALSE(sdlpp::is_event_of<sdlpp::keyboard_event>(sdlpp::event_type::mouse_motion));
+        CHECK(sdlpp::is_event_of<sdlpp::user_event>(sdlpp::event_type::user));
+    }
+
+    TEST_CASE("event_view accessors") {
+        SDL_Event raw;
+        std::memset(&raw, 0, sizeof(raw));
+        raw.type = SDL_EVENT_PEN_MOTION;
+        raw.pmotion.timestamp = 1234;
+        raw.pmotion.x = 10.5f;
+        raw.pmotion.y = 20.25f;
+
+        sdlpp::event_view view(raw);
+        CHECK(view.type() == sdlpp::event_type::pen_motion);
+        CHECK(view.timestamp() == 1234);
+        CHECK(view.is<sdlpp::pen_motion_event>());
+        CHECK_FALSE(view.is<sdlpp::mouse_motion_event>());
+        CHECK(view.pmotion().x == doctest::Approx(10.5f));
+        CHECK(&view.raw() == &raw);
+
+        auto full = view.to_event();
+        auto* pen = full.as<sdlpp::pen_motion_event>();
+        REQUIRE(pen != nullptr);
+        CHECK(pen->y == doctest::Approx(20.25f));
+    }
+
+    TEST_CASE("poll_batch drains in order") {
+        auto init = sdlpp::init(sdlpp::init_flags::events);
+        REQUIRE(init.was_init(sdlpp::init_flags::events));
+        sdlpp::event_queue::flush_range(sdlpp::event_type::first_event, sdlpp::event_type::last);
+
+        for (Sint32 i = 0; i < 5; ++i) {
+            push_user_event(i);
+        }
+
+        std::array<SDL_Event, 3> events{};
+        CHECK(sdlpp::event_queue::poll_batch(events, false) == 3);
+        CHECK(events[0].user.code == 0);
+        CHECK(events[2].user.code == 2);
+
+        CHECK(sdlpp::event_queue::poll_batch(events, false) == 2);
+        CHECK(events[1].user.code == 4);
+
+        CHECK(sdlpp::event_queue::poll_batch(events, false) == 0);
+        CHECK(sdlpp::event_queue::poll_batch(std::span<SDL_Event>{}, false) == 0);
+    }
+
+    TEST_CASE("event_buffer iteration") {
+        auto init = sdlpp::init(sdlpp::init_flags::events);
+        REQUIRE(init.was_init(sdlpp::init_flags::events));
+        sdlpp::event_queue::flush_range(sdlpp::event_type::first_event, sdlpp::event_type::last);
+
+        sdlpp::event_buffer buffer(4);
+        CHECK(buffer.capacity() == 4);
+        CHECK(buffer.empty());
+
+        for (Sint32 i = 0; i < 6; ++i) {
+            push_user_event(i);
+        }
+
+        REQUIRE(buffer.poll(false) == 4);
+        CHECK(buffer.full());
+
+        Sint32 expected = 0;
+        for (auto e : buffer) {
+            CHECK(e.type() == sdlpp::event_type::user);
+            CHECK(e.user().code == expected++);
+        }
+        CHECK(buffer.end() - buffer.begin() == 4);
+
+        REQUIRE(buffer.poll(false) == 2);
+        CHECK_FALSE(buffer.full());
+        CHECK(buffer[1].user().code == 5);
+        CHECK(buffer.raw().size() == 2);
+
+        buffer.clear();
+        CHECK(buffer.empty());
+    }
+}
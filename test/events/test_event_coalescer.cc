@@ -0,0 +1,187 @@
+#include <doctest/doctest.h>
+#include <sdlpp/events/event_coalescer.hh>
+#include <array>
+#include <cstring>
+#include <vector>
+
+namespace {
+    SDL_Event make_raw(Uint32 type, Uint64 timestamp = 0) {
+        SDL_Event raw;
+        std::memset(&raw, 0, sizeof(raw));
+        raw.type = type;
+        raw.common.timestamp = timestamp;
+        return raw;
+    }
+
+    SDL_Event mouse_motion(float x, float y, float xrel, float yrel) {
+        auto e = make_raw(SDL_EVENT_MOUSE_MOTION);
+        e.motion.x = x;
+        e.motion.y = y;
+        e.motion.xrel = xrel;
+        e.motion.yrel = yrel;
+        return e;
+    }
+
+    SDL_Event pen_motion(SDL_PenID pen, float x, float y) {
+        auto e = make_raw(SDL_EVENT_PEN_MOTION);
+        e.pmotion.which = pen;
+        e.pmotion.x = x;
+        e.pmotion.y = y;
+        return e;
+    }
+
+    SDL_Event pen_pressure(SDL_PenID pen, float value) {
+        auto e = make_raw(SDL_EVENT_PEN_AXIS);
+        e.paxis.which = pen;
+        e.paxis.axis = SDL_PEN_AXIS_PRESSURE;
+        e.paxis.value = value;
+        return e;
+    }
+}
+
+TEST_SUITE("event_coalescer") {
+    TEST_CASE("mouse motion sums deltas and keeps the latest position") {
+        std::vector<SDL_Event> events = {
+            mouse_motion(1, 1, 1, 1),
+            mouse_motion(3, 2, 2, 1),
+            mouse_motion(6, 4, 3, 2),
+        };
+
+        sdlpp::event_coalescer coalescer;
+        REQUIRE(coalescer.apply(events) == 1);
+        CHECK(events[0].motion.x == doctest::Approx(6.0f));
+        CHECK(events[0].motion.y == doctest::Approx(4.0f));
+        CHECK(events[0].motion.xrel == doctest::Approx(6.0f));
+        CHECK(events[0].motion.yrel == doctest::Approx(4.0f));
+        CHECK(coalescer.merged_events() == 2);
+    }
+
+    TEST_CASE("barriers are never crossed") {
+        std::vector<SDL_Event> events = {
+            mouse_motion(1, 1, 1, 1),
+            make_raw(SDL_EVENT_MOUSE_BUTTON_DOWN),
+            mouse_motion(2, 2, 1, 1),
+            mouse_motion(3, 3, 1, 1),
+        };
+
+        sdlpp::event_coalescer coalescer;
+        REQUIRE(coalescer.apply(events) == 3);
+        CHECK(events[0].type == SDL_EVENT_MOUSE_MOTION);
+        CHECK(events[1].type == SDL_EVENT_MOUSE_BUTTON_DOWN);
+        CHECK(events[2].motion.x == doctest::Approx(3.0f));
+        CHECK(events[2].motion.xrel == doctest::Approx(2.0f));
+    }
+
+    TEST_CASE("window geometry keeps the latest size per window") {
+        auto resize = [](SDL_WindowID id, Sint32 w, Sint32 h) {
+            auto e = make_raw(SDL_EVENT_WINDOW_RESIZED);
+            e.window.windowID = id;
+            e.window.data1 = w;
+            e.window.data2 = h;
+            return e;
+        };
+
+        std::vector<SDL_Event> events = {
+            resize(1, 100, 100), resize(1, 200, 150), resize(2, 50, 50), resize(2, 60, 70),
+        };
+
+        sdlpp::event_coalescer coalescer;
+        REQUIRE(coalescer.apply(events) == 2);
+        CHECK(events[0].window.windowID == 1);
+        CHECK(events[0].window.data1 == 200);
+        CHECK(events[1].window.windowID == 2);
+        CHECK(events[1].window.data2 == 70);
+    }
+
+    TEST_CASE("interleaved streams keep their order") {
+        auto resize = [](Uint64 timestamp, Sint32 w) {
+            auto e = make_raw(SDL_EVENT_WINDOW_RESIZED, timestamp);
+            e.window.windowID = 1;
+            e.window.data1 = w;
+            return e;
+        };
+        auto motion = [](Uint64 timestamp, float x) {
+            auto e = mouse_motion(x, 0, 1, 0);
+            e.common.timestamp = timestamp;
+            return e;
+        };
+
+        std::vector<SDL_Event> events = {
+            motion(1, 1), resize(2, 100), motion(3, 2), motion(4, 3), resize(5, 200), resize(6, 300),
+        };
+
+        sdlpp::event_coalescer coalescer;
+        REQUIRE(coalescer.apply(events) == 4);
+        CHECK(events[0].type == SDL_EVENT_MOUSE_MOTION);
+        CHECK(events[0].motion.x == doctest::Approx(1.0f));
+        CHECK(events[1].window.data1 == 100);
+        CHECK(events[2].motion.x == doctest::Approx(3.0f));
+        CHECK(events[2].motion.xrel == doctest::Approx(2.0f));
+        CHECK(events[3].window.data1 == 300);
+        for (std::size_t i = 1; i < 4; ++i) {
+            CHECK(events[i - 1].common.timestamp < events[i].common.timestamp);
+        }
+        CHECK(coalescer.merged_events() == 2);
+    }
+
+    TEST_CASE("disabled families pass through") {
+        std::vector<SDL_Event> events = {
+            mouse_motion(1, 1, 1, 1),
+            mouse_motion(2, 2, 1, 1),
+        };
+
+        sdlpp::event_coalescer coalescer(sdlpp::coalesce_flags::window_geometry);
+        CHECK(coalescer.apply(events) == 2);
+        CHECK(sdlpp::has_flag(sdlpp::coalesce_flags::all, sdlpp::coalesce_flags::touch_motion));
+    }
+
+    TEST_CASE("pen history preserves merged samples") {
+        std::vector<SDL_Event> events = {
+            pen_motion(7, 1, 1),
+            pen_pressure(7, 0.25f),
+            pen_motion(7, 2, 2),
+            pen_motion(7, 2.5f, 2.5f),
+            pen_pressure(7, 0.5f),
+            pen_motion(7, 3, 3),
+        };
+
+        sdlpp::event_coalescer coalescer(sdlpp::coalesce_flags::all, true);
+        REQUIRE(coalescer.apply(events) == 5);
+        CHECK(events[2].pmotion.x == doctest::Approx(2.5f));
+        CHECK(events[3].paxis.value == doctest::Approx(0.5f));
+        CHECK(events[4].pmotion.x == doctest::Approx(3.0f));
+
+        auto history = coalescer.pen_history();
+        REQUIRE(history.size() == 6);
+        CHECK(history[0].pressure == doctest::Approx(0.0f));
+        CHECK(history[2].x == doctest::Approx(2.0f));
+        CHECK(history[2].pressure == doctest::Approx(0.25f));
+        CHECK(history[3].x == doctest::Approx(2.5f));
+        CHECK(history[5].x == doctest::Approx(3.0f));
+        CHECK(history[5].pressure == doctest::Approx(0.5f));
+
+        coalescer.clear_pen_history();
+        CHECK(coalescer.pen_history().empty());
+    }
+
+    TEST_CASE("touch motion sums deltas per finger") {
+        auto finger = [](SDL_FingerID id, float x, float dx) {
+            auto e = make_raw(SDL_EVENT_FINGER_MOTION);
+            e.tfinger.fingerID = id;
+            e.tfinger.x = x;
+            e.tfinger.dx = dx;
+            return e;
+        };
+
+        std::vector<SDL_Event> events = {
+            finger(1, 0.1f, 0.1f), finger(1, 0.3f, 0.2f), finger(2, 0.5f, 0.0f), finger(1, 0.4f, 0.1f),
+        };
+
+        sdlpp::event_coalescer coalescer;
+        REQUIRE(coalescer.apply(events) == 3);
+        CHECK(events[0].tfinger.x == doctest::Approx(0.3f));
+        CHECK(events[0].tfinger.dx == doctest::Approx(0.3f));
+        CHECK(events[1].tfinger.fingerID == 2);
+        CHECK(events[2].tfinger.dx == doctest::Approx(0.1f));
+    }
+}
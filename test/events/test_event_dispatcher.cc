@@ -0,0 +1,109 @@
+#include <doctest/doctest.h>
+#include <sdlpp/events/event_dispatcher.hh>
+#include <cstring>
+
+namespace {
+    SDL_Event make_raw(Uint32 type) {
+        SDL_Event raw;
+        std::memset(&raw, 0, sizeof(raw));
+        raw.type = type;
+        return raw;
+    }
+
+    int free_handler_calls = 0;
+
+    void free_handler(const sdlpp::mouse_button_event&) {
+        ++free_handler_calls;
+    }
+}
+
+TEST_SUITE("event_dispatcher") {
+    TEST_CASE("routes to the handler of the matching struct") {
+        sdlpp::event_dispatcher dispatcher;
+
+        int keys = 0;
+        int* keys_ptr = &keys;
+        float last_x = 0.0f;
+        float* last_x_ptr = &last_x;
+
+        dispatcher.on<sdlpp::keyboard_event>([keys_ptr](const sdlpp::keyboard_event& e) {
+            if (e.key == SDLK_SPACE) ++*keys_ptr;
+        });
+        dispatcher.on<sdlpp::pen_motion_event>([last_x_ptr](const sdlpp::pen_motion_event& e) {
+            *last_x_ptr = e.x;
+        });
+
+        auto key = make_raw(SDL_EVENT_KEY_DOWN);
+        key.key.key = SDLK_SPACE;
+        CHECK(dispatcher.dispatch(key));
+        key.type = SDL_EVENT_KEY_UP;
+        CHECK(dispatcher.dispatch(key));
+        CHECK(keys == 2);
+
+        auto pen = make_raw(SDL_EVENT_PEN_MOTION);
+        pen.pmotion.x = 12.5f;
+        CHECK(dispatcher.dispatch(sdlpp::event_view(pen)));
+        CHECK(last_x == doctest::Approx(12.5f));
+
+        CHECK_FALSE(dispatcher.dispatch(make_raw(SDL_EVENT_MOUSE_MOTION)));
+        CHECK(dispatcher.has_handler(sdlpp::event_type::key_up));
+        CHECK_FALSE(dispatcher.has_handler(sdlpp::event_type::mouse_motion));
+    }
+
+    TEST_CASE("single type registration and removal") {
+        sdlpp::event_dispatcher dispatcher;
+        free_handler_calls = 0;
+
+        dispatcher.on<sdlpp::mouse_button_event>(sdlpp::event_type::mouse_button_down, &free_handler);
+
+        CHECK(dispatcher.dispatch(make_raw(SDL_EVENT_MOUSE_BUTTON_DOWN)));
+        CHECK_FALSE(dispatcher.dispatch(make_raw(SDL_EVENT_MOUSE_BUTTON_UP)));
+        CHECK(free_handler_calls == 1);
+
+        dispatcher.remove(sdlpp::event_type::mouse_button_down);
+        CHECK_FALSE(dispatcher.dispatch(make_raw(SDL_EVENT_MOUSE_BUTTON_DOWN)));
+        CHECK(free_handler_calls == 1);
+    }
+
+    TEST_CASE("single type registration rejects a mismatched struct") {
+        sdlpp::event_dispatcher dispatcher;
+        free_handler_calls = 0;
+
+        dispatcher.on<sdlpp::mouse_button_event>(sdlpp::event_type::mouse_motion, &free_handler);
+        CHECK_FALSE(dispatcher.has_handler(sdlpp::event_type::mouse_motion));
+        CHECK_FALSE(dispatcher.dispatch(make_raw(SDL_EVENT_MOUSE_MOTION)));
+        CHECK(free_handler_calls == 0);
+
+        // Custom event types carry no fixed struct
+        const auto custom = static_cast<sdlpp::event_type>(SDL_EVENT_USER + 3);
+        dispatcher.on<sdlpp::mouse_button_event>(custom, &free_handler);
+        CHECK(dispatcher.has_handler(custom));
+    }
+
+    TEST_CASE("user events and fallback") {
+        sdlpp::event_dispatcher dispatcher;
+
+        Sint32 last_code = -1;
+        Sint32* code_ptr = &last_code;
+        int unhandled = 0;
+        int* unhandled_ptr = &unhandled;
+
+        dispatcher.on<sdlpp::user_event>([code_ptr](const sdlpp::user_event& e) {
+            *code_ptr = e.code;
+        });
+        dispatcher.on<sdlpp::common_event>([unhandled_ptr](const sdlpp::common_event&) {
+            ++*unhandled_ptr;
+        });
+
+        auto user = make_raw(SDL_EVENT_USER + 5);
+        user.user.code = 7;
+        CHECK(dispatcher.dispatch(user));
+        CHECK(last_code == 7);
+
+        CHECK(dispatcher.dispatch(make_raw(SDL_EVENT_WINDOW_SHOWN)));
+        CHECK(unhandled == 1);
+
+        dispatcher.clear();
+        CHECK_FALSE(dispatcher.dispatch(user));
+    }
+}
@@ -0,0 +1,114 @@
+#include <doctest/doctest.h>
+#include <sdlpp/events/input_trace.hh>
+#include <sdlpp/core/core.hh>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+namespace {
+    SDL_Event make_motion(Uint64 timestamp, float x, float y) {
+        SDL_Event e{};
+        e.type = SDL_EVENT_MOUSE_MOTION;
+        e.motion.timestamp = timestamp;
+        e.motion.x = x;
+        e.motion.y = y;
+        e.motion.xrel = 1.0f;
+        return e;
+    }
+
+    std::filesystem::path trace_path(const char* name) {
+        return std::filesystem::temp_directory_path() / name;
+    }
+}
+
+TEST_SUITE("input_trace") {
+    TEST_CASE("round trip through a trace file") {
+        const auto path = trace_path("sdlpp_test_round_trip.irt");
+        {
+            auto recorder = sdlpp::input_recorder::create(path);
+            REQUIRE(recorder.has_value());
+
+            recorder->record(make_motion(1'000'000, 10.0f, 20.0f));
+
+            SDL_Event key{};
+            key.type = SDL_EVENT_KEY_DOWN;
+            key.key.timestamp = 3'000'000;
+            key.key.scancode = SDL_SCANCODE_A;
+            key.key.key = SDLK_A;
+            key.key.down = true;
+            recorder->record(key);
+
+            SDL_Event text{};
+            text.type = SDL_EVENT_TEXT_INPUT;
+            text.text.timestamp = 3'500'000;
+            text.text.text = "hello";
+            recorder->record(text);
+
+            CHECK(recorder->event_count() == 3);
+            // Header plus three compact records, far below 3 * sizeof(SDL_Event)
+            CHECK(recorder->byte_count() < 3 * sizeof(SDL_Event) / 2);
+            REQUIRE(recorder->stop().has_value());
+        }
+
+        auto replayer = sdlpp::input_replayer::load(path);
+        std::filesystem::remove(path);
+        REQUIRE(replayer.has_value());
+        CHECK(replayer->size() == 3);
+        CHECK(replayer->duration() == std::chrono::nanoseconds(2'500'000));
+    }
+
+    TEST_CASE("fast-forward replay pushes events per virtual frame") {
+        auto init = sdlpp::init(sdlpp::init_flags::events);
+        REQUIRE(init.was_init(sdlpp::init_flags::events));
+        SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+        const auto path = trace_path("sdlpp_test_fast_forward.irt");
+        {
+            auto recorder = sdlpp::input_recorder::create(path);
+            REQUIRE(recorder.has_value());
+            recorder->record(make_motion(5'000'000, 1.0f, 2.0f));
+            recorder->record(make_motion(15'000'000, 3.0f, 4.0f));
+            recorder->record(make_motion(35'000'000, 5.0f, 6.0f));
+        }
+
+        auto replayer = sdlpp::input_replayer::load(path);
+        std::filesystem::remove(path);
+        REQUIRE(replayer.has_value());
+
+        replayer->set_fast_forward(std::chrono::milliseconds(10));
+        replayer->start();
+
+        // Offsets are 0, 10 and 30 ms: frames at 0, 10, 20, 30 ms
+        auto pushed = replayer->update();
+        REQUIRE(pushed.has_value());
+        CHECK(*pushed == 1);
+        CHECK(*replayer->update() == 1);
+        CHECK(*replayer->update() == 0);
+        CHECK_FALSE(replayer->finished());
+        CHECK(*replayer->update() == 1);
+        CHECK(replayer->finished());
+
+        std::vector<SDL_Event> events(8);
+        const int count = SDL_PeepEvents(events.data(), 8, SDL_GETEVENT,
+                                         SDL_EVENT_MOUSE_MOTION, SDL_EVENT_MOUSE_MOTION);
+        REQUIRE(count == 3);
+        CHECK(events[0].motion.x == 1.0f);
+        CHECK(events[1].motion.y == 4.0f);
+        CHECK(events[2].motion.x == 5.0f);
+        CHECK(events[2].motion.xrel == 1.0f);
+    }
+
+    TEST_CASE("rejects malformed traces") {
+        const std::vector<std::uint8_t> garbage = {'n', 'o', 'p', 'e'};
+        CHECK_FALSE(sdlpp::input_replayer::from_bytes(garbage).has_value());
+
+        std::vector<std::uint8_t> truncated = {'S', 'D', 'L', 'P', 'P', 'I', 'R', 'T', 1, 0x80};
+        CHECK_FALSE(sdlpp::input_replayer::from_bytes(truncated).has_value());
+
+        std::vector<std::uint8_t> empty = {'S', 'D', 'L', 'P', 'P', 'I', 'R', 'T', 1};
+        auto replayer = sdlpp::input_replayer::from_bytes(empty);
+        REQUIRE(replayer.has_value());
+        CHECK(replayer->finished());
+    }
+}
@@ -0,0 +1,208 @@
+#include <doctest/doctest.h>
+#include <sdlpp/events/main_thread_channel.hh>
+#include <sdlpp/core/core.hh>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+TEST_SUITE("main_thread_channel") {
+    TEST_CASE("capacity rounds up and full channel rejects sends") {
+        sdlpp::main_thread_channel<int> channel(5);
+        CHECK(channel.capacity() == 8);
+        CHECK(channel.empty());
+
+        for (int i = 0; i < 8; ++i) {
+            CHECK(channel.try_send(i));
+        }
+        CHECK_FALSE(channel.try_send(99));
+        CHECK(channel.dropped() == 1);
+        CHECK(channel.size_approx() == 8);
+
+        std::vector<int> out;
+        CHECK(channel.drain_into(out) == 8);
+        CHECK(out == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7});
+        CHECK(channel.empty());
+
+        // Ring wraps around
+        CHECK(channel.try_send(8));
+        out.clear();
+        CHECK(channel.drain_into(out) == 1);
+        CHECK(out.front() == 8);
+    }
+
+    TEST_CASE("move-only values") {
+        sdlpp::main_thread_channel<std::unique_ptr<int>> channel(4);
+        CHECK(channel.try_send(std::make_unique<int>(42)));
+        CHECK(channel.try_emplace(new int(7)));
+
+        int sum = 0;
+        channel.drain([&](std::unique_ptr<int>&& p) { sum += *p; });
+        CHECK(sum == 49);
+    }
+
+    TEST_CASE("one wake-up per drain cycle") {
+        auto init = sdlpp::init(sdlpp::init_flags::events);
+        REQUIRE(init.was_init(sdlpp::init_flags::events));
+        sdlpp::event_queue::flush(sdlpp::event_type::user);
+
+        sdlpp::main_thread_channel<int> channel(64);
+        CHECK(channel.wake_type() == sdlpp::event_type::user);
+
+        for (int i = 0; i < 10; ++i) {
+            CHECK(channel.try_send(i));
+        }
+        CHECK(channel.wake_count() == 1);
+
+        SDL_Event e;
+        REQUIRE(SDL_PollEvent(&e));
+        CHECK(channel.is_wake_event(e));
+        CHECK_FALSE(SDL_HasEvent(SDL_EVENT_USER));
+
+        CHECK(channel.drain([](int&&) {}) == 10);
+
+        CHECK(channel.try_send(10));
+        CHECK(channel.wake_count() == 2);
+        sdlpp::event_queue::flush(sdlpp::event_type::user);
+        channel.drain([](int&&) {});
+    }
+
+    TEST_CASE("partial drain re-arms the wake-up") {
+        auto init = sdlpp::init(sdlpp::init_flags::events);
+        REQUIRE(init.was_init(sdlpp::init_flags::events));
+        sdlpp::event_queue::flush(sdlpp::event_type::user);
+
+        sdlpp::main_thread_channel<int> channel(16);
+        for (int i = 0; i < 4; ++i) {
+            CHECK(channel.try_send(i));
+        }
+        CHECK(channel.drain([](int&&) {}, 2) == 2);
+        CHECK(channel.wake_count() == 2);
+        CHECK(channel.drain([](int&&) {}) == 2);
+        sdlpp::event_queue::flush(sdlpp::event_type::user);
+    }
+
+    TEST_CASE("concurrent producers") {
+        auto init = sdlpp::init(sdlpp::init_flags::events);
+        REQUIRE(init.was_init(sdlpp::init_flags::events));
+
+        constexpr int producers = 4;
+        constexpr int per_producer = 5000;
+
+        sdlpp::main_thread_channel<int> channel(1024);
+        std::atomic<bool> go{false};
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                while (!go.load()) {}
+                for (int i = 0; i < per_producer; ++i) {
+                    while (!channel.try_send(p * per_producer + i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        go.store(true);
+        std::vector<int> received;
+        received.reserve(producers * per_producer);
+        while (received.size() < static_cast<std::size_t>(producers * per_producer)) {
+            channel.drain_into(received);
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        sdlpp::event_queue::flush(sdlpp::event_type::user);
+
+        std::vector<bool> seen(producers * per_producer, false);
+        for (int v : received) {
+            seen[static_cast<std::size_t>(v)] = true;
+        }
+        CHECK(std::all_of(seen.begin(), seen.end(), [](bool b) { return b; }));
+    }
+
+    TEST_CASE("every send is drained after the last wake-up") {
+        auto init = sdlpp::init(sdlpp::init_flags::events);
+        REQUIRE(init.was_init(sdlpp::init_flags::events));
+        sdlpp::event_queue::flush(sdlpp::event_type::user);
+
+        constexpr int producers = 4;
+        constexpr int per_producer = 20000;
+        constexpr auto total = static_cast<std::size_t>(producers * per_producer);
+
+        // Small ring: producers keep hitting full and empty transitions
+        sdlpp::main_thread_channel<int> channel(64);
+        std::atomic<bool> go{false};
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                while (!go.load()) {}
+                for (int i = 0; i < per_producer; ++i) {
+                    while (!channel.try_send(p * per_producer + i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        go.store(true);
+        std::vector<int> received;
+        received.reserve(total);
+        bool missed_wake = false;
+        while (received.size() < total) {
+            // Drain only when woken: a lost wake-up stalls here
+            SDL_Event e;
+            if (!SDL_WaitEventTimeout(&e, 2000)) {
+                missed_wake = true;
+                break;
+            }
+            if (channel.is_wake_event(e)) {
+                channel.drain_into(received);
+            }
+        }
+        while (received.size() < total) {
+            channel.drain_into(received);  // Unblock producers after a failure
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        sdlpp::event_queue::flush(sdlpp::event_type::user);
+
+        CHECK_FALSE(missed_wake);
+        CHECK(channel.empty());
+        REQUIRE(received.size() == total);
+
+        // Every value arrives once, and each producer's values in order
+        std::vector<int> next(producers, 0);
+        bool in_order = true;
+        for (int v : received) {
+            auto& expected_next = next[static_cast<std::size_t>(v / per_producer)];
+            in_order = in_order && v % per_producer == expected_next;
+            ++expected_next;
+        }
+        CHECK(in_order);
+    }
+
+    TEST_CASE("a throwing callback releases its value") {
+        sdlpp::main_thread_channel<std::shared_ptr<int>> channel(4);
+        auto tracked = std::make_shared<int>(1);
+        CHECK(channel.try_send(tracked));
+        CHECK(channel.try_send(std::make_shared<int>(2)));
+
+        bool threw = false;
+        try {
+            channel.drain([](std::shared_ptr<int>&&) { throw 1; });
+        } catch (int) {
+            threw = true;
+        }
+        CHECK(threw);
+        CHECK(tracked.use_count() == 1);
+
+        std::vector<std::shared_ptr<int>> rest;
+        CHECK(channel.drain_into(rest) == 1);
+        CHECK(*rest.front() == 2);
+        CHECK(channel.empty());
+        sdlpp::event_queue::flush(sdlpp::event_type::user);
+    }
+}
@@ -0,0 +1,232 @@
+//
+// Font cache snapshot tests
+//
+
+#include <doctest/doctest.h>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "sdlpp/font/font_cache.hh"
+#include "sdlpp/video/renderer.hh"
+#include "sdlpp/video/surface.hh"
+#include "test_font_data.hh"
+
+using namespace sdlpp;
+
+namespace {
+    // Snapshot layout offsets, see font_cache.cc
+    constexpr std::size_t header_size = 64;
+    constexpr std::size_t version_offset = 8;
+    constexpr std::size_t font_key_offset = 16;
+    constexpr std::size_t glyph_count_offset = 36;
+    constexpr std::size_t page_offset_offset = 48;
+    constexpr std::size_t glyph_record_size = 44;
+    constexpr std::size_t record_page_offset = 4;
+    constexpr std::size_t record_x_offset = 8;
+
+    template<typename T>
+    T read_field(const std::vector<std::uint8_t>& data, std::size_t offset) {
+        T value{};
+        std::memcpy(&value, data.data() + offset, sizeof(value));
+        return value;
+    }
+
+    template<typename T>
+    void write_field(std::vector<std::uint8_t>& data, std::size_t offset, T value) {
+        std::memcpy(data.data() + offset, &value, sizeof(value));
+    }
+
+    // Software renderer drawing into an RGBA surface
+    struct software_target {
+        surface surf;
+        renderer rend;
+    };
+
+    std::optional<software_target> make_target() {
+        auto surf = surface::create_rgb(64, 64, pixel_format_enum::RGBA8888);
+        if (!surf) return std::nullopt;
+        auto rend = renderer::create_software(surf->get());
+        if (!rend) return std::nullopt;
+        return software_target{std::move(*surf), std::move(*rend)};
+    }
+
+    // Snapshot of 'A', 'B' and '.' at 16 px plus 'M' at 24 px
+    std::vector<std::uint8_t> make_snapshot(renderer& rend, font::font& fnt) {
+        font::font_cache cache(rend, fnt);
+        cache.store_glyph(U'A');
+        cache.store_glyph(U'B');
+        cache.store_glyph(U'.');
+        cache.store_glyph(U'M', 24.0f, font::text_style::normal);
+        return cache.save_snapshot();
+    }
+}
+
+TEST_SUITE("font cache snapshot") {
+    TEST_CASE("round trip restores every glyph set") {
+        auto target = make_target();
+        REQUIRE(target.has_value());
+        auto fnt = font::font::load(test::test_font_data());
+        REQUIRE(fnt.has_value());
+        fnt->set_size(16.0f);
+
+        font::font_cache original(target->rend, *fnt);
+        original.store_glyph(U'A');
+        original.store_glyph(U'B');
+        original.store_glyph(U'.');
+        original.store_glyph(U'M', 24.0f, font::text_style::normal);
+        const auto snapshot = original.save_snapshot();
+        REQUIRE(snapshot.size() > header_size);
+        CHECK(read_field<std::uint32_t>(snapshot, glyph_count_offset) == 4);
+        CHECK(read_field<std::uint64_t>(snapshot, page_offset_offset) % 64 == 0);
+
+        font::font_cache restored(target->rend, *fnt);
+        auto result = restored.load_snapshot(std::span<const std::uint8_t>(snapshot));
+        REQUIRE(result.has_value());
+        CHECK(restored.glyph_count() == 4);
+        CHECK(restored.atlas().page_count() == original.atlas().page_count());
+
+        for (char32_t cp : {U'A', U'B', U'.'}) {
+            const auto* a = original.find_glyph(cp);
+            const auto* b = restored.find_glyph(cp);
+            REQUIRE(a != nullptr);
+            REQUIRE(b != nullptr);
+            CHECK(a->slot.page == b->slot.page);
+            CHECK(a->slot.x == b->slot.x);
+            CHECK(a->slot.y == b->slot.y);
+            CHECK(a->width == b->width);
+            CHECK(a->height == b->height);
+            CHECK(a->offset_x == b->offset_x);
+            CHECK(a->offset_y == b->offset_y);
+            CHECK(a->advance == b->advance);
+        }
+        CHECK(restored.find_glyph(U'M', 24.0f, font::text_style::normal) != nullptr);
+        CHECK(restored.find_glyph(U'M') == nullptr);
+        CHECK(restored.line_height() == original.line_height());
+
+        // Identical caches serialize to identical bytes
+        CHECK(restored.save_snapshot() == snapshot);
+    }
+
+    TEST_CASE("damaged snapshots are rejected and leave the cache untouched") {
+        auto target = make_target();
+        REQUIRE(target.has_value());
+        auto fnt = font::font::load(test::test_font_data());
+        REQUIRE(fnt.has_value());
+        fnt->set_size(16.0f);
+
+        const auto snapshot = make_snapshot(target->rend, *fnt);
+        REQUIRE(snapshot.size() > header_size + 4 * glyph_record_size);
+
+        font::font_cache cache(target->rend, *fnt);
+        REQUIRE(cache.store_glyph(U'M'));
+
+        auto load = [&cache](const std::vector<std::uint8_t>& data) {
+            return cache.load_snapshot(std::span<const std::uint8_t>(data));
+        };
+        auto untouched = [&cache] {
+            return cache.glyph_count() == 1 && cache.find_glyph(U'M') != nullptr;
+        };
+
+        // Empty and truncated header
+        CHECK(!load({}).has_value());
+        CHECK(!load({snapshot.begin(), snapshot.begin() + header_size - 1}).has_value());
+        CHECK(untouched());
+
+        // Truncated glyph records
+        CHECK(!load({snapshot.begin(), snapshot.begin() + header_size + glyph_record_size}).has_value());
+        CHECK(untouched());
+
+        // Truncated atlas pages
+        CHECK(!load({snapshot.begin(), snapshot.end() - 1}).has_value());
+        CHECK(untouched());
+
+        // Glyph count pointing past the end of the file
+        auto bad_count = snapshot;
+        write_field<std::uint32_t>(bad_count, glyph_count_offset, 0xFFFFFFFFu);
+        CHECK(!load(bad_count).has_value());
+        CHECK(untouched());
+
+        // Bad magic
+        auto bad_magic = snapshot;
+        bad_magic[0] ^= 0xFF;
+        CHECK(!load(bad_magic).has_value());
+        CHECK(untouched());
+
+        // Unsupported version
+        auto bad_version = snapshot;
+        write_field<std::uint32_t>(bad_version, version_offset,
+                                   read_field<std::uint32_t>(snapshot, version_offset) + 1);
+        CHECK(!load(bad_version).has_value());
+        CHECK(untouched());
+    }
+
+    TEST_CASE("snapshot of another font is rejected") {
+        auto target = make_target();
+        REQUIRE(target.has_value());
+        auto fnt = font::font::load(test::test_font_data());
+        REQUIRE(fnt.has_value());
+        fnt->set_size(16.0f);
+
+        // Same face with trailing padding: loads fine but hashes differently
+        std::vector<std::uint8_t> padded(test::test_font_data().begin(), test::test_font_data().end());
+        padded.resize(padded.size() + 4, 0);
+        auto other = font::font::load(std::span<const std::uint8_t>(padded));
+        REQUIRE(other.has_value());
+        REQUIRE(other->identity() != fnt->identity());
+        other->set_size(16.0f);
+
+        const auto snapshot = make_snapshot(target->rend, *fnt);
+        CHECK(read_field<std::uint64_t>(snapshot, font_key_offset) == fnt->identity());
+
+        font::font_cache cache(target->rend, *other);
+        auto result = cache.load_snapshot(std::span<const std::uint8_t>(snapshot));
+        CHECK(!result.has_value());
+        CHECK(cache.glyph_count() == 0);
+
+        font::font_cache same(target->rend, *fnt);
+        CHECK(same.load_snapshot(std::span<const std::uint8_t>(snapshot)).has_value());
+    }
+
+    TEST_CASE("glyph records outside the atlas are rejected") {
+        auto target = make_target();
+        REQUIRE(target.has_value());
+        auto fnt = font::font::load(test::test_font_data());
+        REQUIRE(fnt.has_value());
+        fnt->set_size(16.0f);
+
+        const auto snapshot = make_snapshot(target->rend, *fnt);
+        font::font_cache cache(target->rend, *fnt);
+
+        auto load = [&cache](const std::vector<std::uint8_t>& data) {
+            return cache.load_snapshot(std::span<const std::uint8_t>(data));
+        };
+
+        const std::size_t record = header_size;
+
+        // Page index past the page count
+        auto bad_page = snapshot;
+        write_field<std::int32_t>(bad_page, record + record_page_offset, 1000);
+        CHECK(!load(bad_page).has_value());
+
+        auto negative_page = snapshot;
+        write_field<std::int32_t>(negative_page, record + record_page_offset, -1);
+        CHECK(!load(negative_page).has_value());
+
+        // Slot running off the right edge of the page
+        auto bad_x = snapshot;
+        write_field<std::int32_t>(bad_x, record + record_x_offset, 0x7FFFFFFF);
+        CHECK(!load(bad_x).has_value());
+
+        // Page offset past the end of the file
+        auto bad_offset = snapshot;
+        write_field<std::uint64_t>(bad_offset, page_offset_offset, snapshot.size() + 64);
+        CHECK(!load(bad_offset).has_value());
+
+        CHECK(cache.glyph_count() == 0);
+        CHECK(load(snapshot).has_value());
+        CHECK(cache.glyph_count() == 4);
+    }
+}
@@ -0,0 +1,72 @@
+//
+// Tiny TrueType font shared by the font tests
+//
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace sdlpp::test {
+
+// Monospaced outline font, 1000 units/em, every advance 600 units.
+// Maps ' ', 'A', 'B' (box with a hole), 'M' (full em box) and '.';
+// other codepoints fall back to .notdef. Built with fontTools' FontBuilder.
+inline constexpr std::uint8_t test_font_ttf[] = {
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x80, 0x00, 0x03, 0x00, 0x20, 0x4f, 0x53, 0x2f, 0x32,
+    0x45, 0x00, 0x44, 0x41, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70,
+    0x00, 0xae, 0x00, 0xc1, 0x00, 0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x4c, 0x67, 0x6c, 0x79, 0x66,
+    0x6d, 0xa2, 0xb8, 0x56, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x8a, 0x68, 0x65, 0x61, 0x64,
+    0x2f, 0x61, 0xb6, 0xce, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
+    0x05, 0x7a, 0x01, 0x92, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
+    0x02, 0x58, 0x00, 0x00, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x00, 0x0e, 0x6c, 0x6f, 0x63, 0x61,
+    0x00, 0x7f, 0x00, 0x61, 0x00, 0x00, 0x01, 0xe4, 0x00, 0x00, 0x00, 0x0e, 0x6d, 0x61, 0x78, 0x70,
+    0x00, 0x09, 0x00, 0x0a, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+    0x9c, 0x68, 0xb9, 0x07, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x66, 0x70, 0x6f, 0x73, 0x74,
+    0x00, 0x41, 0x00, 0x54, 0x00, 0x00, 0x02, 0xe8, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x96, 0x2b, 0xbb, 0xaf, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x01, 0x03, 0xe8,
+    0x00, 0x00, 0x00, 0x00, 0xe6, 0xfa, 0x39, 0xcb, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xfa, 0x39, 0xcb,
+    0x00, 0x00, 0xff, 0x38, 0x02, 0x58, 0x03, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x20, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x58, 0x01, 0x90, 0x00, 0x05,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x4d, 0x03, 0x20, 0xff, 0x38,
+    0x00, 0x00, 0x03, 0x20, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x04, 0x00, 0x38,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x02, 0x00, 0x02, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x42,
+    0x00, 0x4d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x41, 0x00, 0x4d, 0xff, 0xff,
+    0xff, 0xe1, 0xff, 0xd7, 0xff, 0xc1, 0xff, 0xb7, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x3a,
+    0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x32, 0x00, 0x00, 0x02, 0x26, 0x02, 0xbc, 0x00, 0x03,
+    0x00, 0x00, 0x33, 0x11, 0x21, 0x11, 0x32, 0x01, 0xf4, 0x02, 0xbc, 0xfd, 0x44, 0x00, 0x00, 0x01,
+    0x00, 0x32, 0x00, 0x00, 0x02, 0x26, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x00, 0x33, 0x11, 0x21, 0x11,
+    0x32, 0x01, 0xf4, 0x02, 0xbc, 0xfd, 0x44, 0x00, 0x00, 0x02, 0x00, 0x32, 0x00, 0x00, 0x02, 0x26,
+    0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x33, 0x11, 0x21, 0x11, 0x25, 0x33, 0x11, 0x23,
+    0x32, 0x01, 0xf4, 0xfe, 0xa2, 0xc8, 0xc8, 0x02, 0xbc, 0xfd, 0x44, 0xc8, 0x01, 0x2c, 0x00, 0x01,
+    0x00, 0x00, 0xff, 0x38, 0x02, 0x58, 0x03, 0x20, 0x00, 0x03, 0x00, 0x00, 0x15, 0x11, 0x21, 0x11,
+    0x02, 0x58, 0xc8, 0x03, 0xe8, 0xfc, 0x18, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x90,
+    0x00, 0xc8, 0x00, 0x03, 0x00, 0x00, 0x33, 0x35, 0x33, 0x15, 0xc8, 0xc8, 0xc8, 0xc8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x09, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x12, 0x00, 0x10, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x02, 0x00, 0x0e, 0x00, 0x22, 0x53, 0x64, 0x6c, 0x70, 0x70, 0x54, 0x65, 0x73, 0x74, 0x52,
+    0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x00, 0x53, 0x00, 0x64, 0x00, 0x6c, 0x00, 0x70, 0x00, 0x70,
+    0x00, 0x54, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75,
+    0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x24,
+    0x00, 0x25, 0x00, 0x30, 0x00, 0x11, 0x00, 0x00,
+};
+
+inline std::span<const std::uint8_t> test_font_data() {
+    return {test_font_ttf, sizeof(test_font_ttf)};
+}
+
+} // namespace sdlpp::test
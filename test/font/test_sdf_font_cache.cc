@@ -0,0 +1,111 @@
+//
+// Signed distance field cache tests
+//
+
+#include <doctest/doctest.h>
+#include <cstdint>
+
+#include "sdlpp/font/sdf_font_cache.hh"
+#include "sdlpp/font/font.hh"
+#include "sdlpp/video/renderer.hh"
+#include "sdlpp/video/surface.hh"
+#include "sdlpp/video/surface_renderer.hh"
+#include "test_font_data.hh"
+
+using namespace sdlpp;
+
+namespace {
+    // Lit pixels in one row of the surface
+    int lit_in_row(const surface& surf, int y) {
+        int lit = 0;
+        for (int x = 0; x < static_cast<int>(surf.width()); ++x) {
+            auto c = surf.get_pixel(x, y);
+            if (c && c->r >= 128) ++lit;
+        }
+        return lit;
+    }
+}
+
+TEST_SUITE("sdf font cache") {
+    TEST_CASE("distance field is inside-positive around the glyph edge") {
+        auto surf = surface::create_rgb(16, 16, pixel_format_enum::RGBA8888);
+        REQUIRE(surf.has_value());
+        auto rend = renderer::create_software(surf->get());
+        REQUIRE(rend.has_value());
+        auto fnt = font::font::load(test::test_font_data());
+        REQUIRE(fnt.has_value());
+
+        font::sdf_font_cache cache(*rend, *fnt, 64.0f, 8);
+        REQUIRE(cache.store_glyph(U'M'));
+        const auto* glyph = cache.find_glyph(U'M');
+        REQUIRE(glyph != nullptr);
+        REQUIRE(glyph->slot.valid());
+
+        // 'M' is a solid 0.6 x 1.0 em box: 38.4 x 64 reference pixels
+        const auto& slot = glyph->slot;
+        CHECK(slot.width > 38);
+        CHECK(slot.height > 64);
+        CHECK(glyph->advance == doctest::Approx(38.4f).epsilon(0.05));
+
+        const std::uint8_t* page = cache.atlas().page_pixels(slot.page);
+        REQUIRE(page != nullptr);
+        const int pitch = cache.atlas().pitch();
+        auto field = [&](int x, int y) {
+            return static_cast<int>(page[(slot.y + y) * pitch + slot.x + x]);
+        };
+
+        // Far outside reads 0, deep inside saturates
+        CHECK(field(0, 0) == 0);
+        CHECK(field(slot.width - 1, slot.height - 1) == 0);
+        CHECK(field(slot.width / 2, slot.height / 2) == 255);
+
+        // Across the left edge the field rises monotonically through 128
+        const int row = slot.height / 2;
+        int crossing = -1;
+        for (int x = 1; x <= slot.width / 2; ++x) {
+            CHECK(field(x, row) >= field(x - 1, row));
+            if (crossing < 0 && field(x, row) >= 128) crossing = x;
+        }
+        // The edge sits one texel past the spread margin
+        CHECK(crossing >= cache.spread());
+        CHECK(crossing <= cache.spread() + 2);
+
+        // Whitespace gets an advance but no field
+        REQUIRE(cache.store_glyph(U' '));
+        CHECK(!cache.find_glyph(U' ')->slot.valid());
+    }
+
+    TEST_CASE("software threshold keeps the glyph size at every scale") {
+        auto surf = surface::create_rgb(96, 96, pixel_format_enum::RGBA8888);
+        REQUIRE(surf.has_value());
+        auto rend = renderer::create_software(surf->get());
+        REQUIRE(rend.has_value());
+        auto fnt = font::font::load(test::test_font_data());
+        REQUIRE(fnt.has_value());
+
+        font::sdf_font_cache cache(*rend, *fnt, 64.0f, 8);
+        surface_renderer sw(*surf);
+
+        for (float size : {64.0f, 32.0f, 80.0f}) {
+            REQUIRE(sw.set_draw_color(colors::black).has_value());
+            REQUIRE(sw.clear().has_value());
+
+            const float advance = cache.render_text(sw, "M", 4, 4, size, colors::white);
+            CHECK(advance == doctest::Approx(0.6f * size).epsilon(0.05));
+
+            // The box covers 0.6 em horizontally and 1.0 em vertically
+            const int middle = 4 + static_cast<int>(size / 2.0f);
+            const int width = lit_in_row(*surf, middle);
+            CHECK(width >= static_cast<int>(0.6f * size) - 2);
+            CHECK(width <= static_cast<int>(0.6f * size) + 2);
+
+            int height = 0;
+            for (int y = 0; y < static_cast<int>(surf->height()); ++y) {
+                auto c = surf->get_pixel(4 + static_cast<int>(0.3f * size), y);
+                if (c && c->r >= 128) ++height;
+            }
+            CHECK(height >= static_cast<int>(size) - 2);
+            CHECK(height <= static_cast<int>(size) + 2);
+        }
+    }
+}
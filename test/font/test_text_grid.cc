@@ -0,0 +1,188 @@
+//
+// Text grid dirty tracking and scrolling tests
+//
+
+#include <doctest/doctest.h>
+#include <vector>
+
+#include "sdlpp/font/text_grid.hh"
+#include "sdlpp/video/renderer.hh"
+#include "sdlpp/video/surface.hh"
+#include "test_font_data.hh"
+
+using namespace sdlpp;
+
+namespace {
+    // Blank cell with a background color
+    font::grid_cell blank(const color& bg) {
+        return font::grid_cell{U' ', colors::white, bg, font::cell_attr::none};
+    }
+
+    // Fill every cell of a row with one background color
+    void paint_row(font::text_grid& grid, int row, const color& bg) {
+        grid.fill(0, row, grid.columns(), blank(bg));
+    }
+
+    // Color in the middle of a grid row drawn at (x, y)
+    color row_color(const surface& surf, const font::text_grid& grid, int x, int y, int row) {
+        auto c = surf.get_pixel(x + grid.cell_width() / 2,
+                                y + row * grid.cell_height() + grid.cell_height() / 2);
+        return c ? *c : color{1, 2, 3, 4};
+    }
+}
+
+TEST_SUITE("text grid") {
+    TEST_CASE("only changed cells are marked dirty") {
+        auto surf = surface::create_rgb(64, 64, pixel_format_enum::RGBA8888);
+        REQUIRE(surf.has_value());
+        auto rend = renderer::create_software(surf->get());
+        REQUIRE(rend.has_value());
+        auto fnt = font::font::load(test::test_font_data());
+        REQUIRE(fnt.has_value());
+        fnt->set_size(16.0f);
+        font::font_cache cache(*rend, *fnt);
+
+        font::text_grid grid(cache, 4, 3);
+        CHECK(grid.dirty_cells() == 12);
+        REQUIRE(grid.update().has_value());
+        CHECK(grid.last_redrawn_cells() == 12);
+        CHECK(grid.dirty_cells() == 0);
+
+        // Rewriting identical content keeps the grid clean
+        const std::vector<font::grid_cell> same(4, font::grid_cell{});
+        grid.write_row(1, same);
+        grid.fill(0, 2, 4, font::grid_cell{});
+        CHECK(grid.dirty_cells() == 0);
+
+        // A cell changed twice is counted once
+        CHECK(grid.write(0, 0, "AB", colors::white, colors::black) == 2);
+        CHECK(grid.write(0, 0, "AM", colors::white, colors::black) == 2);
+        CHECK(grid.dirty_cells() == 2);
+
+        // Bulk row writes, clipped at the row end
+        std::vector<font::grid_cell> row(6, blank(colors::blue));
+        grid.write_row(1, row, 1);
+        CHECK(grid.dirty_cells() == 5);
+        grid.fill(-2, 2, 4, blank(colors::red));
+        CHECK(grid.dirty_cells() == 7);
+        CHECK(grid.get(1, 2).bg == colors::red);
+        CHECK(grid.get(2, 2).bg == colors::black);
+
+        REQUIRE(grid.update().has_value());
+        CHECK(grid.last_redrawn_cells() == 7);
+        CHECK(grid.dirty_cells() == 0);
+
+        // Nothing changed: the next update draws nothing
+        REQUIRE(grid.update().has_value());
+        CHECK(grid.last_redrawn_cells() == 0);
+
+        grid.invalidate();
+        CHECK(grid.dirty_cells() == 12);
+    }
+
+    TEST_CASE("scrolling rotates rows and dirties only the exposed ones") {
+        auto surf = surface::create_rgb(64, 64, pixel_format_enum::RGBA8888);
+        REQUIRE(surf.has_value());
+        auto rend = renderer::create_software(surf->get());
+        REQUIRE(rend.has_value());
+        auto fnt = font::font::load(test::test_font_data());
+        REQUIRE(fnt.has_value());
+        fnt->set_size(16.0f);
+        font::font_cache cache(*rend, *fnt);
+
+        font::text_grid grid(cache, 3, 3);
+        grid.write(0, 0, "AAA", colors::white, colors::black);
+        grid.write(0, 1, "BBB", colors::white, colors::black);
+        grid.write(0, 2, "MMM", colors::white, colors::black);
+        REQUIRE(grid.update().has_value());
+
+        grid.scroll_up(1, colors::blue);
+        CHECK(grid.get(0, 0).codepoint == U'B');
+        CHECK(grid.get(2, 1).codepoint == U'M');
+        CHECK(grid.get(1, 2) == blank(colors::blue));
+        CHECK(grid.dirty_cells() == 3);
+
+        REQUIRE(grid.update().has_value());
+        CHECK(grid.last_redrawn_cells() == 3);
+
+        // Writes after a scroll land on the rotated rows
+        grid.set(1, 0, font::grid_cell{U'.', colors::white, colors::black, font::cell_attr::none});
+        CHECK(grid.get(1, 0).codepoint == U'.');
+        CHECK(grid.get(0, 0).codepoint == U'B');
+        CHECK(grid.dirty_cells() == 1);
+
+        // Scrolling by two wraps the ring past its start
+        grid.scroll_up(2, colors::blue);
+        CHECK(grid.get(0, 0) == blank(colors::blue));
+        CHECK(grid.get(0, 1) == blank(colors::blue));
+        CHECK(grid.get(0, 2) == blank(colors::blue));
+        // The 'B' and 'M' rows are blanked; the blue row moves to the top as is
+        CHECK(grid.dirty_cells() == 6);
+
+        // Scrolling by more than the height blanks every row
+        grid.write(0, 0, "ABM", colors::white, colors::black);
+        grid.scroll_up(10, colors::green);
+        for (int row = 0; row < 3; ++row) {
+            for (int col = 0; col < 3; ++col) {
+                CHECK(grid.get(col, row) == blank(colors::green));
+            }
+        }
+    }
+
+    TEST_CASE("render blits a rotated target in two pieces") {
+        auto surf = surface::create_rgb(64, 96, pixel_format_enum::RGBA8888);
+        REQUIRE(surf.has_value());
+        auto rend = renderer::create_software(surf->get());
+        REQUIRE(rend.has_value());
+        auto fnt = font::font::load(test::test_font_data());
+        REQUIRE(fnt.has_value());
+        fnt->set_size(16.0f);
+        font::font_cache cache(*rend, *fnt);
+
+        font::text_grid grid(cache, 2, 4);
+        REQUIRE(grid.cell_width() > 0);
+        REQUIRE(grid.cell_height() > 0);
+        paint_row(grid, 0, colors::red);
+        paint_row(grid, 1, colors::green);
+        paint_row(grid, 2, colors::blue);
+        paint_row(grid, 3, colors::white);
+
+        const int x = 3;
+        const int y = 5;
+        auto draw = [&] {
+            REQUIRE(rend->set_draw_color(colors::black).has_value());
+            REQUIRE(rend->clear().has_value());
+            REQUIRE(grid.render(x, y).has_value());
+            REQUIRE(rend->present().has_value());
+        };
+
+        draw();
+        CHECK(row_color(*surf, grid, x, y, 0) == colors::red);
+        CHECK(row_color(*surf, grid, x, y, 3) == colors::white);
+
+        // Storage rows 0 and 1 now sit below rows 2 and 3
+        grid.scroll_up(2, colors::yellow);
+        draw();
+        CHECK(grid.last_redrawn_cells() == 4);
+        CHECK(row_color(*surf, grid, x, y, 0) == colors::blue);
+        CHECK(row_color(*surf, grid, x, y, 1) == colors::white);
+        CHECK(row_color(*surf, grid, x, y, 2) == colors::yellow);
+        CHECK(row_color(*surf, grid, x, y, 3) == colors::yellow);
+
+        // Nothing is drawn above or below the grid
+        auto above = surf->get_pixel(x + 1, y - 1);
+        auto below = surf->get_pixel(x + 1, y + 4 * grid.cell_height());
+        REQUIRE(above.has_value());
+        REQUIRE(below.has_value());
+        CHECK(*above == colors::black);
+        CHECK(*below == colors::black);
+
+        // One more row leaves a single storage row in the upper piece
+        grid.scroll_up(1, colors::green);
+        draw();
+        CHECK(row_color(*surf, grid, x, y, 0) == colors::white);
+        CHECK(row_color(*surf, grid, x, y, 1) == colors::yellow);
+        CHECK(row_color(*surf, grid, x, y, 2) == colors::yellow);
+        CHECK(row_color(*surf, grid, x, y, 3) == colors::green);
+    }
+}
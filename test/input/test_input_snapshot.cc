@@ -0,0 +1,168 @@
+#include <doctest/doctest.h>
+#include <sdlpp/input/input_snapshot.hh>
+#include <vector>
+
+namespace {
+    SDL_Event key_event(SDL_Scancode sc, bool down, Uint64 timestamp = 1) {
+        SDL_Event e{};
+        e.type = down ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+        e.key.timestamp = timestamp;
+        e.key.scancode = sc;
+        e.key.down = down;
+        return e;
+    }
+
+    SDL_Event mouse_event(Uint8 button, bool down) {
+        SDL_Event e{};
+        e.type = down ? SDL_EVENT_MOUSE_BUTTON_DOWN : SDL_EVENT_MOUSE_BUTTON_UP;
+        e.button.timestamp = 1;
+        e.button.button = button;
+        e.button.down = down;
+        e.button.x = 12.0f;
+        e.button.y = 34.0f;
+        return e;
+    }
+
+    SDL_Event gamepad_event(SDL_JoystickID which, Uint8 button, bool down) {
+        SDL_Event e{};
+        e.type = down ? SDL_EVENT_GAMEPAD_BUTTON_DOWN : SDL_EVENT_GAMEPAD_BUTTON_UP;
+        e.gbutton.timestamp = 1;
+        e.gbutton.which = which;
+        e.gbutton.button = button;
+        e.gbutton.down = down;
+        return e;
+    }
+}
+
+TEST_SUITE("input_snapshot") {
+    TEST_CASE("packed_bitset operations and set-bit iteration") {
+        sdlpp::packed_bitset<200> a;
+        sdlpp::packed_bitset<200> b;
+        a.set(3);
+        a.set(64);
+        a.set(199);
+        b.set(64);
+        b.set(100);
+
+        CHECK(a.test(64));
+        CHECK_FALSE(a.test(65));
+        CHECK_FALSE(a.test(1000));
+        CHECK(a.count() == 3);
+        CHECK((a & b).count() == 1);
+        CHECK((a | b).count() == 4);
+        CHECK((a ^ b).count() == 3);
+
+        std::vector<std::size_t> bits(a.begin(), a.end());
+        CHECK(bits == std::vector<std::size_t>{3, 64, 199});
+
+        a.reset();
+        CHECK(a.none());
+        CHECK(a.begin() == a.end());
+    }
+
+    TEST_CASE("keyboard edges across frames") {
+        sdlpp::input_tracker input;
+
+        input.process(key_event(SDL_SCANCODE_A, true, 100));
+        const auto& f1 = input.next_frame();
+        CHECK(f1.frame() == 1);
+        CHECK(f1.key_down(sdlpp::scancode::a));
+        CHECK(f1.key_pressed(sdlpp::scancode::a));
+        CHECK_FALSE(f1.key_held(sdlpp::scancode::a));
+        CHECK(f1.first_event_ns() == 100);
+
+        const auto& f2 = input.next_frame();
+        CHECK(f2.key_down(sdlpp::scancode::a));
+        CHECK_FALSE(f2.key_pressed(sdlpp::scancode::a));
+        CHECK(f2.key_held(sdlpp::scancode::a));
+        CHECK_FALSE(f2.any_changes());
+        CHECK(f2.first_event_ns() == 0);
+
+        input.process(key_event(SDL_SCANCODE_A, false));
+        const auto& f3 = input.next_frame();
+        CHECK_FALSE(f3.key_down(sdlpp::scancode::a));
+        CHECK(f3.key_released(sdlpp::scancode::a));
+        CHECK(input.previous().key_held(sdlpp::scancode::a));
+    }
+
+    TEST_CASE("tap within one frame reports both edges") {
+        sdlpp::input_tracker input;
+        input.process(key_event(SDL_SCANCODE_SPACE, true));
+        input.process(key_event(SDL_SCANCODE_SPACE, false));
+        input.process(key_event(SDL_SCANCODE_B, true));
+
+        const auto& snap = input.next_frame();
+        CHECK_FALSE(snap.key_down(sdlpp::scancode::space));
+        CHECK(snap.key_pressed(sdlpp::scancode::space));
+        CHECK(snap.key_released(sdlpp::scancode::space));
+
+        std::vector<sdlpp::scancode> changed;
+        snap.for_each_changed_key([&](sdlpp::scancode sc) { changed.push_back(sc); });
+        CHECK(changed == std::vector<sdlpp::scancode>{sdlpp::scancode::b, sdlpp::scancode::space});
+    }
+
+    TEST_CASE("key repeat does not create edges") {
+        sdlpp::input_tracker input;
+        input.process(key_event(SDL_SCANCODE_A, true));
+        (void)input.next_frame();
+
+        auto repeat = key_event(SDL_SCANCODE_A, true);
+        repeat.key.repeat = true;
+        input.process(repeat);
+        const auto& snap = input.next_frame();
+        CHECK_FALSE(snap.key_pressed(sdlpp::scancode::a));
+        CHECK(snap.key_held(sdlpp::scancode::a));
+    }
+
+    TEST_CASE("mouse buttons and position") {
+        sdlpp::input_tracker input;
+        input.process(mouse_event(SDL_BUTTON_LEFT, true));
+        const auto& snap = input.next_frame();
+        CHECK(snap.mouse_pressed(sdlpp::mouse_button::left));
+        CHECK_FALSE(snap.mouse_down(sdlpp::mouse_button::right));
+        CHECK(snap.mouse_x() == 12.0f);
+        CHECK(snap.mouse_y() == 34.0f);
+    }
+
+    TEST_CASE("gamepad slots and removal") {
+        sdlpp::input_tracker input;
+        input.process(gamepad_event(42, SDL_GAMEPAD_BUTTON_SOUTH, true));
+        input.process(gamepad_event(7, SDL_GAMEPAD_BUTTON_EAST, true));
+
+        const auto& f1 = input.next_frame();
+        const std::size_t pad42 = f1.gamepad_slot(42);
+        const std::size_t pad7 = f1.gamepad_slot(7);
+        REQUIRE(pad42 < sdlpp::input_snapshot::max_gamepads);
+        REQUIRE(pad7 < sdlpp::input_snapshot::max_gamepads);
+        CHECK(pad42 != pad7);
+        CHECK(f1.gamepad_pressed(pad42, sdlpp::gamepad_button::south));
+        CHECK_FALSE(f1.gamepad_down(pad42, sdlpp::gamepad_button::east));
+        CHECK(f1.gamepad_down(pad7, sdlpp::gamepad_button::east));
+
+        SDL_Event removed{};
+        removed.type = SDL_EVENT_GAMEPAD_REMOVED;
+        removed.gdevice.which = 42;
+        input.process(removed);
+
+        const auto& f2 = input.next_frame();
+        CHECK(f2.gamepad_id(pad42) == 42);
+        CHECK(f2.gamepad_released(pad42, sdlpp::gamepad_button::south));
+
+        const auto& f3 = input.next_frame();
+        CHECK(f3.gamepad_id(pad42) == 0);
+        CHECK(f3.gamepad_slot(42) == sdlpp::input_snapshot::max_gamepads);
+    }
+
+    TEST_CASE("release_all reports releases") {
+        sdlpp::input_tracker input;
+        input.process(key_event(SDL_SCANCODE_A, true));
+        input.process(mouse_event(SDL_BUTTON_RIGHT, true));
+        (void)input.next_frame();
+
+        input.release_all();
+        const auto& snap = input.next_frame();
+        CHECK(snap.key_released(sdlpp::scancode::a));
+        CHECK(snap.mouse_released(sdlpp::mouse_button::right));
+        CHECK_FALSE(snap.keys().down.any());
+    }
+}
@@ -0,0 +1,121 @@
+#include <doctest/doctest.h>
+#include <sdlpp/system/job_system.hh>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_SUITE("job_system") {
+    TEST_CASE("submit with counter") {
+        sdlpp::job_system jobs(3);
+        CHECK(jobs.worker_count() == 3);
+
+        std::atomic<int> ran{0};
+        sdlpp::job_counter counter;
+        for (int i = 0; i < 500; ++i) {
+            jobs.submit([&ran] { ran.fetch_add(1); }, &counter);
+        }
+        jobs.wait(counter);
+        CHECK(counter.done());
+        CHECK(ran.load() == 500);
+    }
+
+    TEST_CASE("large callables are stored out of line") {
+        sdlpp::job_system jobs(2);
+        std::array<int, 64> payload{};
+        payload.fill(3);
+
+        std::atomic<int> sum{0};
+        sdlpp::job_counter counter;
+        jobs.submit([payload, &sum] {
+            sum.store(std::accumulate(payload.begin(), payload.end(), 0));
+        }, &counter);
+        jobs.wait(counter);
+        CHECK(sum.load() == 192);
+    }
+
+    TEST_CASE("parallel_for with index and range callables") {
+        sdlpp::job_system jobs(4);
+        std::vector<int> values(10000, 1);
+
+        jobs.parallel_for(0, values.size(), [&values](std::size_t i) {
+            values[i] *= 2;
+        });
+        CHECK(std::accumulate(values.begin(), values.end(), 0) == 20000);
+
+        std::atomic<std::size_t> covered{0};
+        jobs.parallel_for(100, 1100, [&covered](std::size_t first, std::size_t last) {
+            covered.fetch_add(last - first);
+        }, 64);
+        CHECK(covered.load() == 1000);
+
+        // Empty range is a no-op
+        jobs.parallel_for(5, 5, [](std::size_t) { FAIL("must not run"); });
+    }
+
+    TEST_CASE("parallel_for waits for other chunks when the caller's chunk throws") {
+        sdlpp::job_system jobs(2);
+        std::atomic<std::size_t> finished{0};
+
+        // Chunk [0, 10) runs on the calling thread
+        auto work = [&finished](std::size_t first, std::size_t last) {
+            if (first == 0) {
+                throw std::runtime_error("chunk failed");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            finished.fetch_add(last - first);
+        };
+        CHECK_THROWS_AS(jobs.parallel_for(0, 100, work, 10), std::runtime_error);
+        CHECK(finished.load() == 90);
+    }
+
+    TEST_CASE("nested waits from inside jobs") {
+        sdlpp::job_system jobs(2);
+        std::atomic<int> leaves{0};
+        sdlpp::job_counter outer;
+
+        for (int i = 0; i < 50; ++i) {
+            jobs.submit([&jobs, &leaves] {
+                sdlpp::job_counter inner;
+                for (int k = 0; k < 8; ++k) {
+                    jobs.submit([&leaves] { leaves.fetch_add(1); }, &inner);
+                }
+                jobs.wait(inner);
+            }, &outer);
+        }
+        jobs.wait(outer);
+        CHECK(leaves.load() == 400);
+    }
+
+    TEST_CASE("statistics and shutdown drain") {
+        std::atomic<int> ran{0};
+        {
+            sdlpp::job_system jobs(2);
+            sdlpp::job_counter counter;
+            for (int i = 0; i < 100; ++i) {
+                jobs.submit([&ran] { ran.fetch_add(1); }, &counter);
+            }
+            jobs.wait(counter);
+
+            auto stats = jobs.statistics();
+            REQUIRE(stats.size() == 2);
+            std::uint64_t executed = 0;
+            for (const auto& s : stats) {
+                executed += s.jobs_executed;
+            }
+            // The waiting thread may have run some jobs itself
+            CHECK(executed <= 100);
+
+            jobs.reset_statistics();
+            CHECK(jobs.statistics()[0].jobs_executed == 0);
+
+            for (int i = 0; i < 100; ++i) {
+                jobs.submit([&ran] { ran.fetch_add(1); });
+            }
+        }
+        CHECK(ran.load() == 200);
+    }
+}
@@ -0,0 +1,72 @@
+#include <doctest/doctest.h>
+#include <sdlpp/utility/triple_buffer.hh>
+#include <array>
+#include <atomic>
+#include <thread>
+
+TEST_SUITE("triple_buffer") {
+    TEST_CASE("consumer sees only published states") {
+        sdlpp::triple_buffer<int> buffer(0);
+        CHECK_FALSE(buffer.has_update());
+        CHECK_FALSE(buffer.update());
+        CHECK(buffer.read_buffer() == 0);
+
+        buffer.write_buffer() = 1;
+        CHECK(buffer.read_buffer() == 0);
+        buffer.publish();
+        CHECK(buffer.has_update());
+        CHECK(buffer.update());
+        CHECK(buffer.read_buffer() == 1);
+        CHECK_FALSE(buffer.update());
+        CHECK(buffer.read_buffer() == 1);
+    }
+
+    TEST_CASE("unread states are replaced by newer ones") {
+        sdlpp::triple_buffer<int> buffer;
+        buffer.publish(1);
+        buffer.publish(2);
+        buffer.publish(3);
+        CHECK(buffer.update());
+        CHECK(buffer.read_buffer() == 3);
+        CHECK_FALSE(buffer.update());
+    }
+
+    TEST_CASE("concurrent producer never tears a state") {
+        struct state {
+            std::array<int, 16> values{};
+        };
+
+        sdlpp::triple_buffer<state> buffer;
+        constexpr int iterations = 20000;
+        std::atomic<bool> done{false};
+
+        std::thread producer([&] {
+            for (int i = 1; i <= iterations; ++i) {
+                auto& s = buffer.write_buffer();
+                s.values.fill(i);
+                buffer.publish();
+            }
+            done.store(true, std::memory_order_release);
+        });
+
+        int last = 0;
+        bool torn = false;
+        bool monotonic = true;
+        while (!done.load(std::memory_order_acquire) || buffer.has_update()) {
+            if (!buffer.update()) {
+                continue;
+            }
+            const auto& s = buffer.read_buffer();
+            for (int v : s.values) {
+                torn = torn || v != s.values[0];
+            }
+            monotonic = monotonic && s.values[0] > last;
+            last = s.values[0];
+        }
+        producer.join();
+
+        CHECK_FALSE(torn);
+        CHECK(monotonic);
+        CHECK(last == iterations);
+    }
+}
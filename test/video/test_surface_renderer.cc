@@ -0,0 +1,122 @@
+//
+// Software renderer mask blending tests
+//
+
+#include <doctest/doctest.h>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <vector>
+
+#include "sdlpp/video/surface.hh"
+#include "sdlpp/video/surface_renderer.hh"
+
+using namespace sdlpp;
+
+namespace {
+    // Red channel of a pixel, -1 on error
+    int red_at(const surface& surf, int x, int y) {
+        auto c = surf.get_pixel(x, y);
+        return c ? c->r : -1;
+    }
+
+    bool near(int value, int expected) {
+        return std::abs(value - expected) <= 1;
+    }
+}
+
+TEST_SUITE("surface renderer") {
+    TEST_CASE("blend_mask scales coverage by the draw alpha") {
+        auto surf = surface::create_rgb(8, 8, pixel_format_enum::RGBA8888);
+        REQUIRE(surf.has_value());
+        surface_renderer sw(*surf);
+        REQUIRE(sw.set_draw_color(colors::black).has_value());
+        REQUIRE(sw.clear().has_value());
+
+        const std::vector<uint8_t> mask = {
+            0,   255,
+            128, 64
+        };
+
+        // Opaque color: coverage alone decides the blend
+        REQUIRE(sw.set_draw_color(color{255, 255, 255, 255}).has_value());
+        REQUIRE(sw.blend_mask(1, 1, mask, 2, 2).has_value());
+        CHECK(red_at(*surf, 1, 1) == 0);
+        CHECK(red_at(*surf, 2, 1) == 255);
+        CHECK(near(red_at(*surf, 1, 2), 128));
+        CHECK(near(red_at(*surf, 2, 2), 64));
+        CHECK(red_at(*surf, 0, 0) == 0);
+        CHECK(red_at(*surf, 3, 3) == 0);
+
+        // Translucent color: full coverage still blends by the color alpha
+        REQUIRE(sw.set_draw_color(color{255, 255, 255, 128}).has_value());
+        REQUIRE(sw.blend_mask(5, 5, mask, 2, 2).has_value());
+        CHECK(red_at(*surf, 5, 5) == 0);
+        CHECK(near(red_at(*surf, 6, 5), 128));
+        CHECK(near(red_at(*surf, 5, 6), 64));
+        CHECK(near(red_at(*surf, 6, 6), 32));
+    }
+
+    TEST_CASE("blend_mask clips at the surface edges") {
+        auto surf = surface::create_rgb(4, 4, pixel_format_enum::RGBA8888);
+        REQUIRE(surf.has_value());
+        surface_renderer sw(*surf);
+        REQUIRE(sw.set_draw_color(colors::black).has_value());
+        REQUIRE(sw.clear().has_value());
+        REQUIRE(sw.set_draw_color(colors::white).has_value());
+
+        // Only the bottom-right texel of each mask is set
+        std::vector<uint8_t> mask(16, 0);
+        mask[15] = 255;
+
+        // Hanging off the top-left: mask texel (3, 3) lands on (1, 1)
+        REQUIRE(sw.blend_mask(-2, -2, mask, 4, 4).has_value());
+        CHECK(red_at(*surf, 1, 1) == 255);
+        CHECK(red_at(*surf, 0, 0) == 0);
+
+        // Hanging off the bottom-right: mask texel (3, 3) is clipped away
+        REQUIRE(sw.blend_mask(2, 2, mask, 4, 4).has_value());
+        for (int y = 0; y < 4; ++y) {
+            for (int x = 0; x < 4; ++x) {
+                CHECK(red_at(*surf, x, y) == ((x == 1 && y == 1) ? 255 : 0));
+            }
+        }
+
+        // Entirely outside the surface is a no-op
+        CHECK(sw.blend_mask(4, 0, mask, 4, 4).has_value());
+        CHECK(sw.blend_mask(0, -4, mask, 4, 4).has_value());
+
+        // Padded rows: pitch skips the trailing byte of each row
+        const std::vector<uint8_t> padded = {
+            255, 0,   99,
+            0,   255
+        };
+        REQUIRE(sw.blend_mask(2, 2, padded, 2, 2, 3).has_value());
+        CHECK(red_at(*surf, 2, 2) == 255);
+        CHECK(red_at(*surf, 3, 2) == 0);
+        CHECK(red_at(*surf, 3, 3) == 255);
+
+        // Buffer shorter than width/height/pitch describe
+        CHECK(!sw.blend_mask(0, 0, padded, 3, 2).has_value());
+        CHECK(!sw.blend_mask(0, 0, padded, 2, 2, 1).has_value());
+    }
+
+    TEST_CASE("blend_mask honours the clip rectangle") {
+        auto surf = surface::create_rgb(4, 4, pixel_format_enum::RGBA8888);
+        REQUIRE(surf.has_value());
+        surface_renderer sw(*surf);
+        REQUIRE(sw.set_draw_color(colors::black).has_value());
+        REQUIRE(sw.clear().has_value());
+        REQUIRE(sw.set_draw_color(colors::white).has_value());
+        REQUIRE(sw.set_clip_rect(std::optional<rect<int>>(rect<int>{1, 1, 2, 2})).has_value());
+
+        const std::vector<uint8_t> mask(16, 255);
+        REQUIRE(sw.blend_mask(0, 0, mask, 4, 4).has_value());
+        for (int y = 0; y < 4; ++y) {
+            for (int x = 0; x < 4; ++x) {
+                const bool inside = x >= 1 && x < 3 && y >= 1 && y < 3;
+                CHECK(red_at(*surf, x, y) == (inside ? 255 : 0));
+            }
+        }
+    }
+}